@@ -104,6 +104,10 @@ ErrorOr<NonnullRefPtr<WebView::WebContentClient>> launch_web_content_process(
         arguments.append("--force-cpu-painting"sv);
     if (web_content_options.force_fontconfig == WebView::ForceFontconfig::Yes)
         arguments.append("--force-fontconfig"sv);
+    if (web_content_options.bytecode_cache_directory.has_value()) {
+        arguments.append("--bytecode-cache"sv);
+        arguments.append(web_content_options.bytecode_cache_directory.value());
+    }
     if (auto server = mach_server_name(); server.has_value()) {
         arguments.append("--mach-server-name"sv);
         arguments.append(server.value());
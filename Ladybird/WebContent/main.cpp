@@ -16,6 +16,7 @@
 #include <LibCore/SystemServerTakeover.h>
 #include <LibGfx/Font/FontDatabase.h>
 #include <LibIPC/ConnectionFromClient.h>
+#include <LibJS/Bytecode/ExecutableCache.h>
 #include <LibJS/Bytecode/Interpreter.h>
 #include <LibMain/Main.h>
 #include <LibMedia/Audio/Loader.h>
@@ -104,6 +105,7 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
     bool enable_http_cache = false;
     bool force_cpu_painting = false;
     bool force_fontconfig = false;
+    StringView bytecode_cache_directory {};
 
     Core::ArgsParser args_parser;
     args_parser.add_option(command_line, "Chrome process command line", "command-line", 0, "command_line");
@@ -121,6 +123,7 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
     args_parser.add_option(enable_http_cache, "Enable HTTP cache", "enable-http-cache");
     args_parser.add_option(force_cpu_painting, "Force CPU painting", "force-cpu-painting");
     args_parser.add_option(force_fontconfig, "Force using fontconfig for font loading", "force-fontconfig");
+    args_parser.add_option(bytecode_cache_directory, "Keep the bytecode of scripts in the given directory", "bytecode-cache", 0, "directory");
 
     args_parser.parse(arguments);
 
@@ -150,6 +153,8 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
         Web::Fetch::Fetching::g_http_cache_enabled = true;
     }
 
+    JS::Bytecode::g_bytecode_cache_directory = bytecode_cache_directory;
+
 #if defined(AK_OS_MACOS)
     if (!mach_server_name.is_empty()) {
         [[maybe_unused]] auto server_port = Core::Platform::register_with_mach_server(mach_server_name);
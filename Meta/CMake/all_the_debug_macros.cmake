@@ -30,6 +30,7 @@ set(JS_MODULE_DEBUG ON)
 set(LEXER_DEBUG ON)
 set(LIBWEB_CSS_ANIMATION_DEBUG ON)
 set(LIBWEB_CSS_DEBUG ON)
+set(LIBWEB_LAYOUT_DEBUG ON)
 set(LIBWEB_WASM_DEBUG ON)
 set(LINE_EDITOR_DEBUG ON)
 set(LZMA_DEBUG ON)
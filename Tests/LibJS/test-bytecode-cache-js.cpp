@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2026, agent <agent@local>
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibCore/Directory.h>
+#include <LibCore/File.h>
+#include <LibCore/System.h>
+#include <LibFileSystem/FileSystem.h>
+#include <LibJS/Bytecode/ExecutableCache.h>
+#include <LibJS/Bytecode/Interpreter.h>
+#include <LibJS/Runtime/GlobalObject.h>
+#include <LibJS/Runtime/VM.h>
+#include <LibJS/Script.h>
+#include <LibTest/TestCase.h>
+
+static constexpr auto source = R"~~~(
+    const values = [0.5, "string", 12345678901234567890n];
+    let sum = 0;
+    for (let i = 0; i < 10; ++i)
+        sum += i;
+    `${sum} ${values[1]} ${values[2]}`;
+)~~~"sv;
+
+static constexpr auto source_with_functions = R"~~~(
+    function outer(x) {
+        const inner = y => x * y;
+        return inner(2) + inner(3);
+    }
+    outer(4) + outer(5);
+)~~~"sv;
+
+static JS::Value run_script(JS::VM& vm, JS::Script& script)
+{
+    auto result = vm.bytecode_interpreter().run(script);
+    EXPECT(!result.is_error());
+    return result.release_value();
+}
+
+TEST_CASE(stored_bytecode_is_loaded_by_the_same_build)
+{
+    char directory_template[] = "/tmp/test-bytecode-cache.XXXXXX";
+    auto directory = MUST(Core::System::mkdtemp(directory_template));
+    JS::Bytecode::g_bytecode_cache_directory = directory.to_byte_string();
+
+    auto vm = MUST(JS::VM::create());
+    auto root_execution_context = JS::create_simple_execution_context<JS::GlobalObject>(*vm);
+    auto& realm = *root_execution_context->realm;
+
+    // The first run generates the bytecode and stores it.
+    auto first_script = MUST(JS::Script::parse(source, realm));
+    EXPECT(!first_script->take_cached_executable());
+    auto first_result = run_script(*vm, first_script);
+
+    // The second run of the same source loads it again instead.
+    auto second_script = MUST(JS::Script::parse(source, realm));
+    EXPECT(JS::Bytecode::ExecutableCache::load(*vm, second_script->parse_node(), second_script->bytecode_cache_key()));
+    auto second_result = run_script(*vm, second_script);
+
+    EXPECT(first_result.is_string());
+    EXPECT(second_result.is_string());
+    EXPECT_EQ(first_result.as_string().byte_string(), "45 string 12345678901234567890");
+    EXPECT_EQ(second_result.as_string().byte_string(), first_result.as_string().byte_string());
+
+    // Different source doesn't share an entry.
+    auto other_script = MUST(JS::Script::parse("1 + 1"sv, realm));
+    EXPECT(!other_script->take_cached_executable());
+
+    JS::Bytecode::g_bytecode_cache_directory = {};
+    MUST(FileSystem::remove(directory, FileSystem::RecursionMode::Allowed));
+}
+
+static Vector<ByteString> cache_entries(StringView directory)
+{
+    Vector<ByteString> entries;
+    MUST(Core::Directory::for_each_entry(directory, Core::DirIterator::SkipParentAndBaseDir, [&](auto const& entry, auto const&) -> ErrorOr<IterationDecision> {
+        entries.append(ByteString::formatted("{}/{}", directory, entry.name));
+        return IterationDecision::Continue;
+    }));
+    return entries;
+}
+
+TEST_CASE(functions_are_cached_along_with_their_script)
+{
+    char directory_template[] = "/tmp/test-bytecode-cache.XXXXXX";
+    auto directory = MUST(Core::System::mkdtemp(directory_template));
+    JS::Bytecode::g_bytecode_cache_directory = directory.to_byte_string();
+
+    auto vm = MUST(JS::VM::create());
+    auto root_execution_context = JS::create_simple_execution_context<JS::GlobalObject>(*vm);
+    auto& realm = *root_execution_context->realm;
+
+    auto first_result = run_script(*vm, MUST(JS::Script::parse(source_with_functions, realm)));
+    // The top-level code, outer() and the arrow function each have an entry.
+    EXPECT_EQ(cache_entries(directory).size(), 3u);
+
+    auto second_result = run_script(*vm, MUST(JS::Script::parse(source_with_functions, realm)));
+    EXPECT_EQ(cache_entries(directory).size(), 3u);
+
+    EXPECT(first_result.is_number());
+    EXPECT_EQ(first_result.as_double(), 45);
+    EXPECT_EQ(second_result.as_double(), first_result.as_double());
+
+    JS::Bytecode::g_bytecode_cache_directory = {};
+    MUST(FileSystem::remove(directory, FileSystem::RecursionMode::Allowed));
+}
+
+TEST_CASE(corrupted_entries_are_not_run)
+{
+    char directory_template[] = "/tmp/test-bytecode-cache.XXXXXX";
+    auto directory = MUST(Core::System::mkdtemp(directory_template));
+    JS::Bytecode::g_bytecode_cache_directory = directory.to_byte_string();
+
+    auto vm = MUST(JS::VM::create());
+    auto root_execution_context = JS::create_simple_execution_context<JS::GlobalObject>(*vm);
+    auto& realm = *root_execution_context->realm;
+
+    (void)run_script(*vm, MUST(JS::Script::parse(source_with_functions, realm)));
+
+    // Every operand, index and jump target in an entry is checked before it's used, so whatever ends up in the
+    // instructions, running the corrupted entries must not crash.
+    for (auto const& path : cache_entries(directory)) {
+        auto data = MUST(MUST(Core::File::open(path, Core::File::OpenMode::Read))->read_until_eof());
+        for (size_t i = data.size() / 2; i < data.size(); i += 3)
+            data[i] = ~data[i];
+        MUST(MUST(Core::File::open(path, Core::File::OpenMode::Write | Core::File::OpenMode::Truncate))->write_until_depleted(data));
+    }
+    (void)vm->bytecode_interpreter().run(MUST(JS::Script::parse(source_with_functions, realm)));
+
+    // Entries that are cut short are rejected, so the code behaves as if it had never been cached.
+    for (auto const& path : cache_entries(directory)) {
+        auto data = MUST(MUST(Core::File::open(path, Core::File::OpenMode::Read))->read_until_eof());
+        MUST(MUST(Core::File::open(path, Core::File::OpenMode::Write | Core::File::OpenMode::Truncate))->write_until_depleted(data.bytes().trim(data.size() / 2)));
+    }
+    auto result = run_script(*vm, MUST(JS::Script::parse(source_with_functions, realm)));
+    EXPECT_EQ(result.as_double(), 45);
+
+    JS::Bytecode::g_bytecode_cache_directory = {};
+    MUST(FileSystem::remove(directory, FileSystem::RecursionMode::Allowed));
+}
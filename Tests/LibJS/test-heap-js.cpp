@@ -0,0 +1,345 @@
+/*
+ * Copyright (c) 2026, agent <agent@local>
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Atomic.h>
+#include <AK/HashMap.h>
+#include <AK/HashTable.h>
+#include <AK/Vector.h>
+#include <LibJS/Heap/Heap.h>
+#include <LibJS/Heap/HeapBlockIndex.h>
+#include <LibJS/Runtime/VM.h>
+#include <LibTest/TestCase.h>
+
+static size_t s_finalized_leaf_count = 0;
+
+class Leaf final : public JS::Cell {
+    JS_CELL(Leaf, JS::Cell);
+    JS_DECLARE_ALLOCATOR(Leaf);
+
+public:
+    explicit Leaf(u32 value)
+        : m_value(value)
+    {
+    }
+
+    u32 value() const { return m_value; }
+
+private:
+    virtual void finalize() override { ++s_finalized_leaf_count; }
+
+    u32 m_value { 0 };
+};
+
+JS_DEFINE_ALLOCATOR(Leaf);
+
+// Holds on to leaves in ways that don't go through a write barrier, so its edges are visited by every young collection.
+class Holder final : public JS::Cell {
+    JS_CELL(Holder, JS::Cell);
+    JS_DECLARE_ALLOCATOR(Holder);
+
+public:
+    Vector<JS::GCPtr<Leaf>> leaves_in_vector;
+    HashMap<u32, JS::GCPtr<Leaf>> leaves_in_hash_map;
+    Leaf* raw_leaf { nullptr };
+
+private:
+    virtual void visit_edges(Visitor& visitor) override
+    {
+        Base::visit_edges(visitor);
+        visitor.visit(leaves_in_vector);
+        for (auto& it : leaves_in_hash_map)
+            visitor.visit(it.value);
+        visitor.visit(raw_leaf);
+    }
+};
+
+JS_DEFINE_ALLOCATOR(Holder);
+
+// NOTE: These are kept out of line so that pointers to the new leaves don't linger in the test's stack frame,
+//       where the conservative stack scan would keep them alive.
+static NEVER_INLINE void store_leaves(JS::Heap& heap, Holder& holder, u32 first_value)
+{
+    holder.leaves_in_vector.append(heap.allocate_without_realm<Leaf>(first_value));
+    holder.leaves_in_hash_map.set(first_value, heap.allocate_without_realm<Leaf>(first_value + 1));
+    holder.raw_leaf = heap.allocate_without_realm<Leaf>(first_value + 2).ptr();
+}
+
+static NEVER_INLINE JS::Handle<Holder> make_old_holder(JS::Heap& heap)
+{
+    auto holder = JS::make_handle(heap.allocate_without_realm<Holder>());
+    heap.collect_garbage(JS::Heap::CollectionType::CollectYoungGeneration);
+    return holder;
+}
+
+TEST_CASE(young_cells_stored_into_old_cell_survive_young_collections)
+{
+    auto vm = MUST(JS::VM::create());
+    auto& heap = vm->heap();
+    heap.set_generational_collection_enabled(true);
+
+    auto holder = make_old_holder(heap);
+    EXPECT(!holder->is_young());
+
+    s_finalized_leaf_count = 0;
+
+    store_leaves(heap, *holder, 100);
+    heap.collect_garbage(JS::Heap::CollectionType::CollectYoungGeneration);
+
+    store_leaves(heap, *holder, 200);
+    heap.collect_garbage(JS::Heap::CollectionType::CollectYoungGeneration);
+    heap.collect_garbage(JS::Heap::CollectionType::CollectYoungGeneration);
+
+    EXPECT_EQ(s_finalized_leaf_count, 0u);
+
+    EXPECT_EQ(holder->leaves_in_vector.size(), 2u);
+    EXPECT_EQ(holder->leaves_in_vector[0]->value(), 100u);
+    EXPECT_EQ(holder->leaves_in_vector[1]->value(), 200u);
+
+    EXPECT_EQ(holder->leaves_in_hash_map.size(), 2u);
+    EXPECT_EQ(holder->leaves_in_hash_map.get(100).value()->value(), 101u);
+    EXPECT_EQ(holder->leaves_in_hash_map.get(200).value()->value(), 201u);
+
+    EXPECT_EQ(holder->raw_leaf->value(), 202u);
+}
+
+static size_t s_barriered_holder_visit_count = 0;
+
+class BarrieredHolder final : public JS::Cell {
+    JS_CELL(BarrieredHolder, JS::Cell);
+    JS_DECLARE_ALLOCATOR(BarrieredHolder);
+    JS_WRITE_BARRIERED_CELL(BarrieredHolder);
+
+public:
+    JS::GCPtr<Leaf> leaf;
+    Vector<JS::NonnullGCPtr<Leaf>> leaves_in_vector;
+
+private:
+    virtual void visit_edges(Visitor& visitor) override
+    {
+        Base::visit_edges(visitor);
+        visitor.visit(leaf);
+        visitor.visit(leaves_in_vector);
+        ++s_barriered_holder_visit_count;
+    }
+};
+
+JS_DEFINE_ALLOCATOR(BarrieredHolder);
+
+static NEVER_INLINE void store_leaves_with_write_barrier(JS::Heap& heap, BarrieredHolder& holder, u32 first_value)
+{
+    holder.leaf = heap.allocate_without_realm<Leaf>(first_value);
+    auto leaf = heap.allocate_without_realm<Leaf>(first_value + 1);
+    holder.leaves_in_vector.append(leaf);
+    JS::write_barrier(holder, *leaf);
+}
+
+static NEVER_INLINE JS::Handle<BarrieredHolder> make_old_barriered_holder(JS::Heap& heap)
+{
+    auto holder = JS::make_handle(heap.allocate_without_realm<BarrieredHolder>());
+    heap.collect_garbage(JS::Heap::CollectionType::CollectYoungGeneration);
+    return holder;
+}
+
+TEST_CASE(young_collections_only_visit_old_cells_that_were_stored_into)
+{
+    auto vm = MUST(JS::VM::create());
+    auto& heap = vm->heap();
+    heap.set_generational_collection_enabled(true);
+
+    auto holder = make_old_barriered_holder(heap);
+    auto untouched_holder = make_old_barriered_holder(heap);
+    EXPECT(!holder->is_young());
+    EXPECT(!untouched_holder->is_young());
+
+    s_finalized_leaf_count = 0;
+    s_barriered_holder_visit_count = 0;
+
+    store_leaves_with_write_barrier(heap, *holder, 100);
+    EXPECT(holder->is_remembered());
+    EXPECT(!untouched_holder->is_remembered());
+
+    // Only the holder that was stored into has its edges visited, the untouched one isn't even looked at.
+    heap.collect_garbage(JS::Heap::CollectionType::CollectYoungGeneration);
+    EXPECT_EQ(s_barriered_holder_visit_count, 1u);
+    EXPECT(!holder->is_remembered());
+
+    // Now that the leaves are old too, there's nothing left to visit.
+    heap.collect_garbage(JS::Heap::CollectionType::CollectYoungGeneration);
+    EXPECT_EQ(s_barriered_holder_visit_count, 1u);
+
+    EXPECT_EQ(s_finalized_leaf_count, 0u);
+    EXPECT_EQ(holder->leaf->value(), 100u);
+    EXPECT_EQ(holder->leaves_in_vector.size(), 1u);
+    EXPECT_EQ(holder->leaves_in_vector[0]->value(), 101u);
+}
+
+TEST_CASE(heap_block_index_covers_addresses_beyond_48_bits)
+{
+    if constexpr (sizeof(FlatPtr) == 8) {
+        JS::HeapBlockIndex index;
+
+        // NOTE: The index only looks at the addresses of blocks, so these don't have to point at real memory.
+        auto high_address = static_cast<FlatPtr>(1) << 55;
+        auto& high_block = *reinterpret_cast<JS::HeapBlock*>(high_address);
+        auto& low_block = *reinterpret_cast<JS::HeapBlock*>(static_cast<FlatPtr>(JS::HeapBlock::block_size) * 1024);
+
+        index.add(high_block);
+        index.add(low_block);
+        EXPECT_EQ(index.block_containing(high_address + 16), &high_block);
+        EXPECT_EQ(index.block_containing(high_address + JS::HeapBlock::block_size), nullptr);
+        EXPECT_EQ(index.block_containing(bit_cast<FlatPtr>(&low_block) + 16), &low_block);
+
+        index.remove(high_block);
+        EXPECT_EQ(index.block_containing(high_address + 16), nullptr);
+        index.remove(low_block);
+    }
+}
+
+class GraphNode final : public JS::Cell {
+    JS_CELL(GraphNode, JS::Cell);
+    JS_DECLARE_ALLOCATOR(GraphNode);
+
+public:
+    explicit GraphNode(u32 value)
+        : m_value(value)
+    {
+    }
+
+    u32 value() const { return m_value; }
+    bool was_finalized() const { return m_was_finalized; }
+
+    Vector<JS::GCPtr<GraphNode>> edges;
+
+private:
+    virtual void visit_edges(Visitor& visitor) override
+    {
+        Base::visit_edges(visitor);
+        visitor.visit(edges);
+    }
+
+    virtual void finalize() override { m_was_finalized = true; }
+
+    u32 m_value { 0 };
+    bool m_was_finalized { false };
+};
+
+JS_DEFINE_ALLOCATOR(GraphNode);
+
+// Builds a tree of `node_count` nodes under `root`, with extra edges to earlier nodes so that many nodes are reachable
+// along several paths, and an unreachable node with edges into the graph after every reachable one.
+static NEVER_INLINE void build_graph(JS::Heap& heap, GraphNode& root, u32 node_count)
+{
+    Vector<GraphNode*> nodes;
+    nodes.append(&root);
+    for (u32 value = 1; value < node_count; ++value) {
+        auto node = heap.allocate_without_realm<GraphNode>(value);
+        nodes[(value - 1) / 4]->edges.append(node);
+        if (value > 16)
+            node->edges.append(nodes[value / 3]);
+        nodes.append(node.ptr());
+
+        auto garbage = heap.allocate_without_realm<GraphNode>(node_count + value);
+        garbage->edges.append(node);
+    }
+}
+
+TEST_CASE(parallel_marking_of_a_big_graph)
+{
+    static constexpr u32 node_count = 50000;
+
+    auto vm = MUST(JS::VM::create());
+    auto& heap = vm->heap();
+    heap.set_parallel_marking_thread_count(4);
+
+    auto root = JS::make_handle(heap.allocate_without_realm<GraphNode>(0u));
+    build_graph(heap, *root, node_count);
+
+    heap.collect_garbage();
+    heap.collect_garbage();
+
+    // Every node is still reachable from the root, and none of them were finalized.
+    HashTable<u32> seen_values;
+    Vector<GraphNode*> work_queue;
+    work_queue.append(root.ptr());
+    while (!work_queue.is_empty()) {
+        auto* node = work_queue.take_last();
+        if (seen_values.set(node->value()) != HashSetResult::InsertedNewEntry)
+            continue;
+        EXPECT_EQ(node->state(), JS::Cell::State::Live);
+        EXPECT(!node->was_finalized());
+        for (auto& edge : node->edges)
+            work_queue.append(edge.ptr());
+    }
+    EXPECT_EQ(seen_values.size(), static_cast<size_t>(node_count));
+}
+
+static Atomic<size_t> s_destroyed_swept_leaf_count = 0;
+
+class SweptLeaf final : public JS::Cell {
+    JS_CELL(SweptLeaf, JS::Cell);
+    JS_DECLARE_ALLOCATOR(SweptLeaf);
+    JS_CONCURRENTLY_SWEPT_CELL(SweptLeaf);
+
+public:
+    explicit SweptLeaf(u32 value)
+        : m_value(value)
+    {
+    }
+
+    virtual ~SweptLeaf() override { s_destroyed_swept_leaf_count.fetch_add(1, AK::MemoryOrder::memory_order_relaxed); }
+
+    u32 value() const { return m_value; }
+
+private:
+    u32 m_value { 0 };
+};
+
+JS_DEFINE_ALLOCATOR(SweptLeaf);
+
+// Keeps every other leaf alive, so that the dead ones are spread over all of the leaves' blocks.
+static NEVER_INLINE Vector<JS::Handle<SweptLeaf>> allocate_leaves_and_keep_half(JS::Heap& heap, u32 first_value, u32 count)
+{
+    Vector<JS::Handle<SweptLeaf>> kept_leaves;
+    for (u32 value = first_value; value < first_value + count; ++value) {
+        auto leaf = heap.allocate_without_realm<SweptLeaf>(value);
+        if (value % 2 == 0)
+            kept_leaves.append(JS::make_handle(leaf));
+    }
+    return kept_leaves;
+}
+
+TEST_CASE(concurrent_sweeping_destroys_dead_cells_off_the_main_thread)
+{
+    static constexpr u32 leaf_count = 40000;
+
+    auto vm = MUST(JS::VM::create());
+    auto& heap = vm->heap();
+    heap.set_parallel_marking_thread_count(4);
+    heap.set_concurrent_sweeping_enabled(true);
+
+    auto kept_leaves = allocate_leaves_and_keep_half(heap, 0, leaf_count);
+    s_destroyed_swept_leaf_count = 0;
+    heap.collect_garbage();
+
+    // Allocating while the sweeper may still be busy with the leaves' blocks has to leave those alone.
+    kept_leaves.extend(allocate_leaves_and_keep_half(heap, leaf_count, leaf_count));
+
+    // The next collection waits for the sweeper to be done with the blocks of this one first, and turning concurrent
+    // sweeping off waits for the sweep of the last one.
+    heap.collect_garbage();
+    heap.set_concurrent_sweeping_enabled(false);
+
+    // NOTE: The conservative stack scan may keep a few dead leaves around.
+    auto destroyed_leaf_count = s_destroyed_swept_leaf_count.load();
+    EXPECT(destroyed_leaf_count <= leaf_count);
+    EXPECT(destroyed_leaf_count > leaf_count - 16);
+
+    EXPECT_EQ(kept_leaves.size(), static_cast<size_t>(leaf_count));
+    for (size_t i = 0; i < kept_leaves.size(); ++i) {
+        EXPECT_EQ(kept_leaves[i]->state(), JS::Cell::State::Live);
+        EXPECT_EQ(kept_leaves[i]->value(), static_cast<u32>(i * 2));
+    }
+}
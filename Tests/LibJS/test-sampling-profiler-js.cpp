@@ -0,0 +1,47 @@
+/*
+ * Copyright (c) 2026, agent <agent@local>
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibJS/Bytecode/Interpreter.h>
+#include <LibJS/Runtime/GlobalObject.h>
+#include <LibJS/Runtime/SamplingProfiler.h>
+#include <LibJS/Runtime/VM.h>
+#include <LibJS/Script.h>
+#include <LibTest/TestCase.h>
+
+// Keeps going around a loop in a named function for long enough that the profiler's timer fires many times.
+static constexpr auto source = R"~~~(
+    function spin() {
+        const start = Date.now();
+        let iterations = 0;
+        while (Date.now() - start < 100)
+            ++iterations;
+        return iterations;
+    }
+    spin();
+)~~~"sv;
+
+TEST_CASE(samples_are_taken_while_running_a_loop)
+{
+    auto vm = MUST(JS::VM::create());
+    auto root_execution_context = JS::create_simple_execution_context<JS::GlobalObject>(*vm);
+    auto& realm = *root_execution_context->realm;
+
+    EXPECT_EQ(JS::g_sampling_profiler_count.load(), 0u);
+    vm->start_sampling_profiler(AK::Duration::from_milliseconds(1));
+    EXPECT_EQ(JS::g_sampling_profiler_count.load(), 1u);
+
+    auto script = MUST(JS::Script::parse(source, realm));
+    auto result = vm->bytecode_interpreter().run(script);
+    EXPECT(!result.is_error());
+
+    auto profiler = vm->stop_sampling_profiler();
+    EXPECT(profiler);
+    EXPECT(profiler->sample_count() > 0);
+    EXPECT(profiler->to_folded_stacks().contains("spin"sv));
+
+    profiler = nullptr;
+    EXPECT_EQ(JS::g_sampling_profiler_count.load(), 0u);
+}
@@ -1224,3 +1224,33 @@ TEST_CASE(mismatching_brackets)
         EXPECT_EQ(re.parser_result.error, regex::Error::MismatchingBracket);
     }
 }
+
+TEST_CASE(dfa_prefilter)
+{
+    Array tests {
+        // Pattern, Subject, Expected match offset, Expected length
+        Tuple { "foo\\d+"sv, "xxxxfoobarfoo42"sv, 10u, 5u },
+        Tuple { "(a|b)c"sv, "aaabbbbc"sv, 6u, 2u },
+        Tuple { "[a-z]+@[a-z]+\\.com"sv, "mail me@ x@y.org or at a@b.com"sv, 23u, 7u },
+        Tuple { "x*$"sv, "abxx"sv, 2u, 2u },
+        Tuple { "^ab"sv, "ab ab"sv, 0u, 2u },
+        // Word boundaries are ignored by the DFA, the VM has to reject these positions.
+        Tuple { "\\bcat\\b"sv, "concatenate cat"sv, 12u, 3u },
+        // An empty match at the very end of the subject.
+        Tuple { "$|(a|b)(?:ab)+"sv, "A_A ab"sv, 6u, 0u },
+    };
+
+    for (auto& test : tests) {
+        Regex<ECMA262> re(test.get<0>(), ECMAScriptFlags::Global);
+        EXPECT(re.parser_result.optimization_data.can_use_dfa);
+        auto result = re.match(test.get<1>());
+        EXPECT(result.success);
+        EXPECT_EQ(result.matches.first().global_offset, test.get<2>());
+        EXPECT_EQ(result.matches.first().view.length(), test.get<3>());
+    }
+
+    {
+        Regex<ECMA262> re("(a)\\1"sv);
+        EXPECT(!re.parser_result.optimization_data.can_use_dfa);
+    }
+}
@@ -1499,6 +1499,14 @@ void ScopeNode::add_hoisted_function(NonnullRefPtr<FunctionDeclaration const> de
     m_functions_hoistable_with_annexB_extension.append(move(declaration));
 }
 
+FunctionBody::~FunctionBody() = default;
+
+void FunctionBody::set_lazy_function_source(NonnullOwnPtr<LazyFunctionSource> lazy_function_source)
+{
+    VERIFY(children().is_empty());
+    m_lazy_function_source = move(lazy_function_source);
+}
+
 DeprecatedFlyString ExportStatement::local_name_for_default = "*default*";
 
 static void dump_assert_clauses(ModuleRequest const& request)
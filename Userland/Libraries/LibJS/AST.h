@@ -554,6 +554,12 @@ public:
 
     ThrowCompletionOr<void> global_declaration_instantiation(VM&, GlobalEnvironment&) const;
 
+    // The function, class and block nodes in top-level code, in the order the parser created them. This order only
+    // depends on the source text, so the bytecode cache uses indices into this list to refer to AST nodes.
+    // Only collected while the bytecode cache is enabled.
+    Vector<NonnullRefPtr<ASTNode const>> const& top_level_code_nodes() const { return m_top_level_code_nodes; }
+    void set_top_level_code_nodes(Vector<NonnullRefPtr<ASTNode const>> nodes) { m_top_level_code_nodes = move(nodes); }
+
 private:
     virtual bool is_program() const override { return true; }
 
@@ -562,6 +568,7 @@ private:
 
     Vector<NonnullRefPtr<ImportStatement const>> m_imports;
     Vector<NonnullRefPtr<ExportStatement const>> m_exports;
+    Vector<NonnullRefPtr<ASTNode const>> m_top_level_code_nodes;
     bool m_has_top_level_await { false };
 };
 
@@ -573,6 +580,8 @@ public:
     }
 };
 
+struct LazyFunctionSource;
+
 class FunctionBody final : public ScopeNode {
 public:
     explicit FunctionBody(SourceRange source_range)
@@ -580,12 +589,24 @@ public:
     {
     }
 
+    virtual ~FunctionBody() override;
+
     void set_strict_mode() { m_in_strict_mode = true; }
 
     bool in_strict_mode() const { return m_in_strict_mode; }
 
+    // Only set on the empty placeholder body of a function that the parser skipped over.
+    LazyFunctionSource const* lazy_function_source() const { return m_lazy_function_source; }
+    void set_lazy_function_source(NonnullOwnPtr<LazyFunctionSource>);
+
+    // Like Program::top_level_code_nodes(), but for the code of this function, including its parameter list.
+    Vector<NonnullRefPtr<ASTNode const>> const& top_level_code_nodes() const { return m_top_level_code_nodes; }
+    void set_top_level_code_nodes(Vector<NonnullRefPtr<ASTNode const>> nodes) { m_top_level_code_nodes = move(nodes); }
+
 private:
     bool m_in_strict_mode { false };
+    OwnPtr<LazyFunctionSource> m_lazy_function_source;
+    Vector<NonnullRefPtr<ASTNode const>> m_top_level_code_nodes;
 };
 
 class Expression : public ASTNode {
@@ -813,6 +834,20 @@ private:
     virtual bool is_function_expression() const override { return true; }
 };
 
+// Everything needed to parse a function whose body was skipped over when the code around it was parsed,
+// see g_lazy_function_parsing. The function is parsed on its own the first time it is called.
+struct LazyFunctionSource {
+    // The function is lexed from the text of source_code, which is what keeps it alive.
+    NonnullRefPtr<SourceCode const> source_code;
+    Position function_start;
+    size_t function_end_offset { 0 };
+    Program::Type program_type { Program::Type::Script };
+    bool strict_mode { false };
+
+    // Filled in on first call, and shared by every function object created from the same function node.
+    mutable RefPtr<FunctionExpression const> parsed_function;
+};
+
 class ErrorExpression final : public Expression {
 public:
     explicit ErrorExpression(SourceRange source_range)
@@ -1438,6 +1473,7 @@ public:
 
     ByteString const& source_text() const { return m_source_text; }
     RefPtr<FunctionExpression const> constructor() const { return m_constructor; }
+    Vector<NonnullRefPtr<ClassElement const>> const& elements() const { return m_elements; }
 
     virtual void dump(int indent) const override;
     virtual Bytecode::CodeGenerationErrorOr<Optional<Bytecode::ScopedOperand>> generate_bytecode(Bytecode::Generator&, Optional<Bytecode::ScopedOperand> preferred_dst = {}) const override;
@@ -44,6 +44,15 @@ public:
 
     void grow(size_t additional_size);
 
+    // Takes ownership of a rewritten instruction stream. Instructions that were not carried over into it must already
+    // have been destroyed.
+    void set_instruction_stream(Vector<u8>&& buffer, HashMap<size_t, SourceRecord>&& source_map, size_t last_instruction_start_offset)
+    {
+        m_buffer = move(buffer);
+        m_source_map = move(source_map);
+        m_last_instruction_start_offset = last_instruction_start_offset;
+    }
+
     void terminate(Badge<Generator>) { m_terminated = true; }
     bool is_terminated() const { return m_terminated; }
 
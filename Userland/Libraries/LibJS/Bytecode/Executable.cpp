@@ -4,10 +4,14 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/AnyOf.h>
 #include <LibJS/Bytecode/BasicBlock.h>
 #include <LibJS/Bytecode/Executable.h>
 #include <LibJS/Bytecode/Instruction.h>
+#include <LibJS/Bytecode/Interpreter.h>
+#include <LibJS/Bytecode/Op.h>
 #include <LibJS/Bytecode/RegexTable.h>
+#include <LibJS/JIT/NativeExecutable.h>
 #include <LibJS/SourceCode.h>
 
 namespace JS::Bytecode {
@@ -40,6 +44,16 @@ Executable::Executable(
 
 Executable::~Executable() = default;
 
+void Executable::finalize()
+{
+    Base::finalize();
+
+    // NOTE: This is done here rather than in the destructor, since the dump formats operands that refer to our
+    //       constants, and those may be swept before we are. All dead cells are finalized before any are swept.
+    if (g_dump_property_lookup_cache_statistics)
+        dump_property_lookup_cache_statistics();
+}
+
 void Executable::dump() const
 {
     warnln("\033[37;1mJS bytecode executable\033[0m \"{}\"", name);
@@ -83,6 +97,63 @@ void Executable::dump() const
     warnln("");
 }
 
+static Optional<u32> property_lookup_cache_index(Instruction const& instruction)
+{
+    switch (instruction.type()) {
+    case Instruction::Type::GetById:
+        return static_cast<Op::GetById const&>(instruction).cache_index();
+    case Instruction::Type::GetByIdWithThis:
+        return static_cast<Op::GetByIdWithThis const&>(instruction).cache_index();
+    case Instruction::Type::GetLength:
+        return static_cast<Op::GetLength const&>(instruction).cache_index();
+    case Instruction::Type::GetLengthWithThis:
+        return static_cast<Op::GetLengthWithThis const&>(instruction).cache_index();
+    case Instruction::Type::PutById:
+        return static_cast<Op::PutById const&>(instruction).cache_index();
+    case Instruction::Type::PutByIdWithThis:
+        return static_cast<Op::PutByIdWithThis const&>(instruction).cache_index();
+    default:
+        return {};
+    }
+}
+
+void Executable::dump_property_lookup_cache_statistics() const
+{
+    bool has_statistics = any_of(property_lookup_caches, [](auto& cache) { return cache.hit_count || cache.miss_count; });
+    if (!has_statistics)
+        return;
+
+    warnln("\033[37;1mProperty lookup caches\033[0m \"{}\"", name);
+    for (InstructionStreamIterator it(bytecode, this); !it.at_end(); ++it) {
+        auto cache_index = property_lookup_cache_index(*it);
+        if (!cache_index.has_value())
+            continue;
+        auto const& cache = property_lookup_caches[*cache_index];
+        if (!cache.hit_count && !cache.miss_count)
+            continue;
+
+        StringBuilder builder;
+        builder.appendff("[{:4x}] {:>8} hits {:>8} misses ", it.offset(), cache.hit_count, cache.miss_count);
+        if (cache.is_megamorphic) {
+            builder.append("megamorphic  "sv);
+        } else {
+            size_t shape_count = 0;
+            for (auto const& entry : cache.entries) {
+                if (entry.shape)
+                    ++shape_count;
+            }
+            builder.appendff("{} shape(s)   ", shape_count);
+        }
+        if (auto source_range = source_range_at(it.offset()); source_range.source_code) {
+            auto realized_source_range = source_range.realize();
+            builder.appendff("{}:{}:{} ", realized_source_range.filename(), realized_source_range.start.line, realized_source_range.start.column);
+        }
+        builder.append((*it).to_byte_string(*this));
+        warnln("{}", builder.string_view());
+    }
+    warnln("");
+}
+
 void Executable::visit_edges(Visitor& visitor)
 {
     Base::visit_edges(visitor);
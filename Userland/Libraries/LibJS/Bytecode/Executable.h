@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <AK/Array.h>
 #include <AK/DeprecatedFlyString.h>
 #include <AK/HashMap.h>
 #include <AK/NonnullOwnPtr.h>
@@ -23,13 +24,46 @@
 namespace JS::Bytecode {
 
 struct PropertyLookupCache {
-    WeakPtr<Shape> shape;
-    Optional<u32> property_offset;
-    WeakPtr<Object> prototype;
-    WeakPtr<PrototypeChainValidity> prototype_chain_validity;
+    static constexpr size_t max_number_of_shapes_to_remember = 4;
+
+    struct Entry {
+        WeakPtr<Shape> shape;
+        Optional<u32> property_offset;
+        WeakPtr<Object> prototype;
+        WeakPtr<PrototypeChainValidity> prototype_chain_validity;
+    };
+
+    // Entries whose shape has been garbage collected are reused for new shapes.
+    AK::Array<Entry, max_number_of_shapes_to_remember> entries;
+
+    // Once this site has seen more shapes than it can remember, new shapes go into the interpreter-wide
+    // MegamorphicPropertyLookupCache instead.
+    bool is_megamorphic { false };
+
+    // Profiling counters, see Executable::dump_property_lookup_cache_statistics().
+    u32 hit_count { 0 };
+    u32 miss_count { 0 };
 };
 
-struct GlobalVariableCache : public PropertyLookupCache {
+// A direct-mapped (shape, property name) -> Entry cache shared by all megamorphic property lookup sites.
+class MegamorphicPropertyLookupCache {
+public:
+    struct Slot {
+        DeprecatedFlyString name;
+        PropertyLookupCache::Entry entry;
+    };
+
+    Slot& slot_for(Shape const& shape, DeprecatedFlyString const& name)
+    {
+        return m_slots[pair_int_hash(ptr_hash(&shape), name.hash()) & (number_of_slots - 1)];
+    }
+
+private:
+    static constexpr size_t number_of_slots = 1024;
+    AK::Array<Slot, number_of_slots> m_slots;
+};
+
+struct GlobalVariableCache : public PropertyLookupCache::Entry {
     u64 environment_serial_number { 0 };
     Optional<u32> environment_binding_index;
 };
@@ -88,6 +122,12 @@ public:
 
     Optional<IdentifierTableIndex> length_identifier;
 
+    // Tiering state for the baseline JIT, see JIT::Compiler.
+    u32 invocation_count { 0 };
+    u32 back_edge_count { 0 };
+    bool did_try_to_compile_native_code { false };
+    OwnPtr<JIT::NativeExecutable> native_executable;
+
     ByteString const& get_string(StringTableIndex index) const { return string_table->get(index); }
     DeprecatedFlyString const& get_identifier(IdentifierTableIndex index) const { return identifier_table->get(index); }
 
@@ -103,9 +143,11 @@ public:
     [[nodiscard]] UnrealizedSourceRange source_range_at(size_t offset) const;
 
     void dump() const;
+    void dump_property_lookup_cache_statistics() const;
 
 private:
     virtual void visit_edges(Visitor&) override;
+    virtual void finalize() override;
 };
 
 }
@@ -0,0 +1,877 @@
+/*
+ * Copyright (c) 2026, agent <agent@local>
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Bitmap.h>
+#include <AK/Debug.h>
+#include <AK/Hex.h>
+#include <AK/LexicalPath.h>
+#include <AK/MemoryStream.h>
+#include <LibCore/Directory.h>
+#include <LibCore/File.h>
+#include <LibCore/System.h>
+#include <LibCrypto/Hash/SHA2.h>
+#include <LibJS/AST.h>
+#include <LibJS/Bytecode/Executable.h>
+#include <LibJS/Bytecode/ExecutableCache.h>
+#include <LibJS/Bytecode/Instruction.h>
+#include <LibJS/Bytecode/Op.h>
+#include <LibJS/Bytecode/RegexTable.h>
+#include <LibJS/Heap/MarkedVector.h>
+#include <LibJS/Parser.h>
+#include <LibJS/Runtime/BigInt.h>
+#include <LibJS/Runtime/ECMAScriptFunctionObject.h>
+#include <LibJS/Runtime/PrimitiveString.h>
+#include <LibJS/Runtime/VM.h>
+#include <LibJS/Script.h>
+#include <LibRegex/Regex.h>
+#include <dlfcn.h>
+
+namespace JS::Bytecode {
+
+ByteString g_bytecode_cache_directory;
+
+// Instructions are cached as a copy of their in-memory representation, so an entry can only be used by a build that
+// lays them out in the exact same way. The fingerprint below catches most layout changes, anything else needs a bump
+// of the format version.
+static constexpr u64 cache_entry_magic = 0x3143'4253'4a62'694c; // "LibJSBC1"
+static constexpr u32 cache_format_version = 2;
+
+static constexpr u64 instruction_layout_fingerprint()
+{
+    u64 fingerprint = sizeof(void*);
+#define __BYTECODE_OP(op) \
+    fingerprint = fingerprint * 31 + sizeof(Op::op) * 8 + alignof(Op::op);
+    ENUMERATE_BYTECODE_OPS(__BYTECODE_OP)
+#undef __BYTECODE_OP
+    return fingerprint;
+}
+
+static constexpr u32 instruction_type_count = 0
+#define __BYTECODE_OP(op) +1
+    ENUMERATE_BYTECODE_OPS(__BYTECODE_OP)
+#undef __BYTECODE_OP
+    ;
+
+static size_t fixed_instruction_size(Instruction::Type type)
+{
+#define __BYTECODE_OP(op)       \
+    case Instruction::Type::op: \
+        return sizeof(Op::op);
+
+    switch (type) {
+        ENUMERATE_BYTECODE_OPS(__BYTECODE_OP)
+    default:
+        VERIFY_NOT_REACHED();
+    }
+
+#undef __BYTECODE_OP
+}
+
+static bool is_terminator(Instruction::Type type)
+{
+#define __BYTECODE_OP(op)       \
+    case Instruction::Type::op: \
+        return Op::op::IsTerminator;
+
+    switch (type) {
+        ENUMERATE_BYTECODE_OPS(__BYTECODE_OP)
+    default:
+        VERIFY_NOT_REACHED();
+    }
+
+#undef __BYTECODE_OP
+}
+
+enum class ConstantTag : u8 {
+    Empty,
+    Undefined,
+    Null,
+    Boolean,
+    Int32,
+    Double,
+    String,
+    BigInt,
+};
+
+static constexpr u32 no_offset = NumericLimits<u32>::max();
+
+static FunctionNode const* as_function_node(ASTNode const& node)
+{
+    if (node.is_function_declaration())
+        return &static_cast<FunctionDeclaration const&>(node);
+    if (node.is_function_expression())
+        return &static_cast<FunctionExpression const&>(node);
+    return nullptr;
+}
+
+static ErrorOr<void> write_string(Stream& stream, StringView string)
+{
+    TRY(stream.write_value<u32>(string.length()));
+    TRY(stream.write_until_depleted(string.bytes()));
+    return {};
+}
+
+static ErrorOr<ByteString> read_string(FixedMemoryStream& stream)
+{
+    auto length = TRY(stream.read_value<u32>());
+    if (length > stream.remaining())
+        return AK::Error::from_string_literal("String runs past the end of the cache entry");
+    auto buffer = TRY(ByteBuffer::create_uninitialized(length));
+    TRY(stream.read_until_filled(buffer));
+    return ByteString::copy(buffer);
+}
+
+static ErrorOr<u32> read_count(FixedMemoryStream& stream, size_t minimum_element_size)
+{
+    auto count = TRY(stream.read_value<u32>());
+    if (static_cast<u64>(count) * minimum_element_size > stream.remaining())
+        return AK::Error::from_string_literal("List runs past the end of the cache entry");
+    return count;
+}
+
+static ErrorOr<void> write_constant(Stream& stream, Value value)
+{
+    if (value.is_empty())
+        return stream.write_value(ConstantTag::Empty);
+    if (value.is_undefined())
+        return stream.write_value(ConstantTag::Undefined);
+    if (value.is_null())
+        return stream.write_value(ConstantTag::Null);
+    if (value.is_boolean()) {
+        TRY(stream.write_value(ConstantTag::Boolean));
+        return stream.write_value<u8>(value.as_bool());
+    }
+    if (value.is_int32()) {
+        TRY(stream.write_value(ConstantTag::Int32));
+        return stream.write_value<i32>(value.as_i32());
+    }
+    if (value.is_number()) {
+        // NOTE: Writing the bits makes sure that -0 stays -0.
+        TRY(stream.write_value(ConstantTag::Double));
+        return stream.write_value<u64>(bit_cast<u64>(value.as_double()));
+    }
+    if (value.is_string()) {
+        TRY(stream.write_value(ConstantTag::String));
+        return write_string(stream, value.as_string().byte_string());
+    }
+    if (value.is_bigint()) {
+        TRY(stream.write_value(ConstantTag::BigInt));
+        return write_string(stream, value.as_bigint().big_integer().to_base_deprecated(10));
+    }
+    return AK::Error::from_string_literal("Constant can't be cached");
+}
+
+static ErrorOr<Value> read_constant(VM& vm, FixedMemoryStream& stream)
+{
+    switch (TRY(stream.read_value<ConstantTag>())) {
+    case ConstantTag::Empty:
+        return Value {};
+    case ConstantTag::Undefined:
+        return js_undefined();
+    case ConstantTag::Null:
+        return js_null();
+    case ConstantTag::Boolean:
+        return Value(TRY(stream.read_value<u8>()) != 0);
+    case ConstantTag::Int32:
+        return Value(TRY(stream.read_value<i32>()));
+    case ConstantTag::Double:
+        return Value(bit_cast<double>(TRY(stream.read_value<u64>())));
+    case ConstantTag::String:
+        return PrimitiveString::create(vm, TRY(read_string(stream)));
+    case ConstantTag::BigInt:
+        return BigInt::create(vm, TRY(Crypto::SignedBigInteger::from_base(10, TRY(read_string(stream)))));
+    }
+    return AK::Error::from_string_literal("Unknown constant tag");
+}
+
+static ErrorOr<void> write_offset(Stream& stream, Optional<size_t> offset)
+{
+    return stream.write_value<u32>(offset.has_value() ? *offset : no_offset);
+}
+
+static ErrorOr<Optional<size_t>> read_offset(FixedMemoryStream& stream)
+{
+    auto offset = TRY(stream.read_value<u32>());
+    if (offset == no_offset)
+        return Optional<size_t> {};
+    return Optional<size_t> { offset };
+}
+
+// The code that an executable is generated for: either the top-level code of a script, or the body of a function.
+struct CodeUnit {
+    ByteString path;
+    SourceCode const* source_code { nullptr };
+    Vector<NonnullRefPtr<ASTNode const>> const* nodes { nullptr };
+    Vector<DeprecatedFlyString> const* local_variable_names { nullptr };
+    size_t formal_parameter_count { 0 };
+};
+
+static Optional<CodeUnit> code_unit_for(Program const& program, StringView key)
+{
+    if (key.is_empty() || program.type() != Program::Type::Script)
+        return {};
+
+    return CodeUnit {
+        .path = LexicalPath::join(g_bytecode_cache_directory, ByteString::formatted("{}.jsbc", key)).string(),
+        .source_code = &program.source_code(),
+        .nodes = &program.top_level_code_nodes(),
+        .local_variable_names = &program.local_variables_names(),
+    };
+}
+
+static Optional<CodeUnit> code_unit_for(ECMAScriptFunctionObject const& function)
+{
+    auto const* script = function.script_or_module().get_pointer<NonnullGCPtr<Script>>();
+    if (!script || (*script)->bytecode_cache_key().is_empty())
+        return {};
+
+    // NOTE: Only functions that were parsed along with the script are cached. Functions created by eval() or the
+    //       Function constructor come with source code of their own, so there's nothing to key their entries by.
+    auto const& code = function.ecmascript_code();
+    if (!is<FunctionBody>(code) || &code.source_code() != &(*script)->parse_node().source_code())
+        return {};
+    auto const& body = static_cast<FunctionBody const&>(code);
+
+    auto file_name = ByteString::formatted("{}-{}-{}.jsbc", (*script)->bytecode_cache_key(), body.start_offset(), body.end_offset());
+    return CodeUnit {
+        .path = LexicalPath::join(g_bytecode_cache_directory, file_name).string(),
+        .source_code = &body.source_code(),
+        .nodes = &body.top_level_code_nodes(),
+        .local_variable_names = &function.local_variables_names(),
+        .formal_parameter_count = function.formal_parameters().size(),
+    };
+}
+
+static ErrorOr<ByteBuffer> serialize_executable(Executable const& executable, CodeUnit const& unit)
+{
+    // NOTE: Locals are named by the code unit, so they aren't part of the cache entry.
+    if (executable.local_variable_names != *unit.local_variable_names)
+        return AK::Error::from_string_literal("Executable doesn't use the locals of the code it was generated for");
+
+    HashMap<void const*, u32> node_indices;
+    auto const& nodes = *unit.nodes;
+    for (u32 i = 0; i < nodes.size(); ++i) {
+        if (auto const* function_node = as_function_node(*nodes[i]))
+            node_indices.set(function_node, i);
+        else
+            node_indices.set(nodes[i].ptr(), i);
+    }
+
+    auto index_of_node = [&](void const* node) -> ErrorOr<u32> {
+        auto index = node_indices.get(node);
+        if (!index.has_value())
+            return AK::Error::from_string_literal("Bytecode refers to an AST node outside of the code it was generated for");
+        return *index;
+    };
+    Vector<u32> node_references;
+    for (InstructionStreamIterator it(executable.bytecode); !it.at_end(); ++it) {
+        auto const& instruction = *it;
+        switch (instruction.type()) {
+        case Instruction::Type::NewFunction:
+            node_references.append(TRY(index_of_node(&static_cast<Op::NewFunction const&>(instruction).function_node())));
+            break;
+        case Instruction::Type::NewClass:
+            node_references.append(TRY(index_of_node(&static_cast<Op::NewClass const&>(instruction).class_expression())));
+            break;
+        case Instruction::Type::BlockDeclarationInstantiation:
+            node_references.append(TRY(index_of_node(&static_cast<Op::BlockDeclarationInstantiation const&>(instruction).scope_node())));
+            break;
+        case Instruction::Type::IteratorClose:
+            if (static_cast<Op::IteratorClose const&>(instruction).completion_value().has_value())
+                return AK::Error::from_string_literal("Bytecode contains a completion value");
+            break;
+        case Instruction::Type::AsyncIteratorClose:
+            if (static_cast<Op::AsyncIteratorClose const&>(instruction).completion_value().has_value())
+                return AK::Error::from_string_literal("Bytecode contains a completion value");
+            break;
+        case Instruction::Type::Dump:
+            return AK::Error::from_string_literal("Bytecode contains a Dump instruction");
+        default:
+            break;
+        }
+    }
+
+    AllocatingMemoryStream stream;
+    TRY(stream.write_value(cache_entry_magic));
+    TRY(stream.write_value(cache_format_version));
+    TRY(stream.write_value(instruction_layout_fingerprint()));
+
+    TRY(stream.write_value<u32>(executable.number_of_registers));
+    TRY(stream.write_value<u8>(executable.is_strict_mode));
+    TRY(stream.write_value<u32>(executable.property_lookup_caches.size()));
+    TRY(stream.write_value<u32>(executable.global_variable_caches.size()));
+    TRY(stream.write_value<u32>(executable.local_index_base));
+    TRY(stream.write_value<u32>(executable.length_identifier.has_value() ? executable.length_identifier->value : no_offset));
+
+    TRY(stream.write_value<u32>(executable.identifier_table->identifiers().size()));
+    for (auto const& identifier : executable.identifier_table->identifiers())
+        TRY(write_string(stream, identifier));
+
+    TRY(stream.write_value<u32>(executable.string_table->strings().size()));
+    for (auto const& string : executable.string_table->strings())
+        TRY(write_string(stream, string));
+
+    // NOTE: Only the pattern is cached, the compiled regex is rebuilt from it when loading.
+    TRY(stream.write_value<u32>(executable.regex_table->regexes().size()));
+    for (auto const& regex : executable.regex_table->regexes()) {
+        TRY(write_string(stream, regex.pattern));
+        TRY(stream.write_value<u32>(to_underlying(regex.flags.value())));
+    }
+
+    TRY(stream.write_value<u32>(executable.constants.size()));
+    for (auto constant : executable.constants)
+        TRY(write_constant(stream, constant));
+
+    TRY(stream.write_value<u32>(executable.exception_handlers.size()));
+    for (auto const& handlers : executable.exception_handlers) {
+        TRY(write_offset(stream, handlers.start_offset));
+        TRY(write_offset(stream, handlers.end_offset));
+        TRY(write_offset(stream, handlers.handler_offset));
+        TRY(write_offset(stream, handlers.finalizer_offset));
+    }
+
+    TRY(stream.write_value<u32>(executable.basic_block_start_offsets.size()));
+    for (auto offset : executable.basic_block_start_offsets)
+        TRY(write_offset(stream, offset));
+
+    TRY(stream.write_value<u32>(executable.source_map.size()));
+    for (auto const& [offset, record] : executable.source_map) {
+        TRY(write_offset(stream, offset));
+        TRY(stream.write_value(record.source_start_offset));
+        TRY(stream.write_value(record.source_end_offset));
+    }
+
+    TRY(stream.write_value<u32>(node_references.size()));
+    for (auto index : node_references)
+        TRY(stream.write_value(index));
+
+    TRY(stream.write_value<u32>(executable.bytecode.size()));
+    TRY(stream.write_until_depleted(executable.bytecode.span()));
+
+    return stream.read_until_eof();
+}
+
+// The sizes of everything an instruction can refer to, for checking the instructions of a cache entry.
+struct ExecutableLimits {
+    u32 number_of_registers { 0 };
+    size_t number_of_constants { 0 };
+    u32 local_index_base { 0 };
+    size_t number_of_locals { 0 };
+    size_t number_of_identifiers { 0 };
+    size_t number_of_strings { 0 };
+    size_t number_of_regexes { 0 };
+    u32 number_of_property_lookup_caches { 0 };
+    u32 number_of_global_variable_caches { 0 };
+    size_t number_of_formal_parameters { 0 };
+    size_t source_length { 0 };
+};
+
+static bool is_valid_operand(Operand operand, ExecutableLimits const& limits)
+{
+    auto index = operand.index();
+    switch (operand.type()) {
+    case Operand::Type::Register:
+        return index < limits.number_of_registers;
+    case Operand::Type::Constant:
+        return index >= limits.number_of_registers && index - limits.number_of_registers < limits.number_of_constants;
+    case Operand::Type::Local:
+        return index >= limits.local_index_base && index - limits.local_index_base < limits.number_of_locals;
+    }
+    return false;
+}
+
+// Checks everything an instruction holds apart from its operands and labels. Those are checked through
+// visit_operands() and visit_labels(), which cover all of them, since the generator relies on them for relocation.
+static bool has_valid_fields(Instruction const& instruction, ExecutableLimits const& limits)
+{
+    auto identifier = [&](IdentifierTableIndex index) { return static_cast<size_t>(index.value) < limits.number_of_identifiers; };
+    auto optional_identifier = [&](Optional<IdentifierTableIndex> const& index) { return !index.has_value() || identifier(*index); };
+    auto string = [&](StringTableIndex index) { return index.value() < limits.number_of_strings; };
+    auto optional_string = [&](Optional<StringTableIndex> const& index) { return !index.has_value() || string(*index); };
+    auto property_lookup_cache = [&](u32 index) { return index < limits.number_of_property_lookup_caches; };
+    auto in_range = []<typename Enum>(Enum value, Enum last) { return static_cast<u64>(to_underlying(value)) <= static_cast<u64>(to_underlying(last)); };
+    // NOTE: Entries are written before the executable first runs, so none of the environment caches can be filled in.
+    auto binding = [&](auto const& op) { return identifier(op.identifier()) && !op.cache().is_valid(); };
+
+    switch (instruction.type()) {
+    case Instruction::Type::CreateArguments:
+        return in_range(static_cast<Op::CreateArguments const&>(instruction).kind(), Op::CreateArguments::Kind::Unmapped);
+    case Instruction::Type::NewRegExp: {
+        auto const& op = static_cast<Op::NewRegExp const&>(instruction);
+        return string(op.source_index()) && string(op.flags_index()) && op.regex_index().value() < limits.number_of_regexes;
+    }
+    case Instruction::Type::NewTypeError:
+        return string(static_cast<Op::NewTypeError const&>(instruction).error_string());
+    case Instruction::Type::NewPrimitiveArray:
+        return all_of(static_cast<Op::NewPrimitiveArray const&>(instruction).elements(), [](Value value) { return !value.is_cell(); });
+    case Instruction::Type::AddPrivateName:
+        return identifier(static_cast<Op::AddPrivateName const&>(instruction).name());
+    // NOTE: Every binding needs a name in the source text, so this is a generous bound for how many there can be.
+    case Instruction::Type::CreateLexicalEnvironment:
+        return static_cast<Op::CreateLexicalEnvironment const&>(instruction).capacity() <= limits.source_length;
+    case Instruction::Type::CreateVariableEnvironment:
+        return static_cast<Op::CreateVariableEnvironment const&>(instruction).capacity() <= limits.source_length;
+    case Instruction::Type::CreateVariable: {
+        auto const& op = static_cast<Op::CreateVariable const&>(instruction);
+        return identifier(op.identifier()) && in_range(op.mode(), Op::EnvironmentMode::Var);
+    }
+    case Instruction::Type::InitializeLexicalBinding:
+        return binding(static_cast<Op::InitializeLexicalBinding const&>(instruction));
+    case Instruction::Type::InitializeVariableBinding:
+        return binding(static_cast<Op::InitializeVariableBinding const&>(instruction));
+    case Instruction::Type::SetLexicalBinding:
+        return binding(static_cast<Op::SetLexicalBinding const&>(instruction));
+    case Instruction::Type::SetVariableBinding:
+        return binding(static_cast<Op::SetVariableBinding const&>(instruction));
+    case Instruction::Type::GetCalleeAndThisFromEnvironment:
+        return binding(static_cast<Op::GetCalleeAndThisFromEnvironment const&>(instruction));
+    case Instruction::Type::GetBinding:
+        return binding(static_cast<Op::GetBinding const&>(instruction));
+    case Instruction::Type::TypeofBinding:
+        return binding(static_cast<Op::TypeofBinding const&>(instruction));
+    case Instruction::Type::GetArgument:
+        return static_cast<Op::GetArgument const&>(instruction).index() < limits.number_of_formal_parameters;
+    case Instruction::Type::SetArgument:
+        return static_cast<Op::SetArgument const&>(instruction).index() < limits.number_of_formal_parameters;
+    case Instruction::Type::CreateRestParams:
+        return static_cast<Op::CreateRestParams const&>(instruction).rest_index() < limits.number_of_formal_parameters;
+    case Instruction::Type::GetGlobal: {
+        auto const& op = static_cast<Op::GetGlobal const&>(instruction);
+        return identifier(op.identifier()) && op.cache_index() < limits.number_of_global_variable_caches;
+    }
+    case Instruction::Type::DeleteVariable:
+        return identifier(static_cast<Op::DeleteVariable const&>(instruction).identifier());
+    case Instruction::Type::GetById: {
+        auto const& op = static_cast<Op::GetById const&>(instruction);
+        return identifier(op.property()) && optional_identifier(op.base_identifier()) && property_lookup_cache(op.cache_index());
+    }
+    case Instruction::Type::GetByIdWithThis: {
+        auto const& op = static_cast<Op::GetByIdWithThis const&>(instruction);
+        return identifier(op.property()) && property_lookup_cache(op.cache_index());
+    }
+    case Instruction::Type::GetLength: {
+        auto const& op = static_cast<Op::GetLength const&>(instruction);
+        return optional_identifier(op.base_identifier()) && property_lookup_cache(op.cache_index());
+    }
+    case Instruction::Type::GetLengthWithThis:
+        return property_lookup_cache(static_cast<Op::GetLengthWithThis const&>(instruction).cache_index());
+    case Instruction::Type::GetPrivateById:
+        return identifier(static_cast<Op::GetPrivateById const&>(instruction).property());
+    case Instruction::Type::HasPrivateId:
+        return identifier(static_cast<Op::HasPrivateId const&>(instruction).property());
+    case Instruction::Type::PutById: {
+        auto const& op = static_cast<Op::PutById const&>(instruction);
+        return identifier(op.property()) && in_range(op.kind(), Op::PropertyKind::ProtoSetter) && property_lookup_cache(op.cache_index()) && optional_identifier(op.base_identifier());
+    }
+    case Instruction::Type::PutByIdWithThis: {
+        auto const& op = static_cast<Op::PutByIdWithThis const&>(instruction);
+        return identifier(op.property()) && in_range(op.kind(), Op::PropertyKind::ProtoSetter) && property_lookup_cache(op.cache_index());
+    }
+    case Instruction::Type::PutPrivateById: {
+        auto const& op = static_cast<Op::PutPrivateById const&>(instruction);
+        return identifier(op.property()) && in_range(op.kind(), Op::PropertyKind::ProtoSetter);
+    }
+    case Instruction::Type::DeleteById:
+        return identifier(static_cast<Op::DeleteById const&>(instruction).property());
+    case Instruction::Type::DeleteByIdWithThis:
+        return identifier(static_cast<Op::DeleteByIdWithThis const&>(instruction).property());
+    case Instruction::Type::GetByValue:
+        return optional_identifier(static_cast<Op::GetByValue const&>(instruction).base_identifier());
+    case Instruction::Type::PutByValue: {
+        auto const& op = static_cast<Op::PutByValue const&>(instruction);
+        return in_range(op.kind(), Op::PropertyKind::ProtoSetter) && optional_identifier(op.base_identifier());
+    }
+    case Instruction::Type::PutByValueWithThis:
+        return in_range(static_cast<Op::PutByValueWithThis const&>(instruction).kind(), Op::PropertyKind::ProtoSetter);
+    case Instruction::Type::Call: {
+        auto const& op = static_cast<Op::Call const&>(instruction);
+        return in_range(op.call_type(), Op::CallType::DirectEval)
+            && (!op.builtin().has_value() || to_underlying(*op.builtin()) < to_underlying(Builtin::__Count))
+            && optional_string(op.expression_string());
+    }
+    case Instruction::Type::CallWithArgumentArray: {
+        auto const& op = static_cast<Op::CallWithArgumentArray const&>(instruction);
+        return in_range(op.call_type(), Op::CallType::DirectEval) && optional_string(op.expression_string());
+    }
+    case Instruction::Type::NewClass:
+        return optional_identifier(static_cast<Op::NewClass const&>(instruction).lhs_name());
+    case Instruction::Type::NewFunction:
+        return optional_identifier(static_cast<Op::NewFunction const&>(instruction).lhs_name());
+    case Instruction::Type::GetIterator:
+        return in_range(static_cast<Op::GetIterator const&>(instruction).hint(), IteratorHint::Async);
+    case Instruction::Type::GetMethod:
+        return identifier(static_cast<Op::GetMethod const&>(instruction).property());
+    case Instruction::Type::IteratorClose: {
+        auto const& op = static_cast<Op::IteratorClose const&>(instruction);
+        return in_range(op.completion_type(), Completion::Type::Throw) && !op.completion_value().has_value();
+    }
+    case Instruction::Type::AsyncIteratorClose: {
+        auto const& op = static_cast<Op::AsyncIteratorClose const&>(instruction);
+        return in_range(op.completion_type(), Completion::Type::Throw) && !op.completion_value().has_value();
+    }
+    case Instruction::Type::Dump:
+        return false;
+    default:
+        return true;
+    }
+}
+
+// NOTE: Variable-length instructions compute their length from an element count, which has to be checked before the
+//       length can be, so that it can't overflow.
+static size_t element_count(Instruction const& instruction)
+{
+    switch (instruction.type()) {
+    case Instruction::Type::CopyObjectExcludingProperties:
+        return static_cast<Op::CopyObjectExcludingProperties const&>(instruction).excluded_names_count();
+    case Instruction::Type::NewArray:
+        return static_cast<Op::NewArray const&>(instruction).element_count();
+    case Instruction::Type::NewPrimitiveArray:
+        return static_cast<Op::NewPrimitiveArray const&>(instruction).elements().size();
+    case Instruction::Type::Call:
+        return static_cast<Op::Call const&>(instruction).argument_count();
+    case Instruction::Type::NewClass:
+        return static_cast<Op::NewClass const&>(instruction).element_keys_count();
+    default:
+        return 0;
+    }
+}
+
+static ErrorOr<NonnullGCPtr<Executable>> deserialize_executable(VM& vm, ReadonlyBytes data, CodeUnit const& unit)
+{
+    FixedMemoryStream stream { data };
+
+    if (TRY(stream.read_value<u64>()) != cache_entry_magic)
+        return AK::Error::from_string_literal("Not a bytecode cache entry");
+    if (TRY(stream.read_value<u32>()) != cache_format_version || TRY(stream.read_value<u64>()) != instruction_layout_fingerprint())
+        return AK::Error::from_string_literal("Bytecode cache entry was written by a different build");
+
+    auto number_of_registers = TRY(stream.read_value<u32>());
+    auto is_strict_mode = TRY(stream.read_value<u8>()) != 0;
+    auto number_of_property_lookup_caches = TRY(stream.read_value<u32>());
+    auto number_of_global_variable_caches = TRY(stream.read_value<u32>());
+    auto local_index_base = TRY(stream.read_value<u32>());
+    auto length_identifier = TRY(stream.read_value<u32>());
+
+    auto identifier_table = make<IdentifierTable>();
+    for (auto count = TRY(read_count(stream, sizeof(u32))); count > 0; --count)
+        identifier_table->insert(TRY(read_string(stream)));
+    if (length_identifier != no_offset && length_identifier >= identifier_table->identifiers().size())
+        return AK::Error::from_string_literal("Length identifier is out of range");
+
+    auto string_table = make<StringTable>();
+    for (auto count = TRY(read_count(stream, sizeof(u32))); count > 0; --count)
+        string_table->insert(TRY(read_string(stream)));
+
+    auto regex_table = make<RegexTable>();
+    for (auto count = TRY(read_count(stream, 2 * sizeof(u32))); count > 0; --count) {
+        auto pattern = TRY(read_string(stream));
+        regex::RegexOptions<ECMAScriptFlags> flags { static_cast<ECMAScriptFlags>(TRY(stream.read_value<u32>())) };
+        auto regex = Regex<ECMA262>::parse_pattern(pattern, flags);
+        if (regex.error != regex::Error::NoError)
+            return AK::Error::from_string_literal("Cached regex failed to parse");
+        regex_table->insert({ move(regex), move(pattern), flags });
+    }
+
+    MarkedVector<Value> constants(vm.heap());
+    for (auto count = TRY(read_count(stream, sizeof(ConstantTag))); count > 0; --count)
+        constants.append(TRY(read_constant(vm, stream)));
+
+    // NOTE: The bytecode comes last, so offsets into it are checked once we have it.
+    Vector<Executable::ExceptionHandlers> exception_handlers;
+    for (auto count = TRY(read_count(stream, 4 * sizeof(u32))); count > 0; --count) {
+        auto start_offset = TRY(read_offset(stream));
+        auto end_offset = TRY(read_offset(stream));
+        if (!start_offset.has_value() || !end_offset.has_value())
+            return AK::Error::from_string_literal("Exception handler is missing its range");
+        auto handler_offset = TRY(read_offset(stream));
+        auto finalizer_offset = TRY(read_offset(stream));
+        exception_handlers.append({ *start_offset, *end_offset, handler_offset, finalizer_offset });
+    }
+
+    Vector<size_t> basic_block_start_offsets;
+    for (auto count = TRY(read_count(stream, sizeof(u32))); count > 0; --count)
+        basic_block_start_offsets.append(TRY(stream.read_value<u32>()));
+
+    HashMap<size_t, SourceRecord> source_map;
+    for (auto count = TRY(read_count(stream, 3 * sizeof(u32))); count > 0; --count) {
+        auto offset = TRY(stream.read_value<u32>());
+        SourceRecord record;
+        record.source_start_offset = TRY(stream.read_value<u32>());
+        record.source_end_offset = TRY(stream.read_value<u32>());
+        source_map.set(offset, record);
+    }
+
+    Vector<u32> node_references;
+    for (auto count = TRY(read_count(stream, sizeof(u32))); count > 0; --count)
+        node_references.append(TRY(stream.read_value<u32>()));
+
+    auto bytecode_size = TRY(stream.read_value<u32>());
+    if (bytecode_size == 0 || bytecode_size != stream.remaining())
+        return AK::Error::from_string_literal("Bytecode size doesn't match the cache entry");
+    Vector<u8> bytecode;
+    TRY(bytecode.try_resize(bytecode_size));
+    TRY(stream.read_until_filled(bytecode));
+
+    // NOTE: These are allocated up front when the executable is created. Every register and cache belongs to at least
+    //       one instruction, so there can't be more of them than there are bytes of bytecode.
+    if (number_of_registers < Register::reserved_register_count)
+        return AK::Error::from_string_literal("Executable doesn't have the reserved registers");
+    if (number_of_registers > Register::reserved_register_count + bytecode.size()
+        || number_of_property_lookup_caches > bytecode.size()
+        || number_of_global_variable_caches > bytecode.size())
+        return AK::Error::from_string_literal("Executable has more registers or caches than its bytecode can use");
+
+    if (local_index_base != number_of_registers + constants.size())
+        return AK::Error::from_string_literal("Local index base doesn't match the register and constant counts");
+
+    ExecutableLimits const limits {
+        .number_of_registers = number_of_registers,
+        .number_of_constants = constants.size(),
+        .local_index_base = local_index_base,
+        .number_of_locals = unit.local_variable_names->size(),
+        .number_of_identifiers = identifier_table->identifiers().size(),
+        .number_of_strings = string_table->strings().size(),
+        .number_of_regexes = regex_table->regexes().size(),
+        .number_of_property_lookup_caches = number_of_property_lookup_caches,
+        .number_of_global_variable_caches = number_of_global_variable_caches,
+        .number_of_formal_parameters = unit.formal_parameter_count,
+        .source_length = unit.source_code->code().bytes().size(),
+    };
+
+    // Point the instructions that refer to the AST at the nodes of the code we were just given.
+    auto const& nodes = *unit.nodes;
+    size_t next_node_reference = 0;
+    auto take_node = [&]() -> ErrorOr<ASTNode const*> {
+        if (next_node_reference >= node_references.size())
+            return AK::Error::from_string_literal("Bytecode refers to more AST nodes than were cached");
+        auto index = node_references[next_node_reference++];
+        if (index >= nodes.size())
+            return AK::Error::from_string_literal("AST node index is out of range");
+        return nodes[index].ptr();
+    };
+
+    auto instruction_starts = TRY(Bitmap::create(bytecode.size(), false));
+    Vector<size_t> jump_targets;
+    bool operands_are_valid = true;
+    bool last_instruction_is_terminator = false;
+
+    for (size_t offset = 0; offset < bytecode.size();) {
+        if (offset + sizeof(Instruction) > bytecode.size())
+            return AK::Error::from_string_literal("Instruction runs past the end of the bytecode");
+        auto& instruction = *reinterpret_cast<Instruction*>(bytecode.data() + offset);
+        if (static_cast<u32>(instruction.type()) >= instruction_type_count)
+            return AK::Error::from_string_literal("Unknown instruction type");
+        if (offset + fixed_instruction_size(instruction.type()) > bytecode.size())
+            return AK::Error::from_string_literal("Instruction runs past the end of the bytecode");
+        if (element_count(instruction) > bytecode.size())
+            return AK::Error::from_string_literal("Instruction runs past the end of the bytecode");
+        auto length = instruction.length();
+        if (length < fixed_instruction_size(instruction.type()) || offset + length > bytecode.size())
+            return AK::Error::from_string_literal("Instruction runs past the end of the bytecode");
+
+        instruction_starts.set(offset, true);
+
+        instruction.visit_operands([&](Operand& operand) {
+            if (!is_valid_operand(operand, limits))
+                operands_are_valid = false;
+        });
+        if (!operands_are_valid)
+            return AK::Error::from_string_literal("Instruction has an operand that is out of range");
+        instruction.visit_labels([&](Label& label) {
+            jump_targets.append(label.address());
+        });
+        if (!has_valid_fields(instruction, limits))
+            return AK::Error::from_string_literal("Instruction refers to something that is out of range");
+
+        switch (instruction.type()) {
+        case Instruction::Type::NewFunction: {
+            auto const* function_node = as_function_node(*TRY(take_node()));
+            if (!function_node)
+                return AK::Error::from_string_literal("NewFunction refers to an AST node that isn't a function");
+            static_cast<Op::NewFunction&>(instruction).set_function_node(*function_node);
+            break;
+        }
+        case Instruction::Type::NewClass: {
+            auto const& node = *TRY(take_node());
+            if (!node.is_class_expression())
+                return AK::Error::from_string_literal("NewClass refers to an AST node that isn't a class");
+            auto& new_class = static_cast<Op::NewClass&>(instruction);
+            new_class.set_class_expression(static_cast<ClassExpression const&>(node));
+            if (new_class.element_keys_count() != new_class.class_expression().elements().size())
+                return AK::Error::from_string_literal("NewClass has a different number of element keys than its class has elements");
+            break;
+        }
+        case Instruction::Type::BlockDeclarationInstantiation: {
+            auto const& node = *TRY(take_node());
+            if (!node.is_scope_node())
+                return AK::Error::from_string_literal("BlockDeclarationInstantiation refers to an AST node that isn't a scope");
+            static_cast<Op::BlockDeclarationInstantiation&>(instruction).set_scope_node(static_cast<ScopeNode const&>(node));
+            break;
+        }
+        default:
+            break;
+        }
+
+        last_instruction_is_terminator = is_terminator(instruction.type());
+        offset += length;
+    }
+    if (next_node_reference != node_references.size())
+        return AK::Error::from_string_literal("Bytecode refers to fewer AST nodes than were cached");
+
+    // NOTE: Execution must never run off the end of the bytecode, or start in the middle of an instruction.
+    if (!last_instruction_is_terminator)
+        return AK::Error::from_string_literal("Bytecode doesn't end in a terminator");
+    auto is_instruction_start = [&](size_t offset) { return offset < bytecode.size() && instruction_starts.get(offset); };
+    for (auto target : jump_targets) {
+        if (!is_instruction_start(target))
+            return AK::Error::from_string_literal("Jump target isn't the start of an instruction");
+    }
+    for (auto offset : basic_block_start_offsets) {
+        if (!is_instruction_start(offset))
+            return AK::Error::from_string_literal("Basic block doesn't start at an instruction");
+    }
+    for (auto const& handlers : exception_handlers) {
+        if (handlers.start_offset > handlers.end_offset || handlers.end_offset > bytecode.size())
+            return AK::Error::from_string_literal("Exception handler range is outside of the bytecode");
+        for (auto offset : { handlers.handler_offset, handlers.finalizer_offset }) {
+            if (offset.has_value() && !is_instruction_start(*offset))
+                return AK::Error::from_string_literal("Exception handler doesn't start at an instruction");
+        }
+    }
+
+    auto executable = vm.heap().allocate_without_realm<Executable>(
+        move(bytecode),
+        move(identifier_table),
+        move(string_table),
+        move(regex_table),
+        move(constants),
+        *unit.source_code,
+        number_of_property_lookup_caches,
+        number_of_global_variable_caches,
+        number_of_registers,
+        is_strict_mode);
+
+    executable->exception_handlers = move(exception_handlers);
+    executable->basic_block_start_offsets = move(basic_block_start_offsets);
+    executable->source_map = move(source_map);
+    executable->local_variable_names = *unit.local_variable_names;
+    executable->local_index_base = local_index_base;
+    if (length_identifier != no_offset)
+        executable->length_identifier = IdentifierTableIndex { length_identifier };
+
+    return executable;
+}
+
+// Identifies the binary that LibJS was loaded from by its path, size and modification time. This keeps a build from
+// loading entries written by another one, which may interpret the same bytes differently without changing the layout
+// of any instruction. It's empty if the binary can't be found, in which case the cache isn't used at all.
+static ByteString const& build_identity()
+{
+    static ByteString const identity = []() -> ByteString {
+        Dl_info info {};
+        if (dladdr(reinterpret_cast<void const*>(&build_identity), &info) == 0 || !info.dli_fname)
+            return {};
+        auto path = StringView { info.dli_fname, strlen(info.dli_fname) };
+        auto stat = Core::System::stat(path);
+        if (stat.is_error())
+            return {};
+        return ByteString::formatted("{}:{}:{}", path, stat.value().st_size, stat.value().st_mtime);
+    }();
+    return identity;
+}
+
+ByteString ExecutableCache::key_for(Program const& program)
+{
+    if (g_bytecode_cache_directory.is_empty() || build_identity().is_empty() || program.type() != Program::Type::Script)
+        return {};
+
+    Crypto::Hash::SHA256 hash;
+    auto format_version = cache_format_version;
+    auto layout_fingerprint = instruction_layout_fingerprint();
+    u8 lazy_function_parsing = g_lazy_function_parsing;
+    hash.update(reinterpret_cast<u8 const*>(&format_version), sizeof(format_version));
+    hash.update(reinterpret_cast<u8 const*>(&layout_fingerprint), sizeof(layout_fingerprint));
+    hash.update(build_identity().bytes());
+    // NOTE: Skipping function bodies changes which nodes the parser creates, and with that, their numbering.
+    hash.update(&lazy_function_parsing, sizeof(lazy_function_parsing));
+    hash.update(program.source_code().code().bytes());
+    return encode_hex(hash.digest().bytes());
+}
+
+static GCPtr<Executable> load_code_unit(VM& vm, CodeUnit const& unit)
+{
+    auto file = Core::File::open(unit.path, Core::File::OpenMode::Read);
+    if (file.is_error())
+        return {};
+    auto data = file.value()->read_until_eof();
+    if (data.is_error())
+        return {};
+
+    auto executable = deserialize_executable(vm, data.value(), unit);
+    if (executable.is_error()) {
+        dbgln_if(JS_BYTECODE_DEBUG, "Ignoring bytecode cache entry {}: {}", unit.path, executable.error());
+        return {};
+    }
+    return executable.release_value();
+}
+
+static void store_code_unit(Executable const& executable, CodeUnit const& unit)
+{
+    auto result = [&]() -> ErrorOr<void> {
+        auto data = TRY(serialize_executable(executable, unit));
+        TRY(Core::Directory::create(g_bytecode_cache_directory, Core::Directory::CreateDirectories::Yes));
+
+        // NOTE: The entry is written to a temporary file that is then moved into place, so that other processes sharing
+        //       the cache never see a partially written entry.
+        auto temporary_path = ByteString::formatted("{}.XXXXXX", unit.path);
+        Vector<char> temporary_path_buffer;
+        TRY(temporary_path_buffer.try_append(temporary_path.characters(), temporary_path.length() + 1));
+        auto fd = TRY(Core::System::mkstemp(temporary_path_buffer));
+        temporary_path = ByteString { temporary_path_buffer.data() };
+
+        auto write_result = [&]() -> ErrorOr<void> {
+            auto file = TRY(Core::File::adopt_fd(fd, Core::File::OpenMode::Write));
+            TRY(file->write_until_depleted(data));
+            return Core::System::rename(temporary_path, unit.path);
+        }();
+        if (write_result.is_error())
+            (void)Core::System::unlink(temporary_path);
+        return write_result;
+    }();
+
+    if (result.is_error())
+        dbgln_if(JS_BYTECODE_DEBUG, "Not caching bytecode for {}: {}", unit.path, result.error());
+}
+
+GCPtr<Executable> ExecutableCache::load(VM& vm, Program const& program, StringView key)
+{
+    auto unit = code_unit_for(program, key);
+    if (!unit.has_value())
+        return {};
+    return load_code_unit(vm, *unit);
+}
+
+void ExecutableCache::store(Program const& program, Executable const& executable, StringView key)
+{
+    if (auto unit = code_unit_for(program, key); unit.has_value())
+        store_code_unit(executable, *unit);
+}
+
+GCPtr<Executable> ExecutableCache::load(VM& vm, ECMAScriptFunctionObject const& function)
+{
+    auto unit = code_unit_for(function);
+    if (!unit.has_value())
+        return {};
+    return load_code_unit(vm, *unit);
+}
+
+void ExecutableCache::store(ECMAScriptFunctionObject const& function, Executable const& executable)
+{
+    if (auto unit = code_unit_for(function); unit.has_value())
+        store_code_unit(executable, *unit);
+}
+
+}
@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) 2026, agent <agent@local>
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/ByteString.h>
+#include <LibJS/Forward.h>
+#include <LibJS/Heap/GCPtr.h>
+
+namespace JS::Bytecode {
+
+// Where to keep the bytecode cache. The cache is disabled if this is empty.
+extern ByteString g_bytecode_cache_directory;
+
+// Keeps bytecode on disk, so that code that has been run before doesn't need to go through bytecode generation again.
+// There is an entry for the top-level code of each script, keyed by a hash of its source text, and one for each of
+// the functions in it that were called, keyed by that hash and the position of the function in the source text.
+//
+// Scripts are still parsed as usual, since declaration instantiation and the functions and classes created by the
+// bytecode work on the AST. Cached bytecode refers to AST nodes by their position in the top_level_code_nodes() of the
+// Program or FunctionBody it was generated for.
+//
+// NOTE: Entries are keyed by the identity of the LibJS binary, so that only the build that wrote an entry uses it.
+//       Before an entry is used, every operand, table index, cache index and jump target of every instruction in it is
+//       checked against the executable it comes with, so a corrupted entry is rejected instead of being run.
+class ExecutableCache {
+public:
+    // Returns an empty key if the cache is disabled.
+    static ByteString key_for(Program const&);
+
+    static GCPtr<Executable> load(VM&, Program const&, StringView key);
+    static void store(Program const&, Executable const&, StringView key);
+
+    static GCPtr<Executable> load(VM&, ECMAScriptFunctionObject const&);
+    static void store(ECMAScriptFunctionObject const&, Executable const&);
+};
+
+}
+
@@ -11,6 +11,7 @@
 #include <LibJS/Bytecode/Generator.h>
 #include <LibJS/Bytecode/Instruction.h>
 #include <LibJS/Bytecode/Op.h>
+#include <LibJS/Bytecode/PassManager.h>
 #include <LibJS/Bytecode/Register.h>
 #include <LibJS/Runtime/ECMAScriptFunctionObject.h>
 #include <LibJS/Runtime/VM.h>
@@ -251,6 +252,12 @@ CodeGenerationErrorOr<NonnullGCPtr<Executable>> Generator::compile(VM& vm, ASTNo
     else if (is<FunctionDeclaration>(node))
         is_strict_mode = static_cast<FunctionDeclaration const&>(node).is_strict_mode();
 
+    if (is_any_optimization_pass_enabled()) {
+        PassPipelineExecutable pipeline_executable { generator, generator.m_root_basic_blocks, generator.m_next_register };
+        auto pipeline = PassManager::create_optimization_pipeline();
+        pipeline.perform(pipeline_executable);
+    }
+
     size_t size_needed = 0;
     for (auto& block : generator.m_root_basic_blocks) {
         size_needed += block->size();
@@ -328,10 +328,10 @@ public:
     };
     [[nodiscard]] ScopedOperand add_constant(Value);
 
-    [[nodiscard]] Value get_constant(ScopedOperand const& operand) const
+    [[nodiscard]] Value get_constant(Operand const& operand) const
     {
-        VERIFY(operand.operand().is_constant());
-        return m_constants[operand.operand().index()];
+        VERIFY(operand.is_constant());
+        return m_constants[operand.index()];
     }
 
     UnwindContext const* current_unwind_context() const { return m_current_unwind_context; }
@@ -9,11 +9,13 @@
 #include <AK/TemporaryChange.h>
 #include <LibJS/AST.h>
 #include <LibJS/Bytecode/BasicBlock.h>
+#include <LibJS/Bytecode/ExecutableCache.h>
 #include <LibJS/Bytecode/Generator.h>
 #include <LibJS/Bytecode/Instruction.h>
 #include <LibJS/Bytecode/Interpreter.h>
 #include <LibJS/Bytecode/Label.h>
 #include <LibJS/Bytecode/Op.h>
+#include <LibJS/JIT/Compiler.h>
 #include <LibJS/Runtime/AbstractOperations.h>
 #include <LibJS/Runtime/Array.h>
 #include <LibJS/Runtime/BigInt.h>
@@ -29,7 +31,9 @@
 #include <LibJS/Runtime/ObjectEnvironment.h>
 #include <LibJS/Runtime/Realm.h>
 #include <LibJS/Runtime/Reference.h>
+#include <LibJS/Runtime/RegExpCache.h>
 #include <LibJS/Runtime/RegExpObject.h>
+#include <LibJS/Runtime/SamplingProfiler.h>
 #include <LibJS/Runtime/TypedArray.h>
 #include <LibJS/Runtime/Value.h>
 #include <LibJS/Runtime/ValueInlines.h>
@@ -38,6 +42,7 @@
 namespace JS::Bytecode {
 
 bool g_dump_bytecode = false;
+bool g_dump_property_lookup_cache_statistics = false;
 
 static ByteString format_operand(StringView name, Operand operand, Bytecode::Executable const& executable)
 {
@@ -229,7 +234,14 @@ ThrowCompletionOr<Value> Interpreter::run(Script& script_record, JS::GCPtr<Envir
 
     // 13. If result.[[Type]] is normal, then
     if (result.type() == Completion::Type::Normal) {
-        auto executable_result = JS::Bytecode::Generator::generate_from_ast_node(vm, script, {});
+        auto executable_result = [&]() -> CodeGenerationErrorOr<NonnullGCPtr<Executable>> {
+            if (auto cached_executable = script_record.take_cached_executable())
+                return NonnullGCPtr { *cached_executable };
+            auto executable = TRY(JS::Bytecode::Generator::generate_from_ast_node(vm, script, {}));
+            // NOTE: This has to happen before the executable runs and starts filling in its inline caches.
+            ExecutableCache::store(script, *executable, script_record.bytecode_cache_key());
+            return executable;
+        }();
 
         if (executable_result.is_error()) {
             if (auto error_string = executable_result.error().to_string(); error_string.is_error())
@@ -331,6 +343,34 @@ Interpreter::HandleExceptionResponse Interpreter::handle_exception(size_t& progr
     VERIFY_NOT_REACHED();
 }
 
+void Interpreter::take_sample_if_requested()
+{
+    if (auto* profiler = vm().sampling_profiler(); profiler && profiler->should_take_sample())
+        profiler->take_sample();
+}
+
+bool Interpreter::run_native_code_if_hot(size_t& program_counter, u32& hotness_counter)
+{
+    auto& executable = current_executable();
+    if (!executable.native_executable) {
+        if (executable.did_try_to_compile_native_code || ++hotness_counter < JIT::g_jit_threshold)
+            return false;
+        executable.did_try_to_compile_native_code = true;
+        executable.native_executable = JIT::Compiler::compile(executable);
+        if (!executable.native_executable)
+            return false;
+    }
+
+    auto exit = executable.native_executable->run(*this, m_registers_and_constants_and_locals.data(), m_arguments.data(), program_counter);
+    if (!exit.has_value())
+        return false;
+
+    program_counter = exit->program_counter;
+    if (exit->kind == JIT::NativeExecutable::ExitKind::Threw)
+        return handle_exception(program_counter, reg(Register::exception())) == HandleExceptionResponse::ExitFromExecutable;
+    return false;
+}
+
 // FIXME: GCC takes a *long* time to compile with flattening, and it will time out our CI. :|
 #if defined(AK_COMPILER_CLANG)
 #    define FLATTEN_ON_CLANG FLATTEN
@@ -355,6 +395,14 @@ FLATTEN_ON_CLANG void Interpreter::run_bytecode(size_t entry_point)
 
     TemporaryChange change(m_program_counter, Optional<size_t&>(program_counter));
 
+    if (g_sampling_profiler_count.load(AK::MemoryOrder::memory_order_relaxed) != 0) [[unlikely]]
+        take_sample_if_requested();
+
+    if (JIT::g_jit_enabled) [[unlikely]] {
+        if (run_native_code_if_hot(program_counter, executable.invocation_count))
+            return;
+    }
+
     // Declare a lookup table for computed goto with each of the `handle_*` labels
     // to avoid the overhead of a switch statement.
     // This is a GCC extension, but it's also supported by Clang.
@@ -365,6 +413,24 @@ FLATTEN_ON_CLANG void Interpreter::run_bytecode(size_t entry_point)
     };
 #undef SET_UP_LABEL
 
+// NOTE: Loops spend their time going around backward jumps, so that's where we count towards, and enter, native code.
+//       It's also where we take profiler samples, as together with function entry, no code can run for long without
+//       passing through one.
+#define JUMP_TO(target_address)                                                                                    \
+    do {                                                                                                           \
+        auto target = (target_address);                                                                            \
+        if (target <= program_counter) [[unlikely]] {                                                              \
+            program_counter = target;                                                                              \
+            if (g_sampling_profiler_count.load(AK::MemoryOrder::memory_order_relaxed) != 0) [[unlikely]]           \
+                take_sample_if_requested();                                                                        \
+            if (JIT::g_jit_enabled && run_native_code_if_hot(program_counter, executable.back_edge_count))         \
+                return;                                                                                            \
+            goto start;                                                                                            \
+        }                                                                                                          \
+        program_counter = target;                                                                                  \
+        goto start;                                                                                                \
+    } while (0)
+
 #define DISPATCH_NEXT(name)                                                                         \
     do {                                                                                            \
         if constexpr (Op::name::IsVariableLength)                                                   \
@@ -406,34 +472,27 @@ FLATTEN_ON_CLANG void Interpreter::run_bytecode(size_t entry_point)
 
         handle_Jump: {
             auto& instruction = *reinterpret_cast<Op::Jump const*>(&bytecode[program_counter]);
-            program_counter = instruction.target().address();
-            goto start;
+            JUMP_TO(instruction.target().address());
         }
 
         handle_JumpIf: {
             auto& instruction = *reinterpret_cast<Op::JumpIf const*>(&bytecode[program_counter]);
             if (get(instruction.condition()).to_boolean())
-                program_counter = instruction.true_target().address();
-            else
-                program_counter = instruction.false_target().address();
-            goto start;
+                JUMP_TO(instruction.true_target().address());
+            JUMP_TO(instruction.false_target().address());
         }
 
         handle_JumpTrue: {
             auto& instruction = *reinterpret_cast<Op::JumpTrue const*>(&bytecode[program_counter]);
-            if (get(instruction.condition()).to_boolean()) {
-                program_counter = instruction.target().address();
-                goto start;
-            }
+            if (get(instruction.condition()).to_boolean())
+                JUMP_TO(instruction.target().address());
             DISPATCH_NEXT(JumpTrue);
         }
 
         handle_JumpFalse: {
             auto& instruction = *reinterpret_cast<Op::JumpFalse const*>(&bytecode[program_counter]);
-            if (!get(instruction.condition()).to_boolean()) {
-                program_counter = instruction.target().address();
-                goto start;
-            }
+            if (!get(instruction.condition()).to_boolean())
+                JUMP_TO(instruction.target().address());
             DISPATCH_NEXT(JumpFalse);
         }
 
@@ -459,8 +518,7 @@ FLATTEN_ON_CLANG void Interpreter::run_bytecode(size_t entry_point)
             } else {                                                                                                    \
                 result = lhs.as_double() numeric_operator rhs.as_double();                                              \
             }                                                                                                           \
-            program_counter = result ? instruction.true_target().address() : instruction.false_target().address();      \
-            goto start;                                                                                                 \
+            JUMP_TO(result ? instruction.true_target().address() : instruction.false_target().address());              \
         }                                                                                                               \
         auto result = op_snake_case(vm(), get(instruction.lhs()), get(instruction.rhs()));                              \
         if (result.is_error()) {                                                                                        \
@@ -468,11 +526,8 @@ FLATTEN_ON_CLANG void Interpreter::run_bytecode(size_t entry_point)
                 return;                                                                                                 \
             goto start;                                                                                                 \
         }                                                                                                               \
-        if (result.value().to_boolean())                                                                                \
-            program_counter = instruction.true_target().address();                                                      \
-        else                                                                                                            \
-            program_counter = instruction.false_target().address();                                                     \
-        goto start;                                                                                                     \
+        JUMP_TO(result.value().to_boolean() ? instruction.true_target().address()                                       \
+                                            : instruction.false_target().address());                                    \
     }
 
             JS_ENUMERATE_COMPARISON_OPS(HANDLE_COMPARISON_OP)
@@ -708,12 +763,11 @@ Interpreter::ResultAndReturnRegister Interpreter::run_executable(Executable& exe
 
     auto& running_execution_context = vm().running_execution_context();
     u32 registers_and_constants_and_locals_count = executable.number_of_registers + executable.constants.size() + executable.local_variable_names.size();
-    if (running_execution_context.registers_and_constants_and_locals.size() < registers_and_constants_and_locals_count)
-        running_execution_context.registers_and_constants_and_locals.resize(registers_and_constants_and_locals_count);
+    running_execution_context.ensure_registers_and_constants_and_locals_count(registers_and_constants_and_locals_count);
 
     TemporaryChange restore_running_execution_context { m_running_execution_context, &running_execution_context };
-    TemporaryChange restore_arguments { m_arguments, running_execution_context.arguments.span() };
-    TemporaryChange restore_registers_and_constants_and_locals { m_registers_and_constants_and_locals, running_execution_context.registers_and_constants_and_locals.span() };
+    TemporaryChange restore_arguments { m_arguments, running_execution_context.arguments };
+    TemporaryChange restore_registers_and_constants_and_locals { m_registers_and_constants_and_locals, running_execution_context.registers_and_constants_and_locals };
 
     reg(Register::accumulator()) = initial_accumulator_value;
     reg(Register::return_value()) = {};
@@ -727,9 +781,7 @@ Interpreter::ResultAndReturnRegister Interpreter::run_executable(Executable& exe
 
     running_execution_context.executable = &executable;
 
-    for (size_t i = 0; i < executable.constants.size(); ++i) {
-        running_execution_context.registers_and_constants_and_locals[executable.number_of_registers + i] = executable.constants[i];
-    }
+    executable.constants.span().copy_to(running_execution_context.registers_and_constants_and_locals.slice(executable.number_of_registers));
 
     run_bytecode(entry_point.value_or(0));
 
@@ -827,7 +879,13 @@ ThrowCompletionOr<NonnullGCPtr<Bytecode::Executable>> compile(VM& vm, ECMAScript
 {
     auto const& name = function.name();
 
-    auto executable_result = Bytecode::Generator::generate_from_function(vm, function);
+    auto executable_result = [&]() -> CodeGenerationErrorOr<NonnullGCPtr<Executable>> {
+        if (auto cached_executable = ExecutableCache::load(vm, function))
+            return NonnullGCPtr { *cached_executable };
+        auto executable = TRY(Bytecode::Generator::generate_from_function(vm, function));
+        ExecutableCache::store(function, *executable);
+        return executable;
+    }();
     if (executable_result.is_error())
         return vm.throw_completion<InternalError>(ErrorType::NotImplemented, TRY_OR_THROW_OOM(vm, executable_result.error().to_string()));
 
@@ -955,6 +1013,54 @@ ALWAYS_INLINE ThrowCompletionOr<NonnullGCPtr<Object>> base_object_for_get(VM& vm
     return throw_null_or_undefined_property_get(vm, base_value, base_identifier, property, executable);
 }
 
+ALWAYS_INLINE Optional<Value> get_from_property_lookup_cache_entry(PropertyLookupCache::Entry const& entry, Object const& base_obj, Shape const& shape)
+{
+    if (&shape != entry.shape)
+        return {};
+    if (entry.prototype) {
+        // OPTIMIZATION: If the prototype chain hasn't been mutated in a way that would invalidate the cache, we can use it.
+        if (!entry.prototype_chain_validity || !entry.prototype_chain_validity->is_valid())
+            return {};
+        return entry.prototype->get_direct(entry.property_offset.value());
+    }
+    // OPTIMIZATION: If the shape of the object hasn't changed, we can use the cached property offset.
+    return base_obj.get_direct(entry.property_offset.value());
+}
+
+// The hit and miss counters are only written when they'll be dumped, so that cache hits don't have to store anything.
+ALWAYS_INLINE void record_property_lookup_cache_hit(PropertyLookupCache& cache)
+{
+    if (g_dump_property_lookup_cache_statistics) [[unlikely]]
+        ++cache.hit_count;
+}
+
+ALWAYS_INLINE void record_property_lookup_cache_miss(PropertyLookupCache& cache)
+{
+    if (g_dump_property_lookup_cache_statistics) [[unlikely]]
+        ++cache.miss_count;
+}
+
+// Picks the entry that already holds this shape (e.g. one whose prototype chain was invalidated), or else a free
+// (or dead) entry in the site's polymorphic cache. When there are none left, the site becomes megamorphic, and the
+// entry is instead taken from the shared megamorphic cache.
+inline PropertyLookupCache::Entry& property_lookup_cache_entry_to_replace(PropertyLookupCache& cache, MegamorphicPropertyLookupCache& megamorphic_cache, Shape const& shape, DeprecatedFlyString const& name)
+{
+    if (!cache.is_megamorphic) {
+        for (auto& entry : cache.entries) {
+            if (entry.shape == &shape)
+                return entry;
+        }
+        for (auto& entry : cache.entries) {
+            if (!entry.shape)
+                return entry;
+        }
+        cache.is_megamorphic = true;
+    }
+    auto& slot = megamorphic_cache.slot_for(shape, name);
+    slot.name = name;
+    return slot.entry;
+}
+
 enum class GetByIdMode {
     Normal,
     Length,
@@ -965,7 +1071,7 @@ inline ThrowCompletionOr<Value> get_by_id(VM& vm, Optional<IdentifierTableIndex>
 {
     if constexpr (mode == GetByIdMode::Length) {
         if (base_value.is_string()) {
-            return Value(base_value.as_string().utf16_string().length_in_code_units());
+            return Value(base_value.as_string().length_in_utf16_code_units());
         }
     }
 
@@ -980,37 +1086,43 @@ inline ThrowCompletionOr<Value> get_by_id(VM& vm, Optional<IdentifierTableIndex>
 
     auto& shape = base_obj->shape();
 
-    if (cache.prototype) {
-        // OPTIMIZATION: If the prototype chain hasn't been mutated in a way that would invalidate the cache, we can use it.
-        bool can_use_cache = [&]() -> bool {
-            if (&shape != cache.shape)
-                return false;
-            if (!cache.prototype_chain_validity)
-                return false;
-            if (!cache.prototype_chain_validity->is_valid())
-                return false;
-            return true;
-        }();
-        if (can_use_cache)
-            return cache.prototype->get_direct(cache.property_offset.value());
-    } else if (&shape == cache.shape) {
-        // OPTIMIZATION: If the shape of the object hasn't changed, we can use the cached property offset.
-        return base_obj->get_direct(cache.property_offset.value());
+    for (auto const& entry : cache.entries) {
+        if (auto value = get_from_property_lookup_cache_entry(entry, base_obj, shape); value.has_value()) {
+            record_property_lookup_cache_hit(cache);
+            return *value;
+        }
+    }
+
+    auto& name = executable.get_identifier(property);
+    auto& megamorphic_cache = vm.bytecode_interpreter().megamorphic_get_by_id_cache();
+
+    if (cache.is_megamorphic) {
+        auto& slot = megamorphic_cache.slot_for(shape, name);
+        if (slot.name == name) {
+            if (auto value = get_from_property_lookup_cache_entry(slot.entry, base_obj, shape); value.has_value()) {
+                record_property_lookup_cache_hit(cache);
+                return *value;
+            }
+        }
     }
 
+    record_property_lookup_cache_miss(cache);
+
     CacheablePropertyMetadata cacheable_metadata;
-    auto value = TRY(base_obj->internal_get(executable.get_identifier(property), this_value, &cacheable_metadata));
+    auto value = TRY(base_obj->internal_get(name, this_value, &cacheable_metadata));
 
     if (cacheable_metadata.type == CacheablePropertyMetadata::Type::OwnProperty) {
-        cache = {};
-        cache.shape = shape;
-        cache.property_offset = cacheable_metadata.property_offset.value();
+        auto& entry = property_lookup_cache_entry_to_replace(cache, megamorphic_cache, shape, name);
+        entry = {};
+        entry.shape = shape;
+        entry.property_offset = cacheable_metadata.property_offset.value();
     } else if (cacheable_metadata.type == CacheablePropertyMetadata::Type::InPrototypeChain) {
-        cache = {};
-        cache.shape = &base_obj->shape();
-        cache.property_offset = cacheable_metadata.property_offset.value();
-        cache.prototype = *cacheable_metadata.prototype;
-        cache.prototype_chain_validity = *cacheable_metadata.prototype->shape().prototype_chain_validity();
+        auto& entry = property_lookup_cache_entry_to_replace(cache, megamorphic_cache, base_obj->shape(), name);
+        entry = {};
+        entry.shape = &base_obj->shape();
+        entry.property_offset = cacheable_metadata.property_offset.value();
+        entry.prototype = *cacheable_metadata.prototype;
+        entry.prototype_chain_validity = *cacheable_metadata.prototype->shape().prototype_chain_validity();
     }
 
     return value;
@@ -1177,17 +1289,34 @@ inline ThrowCompletionOr<void> put_by_property_key(VM& vm, Value base, Value thi
         break;
     }
     case Op::PropertyKind::KeyValue: {
-        if (cache && cache->shape == &object->shape()) {
-            object->put_direct(*cache->property_offset, value);
-            return {};
+        if (cache) {
+            auto& shape = object->shape();
+            for (auto const& entry : cache->entries) {
+                if (&shape == entry.shape) {
+                    record_property_lookup_cache_hit(*cache);
+                    object->put_direct(*entry.property_offset, value);
+                    return {};
+                }
+            }
+            if (cache->is_megamorphic && name.is_string()) {
+                auto& slot = vm.bytecode_interpreter().megamorphic_put_by_id_cache().slot_for(shape, name.as_string());
+                if (slot.name == name.as_string() && &shape == slot.entry.shape) {
+                    record_property_lookup_cache_hit(*cache);
+                    object->put_direct(*slot.entry.property_offset, value);
+                    return {};
+                }
+            }
+            record_property_lookup_cache_miss(*cache);
         }
 
         CacheablePropertyMetadata cacheable_metadata;
         bool succeeded = TRY(object->internal_set(name, value, this_value, &cacheable_metadata));
 
-        if (succeeded && cache && cacheable_metadata.type == CacheablePropertyMetadata::Type::OwnProperty) {
-            cache->shape = object->shape();
-            cache->property_offset = cacheable_metadata.property_offset.value();
+        if (succeeded && cache && name.is_string() && cacheable_metadata.type == CacheablePropertyMetadata::Type::OwnProperty) {
+            auto& entry = property_lookup_cache_entry_to_replace(*cache, vm.bytecode_interpreter().megamorphic_put_by_id_cache(), object->shape(), name.as_string());
+            entry = {};
+            entry.shape = object->shape();
+            entry.property_offset = cacheable_metadata.property_offset.value();
         }
 
         if (!succeeded && vm.in_strict_mode()) {
@@ -1290,6 +1419,7 @@ inline ThrowCompletionOr<void> put_by_value(VM& vm, Value base, Optional<Depreca
                 auto existing_value = maybe_value->value;
                 if (!existing_value.is_accessor()) {
                     storage->put(index, value);
+                    write_barrier(object, value);
                     return {};
                 }
             }
@@ -1412,7 +1542,7 @@ inline Value new_regexp(VM& vm, ParsedRegex const& parsed_regex, ByteString cons
 
     // 3. Return ! RegExpCreate(pattern, flags).
     auto& realm = *vm.current_realm();
-    Regex<ECMA262> regex(parsed_regex.regex, parsed_regex.pattern, parsed_regex.flags);
+    auto regex = RegExpCache::the().compile(parsed_regex.regex, parsed_regex.pattern, parsed_regex.flags);
     // NOTE: We bypass RegExpCreate and subsequently RegExpAlloc as an optimization to use the already parsed values.
     auto regexp_object = RegExpObject::create(realm, move(regex), pattern, flags);
     // RegExpAlloc has these two steps from the 'Legacy RegExp features' proposal.
@@ -1608,11 +1738,13 @@ inline ThrowCompletionOr<void> append(VM& vm, Value lhs, Value rhs, bool is_spre
         size_t i = lhs_size;
         TRY(get_iterator_values(vm, rhs, [&i, &lhs_array](Value iterator_value) -> Optional<Completion> {
             lhs_array.indexed_properties().put(i, iterator_value, default_attributes);
+            write_barrier(lhs_array, iterator_value);
             ++i;
             return {};
         }));
     } else {
         lhs_array.indexed_properties().put(lhs_size, rhs, default_attributes);
+        write_barrier(lhs_array, rhs);
     }
 
     return {};
@@ -2566,7 +2698,7 @@ ThrowCompletionOr<void> SuperCallWithArgumentArray::execute_impl(Bytecode::Inter
 void NewFunction::execute_impl(Bytecode::Interpreter& interpreter) const
 {
     auto& vm = interpreter.vm();
-    interpreter.set(dst(), new_function(vm, m_function_node, m_lhs_name, m_home_object));
+    interpreter.set(dst(), new_function(vm, *m_function_node, m_lhs_name, m_home_object));
 }
 
 void Return::execute_impl(Bytecode::Interpreter& interpreter) const
@@ -2858,7 +2990,7 @@ ThrowCompletionOr<void> NewClass::execute_impl(Bytecode::Interpreter& interprete
             element_key = interpreter.get(m_element_keys[i].value());
         element_keys.append(element_key);
     }
-    interpreter.set(dst(), TRY(new_class(interpreter.vm(), super_class, m_class_expression, m_lhs_name, element_keys)));
+    interpreter.set(dst(), TRY(new_class(interpreter.vm(), super_class, *m_class_expression, m_lhs_name, element_keys)));
     return {};
 }
 
@@ -2908,7 +3040,7 @@ void BlockDeclarationInstantiation::execute_impl(Bytecode::Interpreter& interpre
     auto& running_execution_context = interpreter.running_execution_context();
     running_execution_context.saved_lexical_environments.append(old_environment);
     running_execution_context.lexical_environment = new_declarative_environment(*old_environment);
-    m_scope_node.block_declaration_instantiation(vm, running_execution_context.lexical_environment);
+    m_scope_node->block_declaration_instantiation(vm, running_execution_context.lexical_environment);
 }
 
 ByteString Mov::to_byte_string_impl(Bytecode::Executable const& executable) const
@@ -3334,8 +3466,8 @@ ByteString NewFunction::to_byte_string_impl(Bytecode::Executable const& executab
     StringBuilder builder;
     builder.appendff("NewFunction {}",
         format_operand("dst"sv, m_dst, executable));
-    if (m_function_node.has_name())
-        builder.appendff(" name:{}"sv, m_function_node.name());
+    if (m_function_node->has_name())
+        builder.appendff(" name:{}"sv, m_function_node->name());
     if (m_lhs_name.has_value())
         builder.appendff(" lhs_name:{}"sv, executable.get_identifier(m_lhs_name.value()));
     if (m_home_object.has_value())
@@ -3346,7 +3478,7 @@ ByteString NewFunction::to_byte_string_impl(Bytecode::Executable const& executab
 ByteString NewClass::to_byte_string_impl(Bytecode::Executable const& executable) const
 {
     StringBuilder builder;
-    auto name = m_class_expression.name();
+    auto name = m_class_expression->name();
     builder.appendff("NewClass {}",
         format_operand("dst"sv, m_dst, executable));
     if (m_super_class.has_value())
@@ -80,6 +80,9 @@ public:
 
     ExecutionContext& running_execution_context() { return *m_running_execution_context; }
 
+    MegamorphicPropertyLookupCache& megamorphic_get_by_id_cache() { return m_megamorphic_get_by_id_cache; }
+    MegamorphicPropertyLookupCache& megamorphic_put_by_id_cache() { return m_megamorphic_put_by_id_cache; }
+
 private:
     void run_bytecode(size_t entry_point);
 
@@ -89,6 +92,13 @@ private:
     };
     [[nodiscard]] HandleExceptionResponse handle_exception(size_t& program_counter, Value exception);
 
+    // Runs the current executable's native code from `program_counter`, compiling it first if `hotness_counter` has
+    // just reached the JIT threshold. Returns true if execution of the executable ended while in native code.
+    [[nodiscard]] bool run_native_code_if_hot(size_t& program_counter, u32& hotness_counter);
+
+    // Lets the VM's sampling profiler take a sample, if it has one and asked for a sample since the last one.
+    void take_sample_if_requested();
+
     VM& m_vm;
     Optional<size_t> m_scheduled_jump;
     GCPtr<Executable> m_current_executable { nullptr };
@@ -99,9 +109,14 @@ private:
     Span<Value> m_arguments;
     Span<Value> m_registers_and_constants_and_locals;
     ExecutionContext* m_running_execution_context { nullptr };
+
+    // NOTE: Gets and puts have separate caches, as an own property that can be read from may not be writable.
+    MegamorphicPropertyLookupCache m_megamorphic_get_by_id_cache;
+    MegamorphicPropertyLookupCache m_megamorphic_put_by_id_cache;
 };
 
 extern bool g_dump_bytecode;
+extern bool g_dump_property_lookup_cache_statistics;
 
 ThrowCompletionOr<NonnullGCPtr<Bytecode::Executable>> compile(VM&, ASTNode const&, JS::FunctionKind kind, DeprecatedFlyString const& name);
 ThrowCompletionOr<NonnullGCPtr<Bytecode::Executable>> compile(VM&, ECMAScriptFunctionObject const&);
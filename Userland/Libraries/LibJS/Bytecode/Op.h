@@ -48,6 +48,8 @@ public:
         visitor(m_dst);
     }
 
+    u32 rest_index() const { return m_rest_index; }
+
 private:
     Operand m_dst;
     u32 m_rest_index;
@@ -76,6 +78,8 @@ public:
             visitor(m_dst.value());
     }
 
+    Kind kind() const { return m_kind; }
+
 private:
     Optional<Operand> m_dst;
     Kind m_kind;
@@ -416,6 +420,8 @@ public:
     void execute_impl(Bytecode::Interpreter&) const;
     ByteString to_byte_string_impl(Bytecode::Executable const&) const;
 
+    IdentifierTableIndex name() const { return m_name; }
+
 private:
     IdentifierTableIndex m_name;
 };
@@ -550,6 +556,8 @@ public:
     void execute_impl(Bytecode::Interpreter&) const;
     ByteString to_byte_string_impl(Bytecode::Executable const&) const;
 
+    u32 capacity() const { return m_capacity; }
+
 private:
     u32 m_capacity { 0 };
 };
@@ -565,6 +573,8 @@ public:
     void execute_impl(Bytecode::Interpreter&) const;
     ByteString to_byte_string_impl(Bytecode::Executable const&) const;
 
+    u32 capacity() const { return m_capacity; }
+
 private:
     u32 m_capacity { 0 };
 };
@@ -693,6 +703,7 @@ public:
 
     IdentifierTableIndex identifier() const { return m_identifier; }
     Operand src() const { return m_src; }
+    EnvironmentCoordinate const& cache() const { return m_cache; }
 
 private:
     IdentifierTableIndex m_identifier;
@@ -718,6 +729,7 @@ public:
 
     IdentifierTableIndex identifier() const { return m_identifier; }
     Operand src() const { return m_src; }
+    EnvironmentCoordinate const& cache() const { return m_cache; }
 
 private:
     IdentifierTableIndex m_identifier;
@@ -743,6 +755,7 @@ public:
 
     IdentifierTableIndex identifier() const { return m_identifier; }
     Operand src() const { return m_src; }
+    EnvironmentCoordinate const& cache() const { return m_cache; }
 
 private:
     IdentifierTableIndex m_identifier;
@@ -768,6 +781,7 @@ public:
 
     IdentifierTableIndex identifier() const { return m_identifier; }
     Operand src() const { return m_src; }
+    EnvironmentCoordinate const& cache() const { return m_cache; }
 
 private:
     IdentifierTableIndex m_identifier;
@@ -842,6 +856,7 @@ public:
     IdentifierTableIndex identifier() const { return m_identifier; }
     Operand callee() const { return m_callee; }
     Operand this_() const { return m_this_value; }
+    EnvironmentCoordinate const& cache() const { return m_cache; }
 
 private:
     IdentifierTableIndex m_identifier;
@@ -864,6 +879,7 @@ public:
 
     Operand dst() const { return m_dst; }
     IdentifierTableIndex identifier() const { return m_identifier; }
+    EnvironmentCoordinate const& cache() const { return m_cache; }
 
     void visit_operands_impl(Function<void(Operand&)> visitor)
     {
@@ -953,6 +969,7 @@ public:
     Operand base() const { return m_base; }
     IdentifierTableIndex property() const { return m_property; }
     u32 cache_index() const { return m_cache_index; }
+    Optional<IdentifierTableIndex> const& base_identifier() const { return m_base_identifier; }
 
 private:
     Operand m_dst;
@@ -1019,6 +1036,7 @@ public:
     Operand dst() const { return m_dst; }
     Operand base() const { return m_base; }
     u32 cache_index() const { return m_cache_index; }
+    Optional<IdentifierTableIndex> const& base_identifier() const { return m_base_identifier; }
 
 private:
     Operand m_dst;
@@ -1150,6 +1168,7 @@ public:
     Operand src() const { return m_src; }
     PropertyKind kind() const { return m_kind; }
     u32 cache_index() const { return m_cache_index; }
+    Optional<IdentifierTableIndex> const& base_identifier() const { return m_base_identifier; }
 
 private:
     Operand m_base;
@@ -1220,6 +1239,7 @@ public:
     Operand base() const { return m_base; }
     IdentifierTableIndex property() const { return m_property; }
     Operand src() const { return m_src; }
+    PropertyKind kind() const { return m_kind; }
 
 private:
     Operand m_base;
@@ -1311,6 +1331,7 @@ public:
     Operand dst() const { return m_dst; }
     Operand base() const { return m_base; }
     Operand property() const { return m_property; }
+    Optional<IdentifierTableIndex> const& base_identifier() const { return m_base_identifier; }
 
     Optional<DeprecatedFlyString const&> base_identifier(Bytecode::Interpreter const&) const;
 
@@ -1379,6 +1400,7 @@ public:
     Operand property() const { return m_property; }
     Operand src() const { return m_src; }
     PropertyKind kind() const { return m_kind; }
+    Optional<IdentifierTableIndex> const& base_identifier() const { return m_base_identifier; }
 
 private:
     Operand m_base;
@@ -1852,7 +1874,7 @@ public:
         : Instruction(Type::NewClass)
         , m_dst(dst)
         , m_super_class(super_class)
-        , m_class_expression(class_expression)
+        , m_class_expression(&class_expression)
         , m_lhs_name(lhs_name)
         , m_element_keys_count(elements_keys.size())
     {
@@ -1882,13 +1904,17 @@ public:
 
     Operand dst() const { return m_dst; }
     Optional<Operand> const& super_class() const { return m_super_class; }
-    ClassExpression const& class_expression() const { return m_class_expression; }
+    ClassExpression const& class_expression() const { return *m_class_expression; }
     Optional<IdentifierTableIndex> const& lhs_name() const { return m_lhs_name; }
+    size_t element_keys_count() const { return m_element_keys_count; }
+
+    // Used by the bytecode cache to point a loaded instruction at the freshly parsed AST.
+    void set_class_expression(ClassExpression const& class_expression) { m_class_expression = &class_expression; }
 
 private:
     Operand m_dst;
     Optional<Operand> m_super_class;
-    ClassExpression const& m_class_expression;
+    ClassExpression const* m_class_expression { nullptr };
     Optional<IdentifierTableIndex> m_lhs_name;
     size_t m_element_keys_count { 0 };
     Optional<Operand> m_element_keys[];
@@ -1899,7 +1925,7 @@ public:
     explicit NewFunction(Operand dst, FunctionNode const& function_node, Optional<IdentifierTableIndex> lhs_name, Optional<Operand> home_object = {})
         : Instruction(Type::NewFunction)
         , m_dst(dst)
-        , m_function_node(function_node)
+        , m_function_node(&function_node)
         , m_lhs_name(lhs_name)
         , m_home_object(move(home_object))
     {
@@ -1915,13 +1941,16 @@ public:
     }
 
     Operand dst() const { return m_dst; }
-    FunctionNode const& function_node() const { return m_function_node; }
+    FunctionNode const& function_node() const { return *m_function_node; }
     Optional<IdentifierTableIndex> const& lhs_name() const { return m_lhs_name; }
     Optional<Operand> const& home_object() const { return m_home_object; }
 
+    // Used by the bytecode cache to point a loaded instruction at the freshly parsed AST.
+    void set_function_node(FunctionNode const& function_node) { m_function_node = &function_node; }
+
 private:
     Operand m_dst;
-    FunctionNode const& m_function_node;
+    FunctionNode const* m_function_node { nullptr };
     Optional<IdentifierTableIndex> m_lhs_name;
     Optional<Operand> m_home_object;
 };
@@ -1930,17 +1959,20 @@ class BlockDeclarationInstantiation final : public Instruction {
 public:
     explicit BlockDeclarationInstantiation(ScopeNode const& scope_node)
         : Instruction(Type::BlockDeclarationInstantiation)
-        , m_scope_node(scope_node)
+        , m_scope_node(&scope_node)
     {
     }
 
     void execute_impl(Bytecode::Interpreter&) const;
     ByteString to_byte_string_impl(Bytecode::Executable const&) const;
 
-    ScopeNode const& scope_node() const { return m_scope_node; }
+    ScopeNode const& scope_node() const { return *m_scope_node; }
+
+    // Used by the bytecode cache to point a loaded instruction at the freshly parsed AST.
+    void set_scope_node(ScopeNode const& scope_node) { m_scope_node = &scope_node; }
 
 private:
-    ScopeNode const& m_scope_node;
+    ScopeNode const* m_scope_node { nullptr };
 };
 
 class Return final : public Instruction {
@@ -2641,6 +2673,7 @@ public:
 
     Operand dst() const { return m_dst; }
     IdentifierTableIndex identifier() const { return m_identifier; }
+    EnvironmentCoordinate const& cache() const { return m_cache; }
 
 private:
     Operand m_dst;
@@ -0,0 +1,182 @@
+/*
+ * Copyright (c) 2026, agent <agent@local>
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibJS/Bytecode/Generator.h>
+#include <LibJS/Bytecode/Op.h>
+#include <LibJS/Bytecode/Pass/Dataflow.h>
+
+namespace JS::Bytecode::Passes {
+
+static ThrowCompletionOr<Value> fold_binary_operation(VM& vm, Instruction::Type type, Value lhs, Value rhs)
+{
+    switch (type) {
+    case Instruction::Type::Add:
+        return add(vm, lhs, rhs);
+    case Instruction::Type::Sub:
+        return sub(vm, lhs, rhs);
+    case Instruction::Type::Mul:
+        return mul(vm, lhs, rhs);
+    case Instruction::Type::Div:
+        return div(vm, lhs, rhs);
+    case Instruction::Type::Mod:
+        return mod(vm, lhs, rhs);
+    case Instruction::Type::Exp:
+        return exp(vm, lhs, rhs);
+    case Instruction::Type::GreaterThan:
+        return greater_than(vm, lhs, rhs);
+    case Instruction::Type::GreaterThanEquals:
+        return greater_than_equals(vm, lhs, rhs);
+    case Instruction::Type::LessThan:
+        return less_than(vm, lhs, rhs);
+    case Instruction::Type::LessThanEquals:
+        return less_than_equals(vm, lhs, rhs);
+    case Instruction::Type::LooselyInequals:
+        return Value(!TRY(is_loosely_equal(vm, lhs, rhs)));
+    case Instruction::Type::LooselyEquals:
+        return Value(TRY(is_loosely_equal(vm, lhs, rhs)));
+    case Instruction::Type::StrictlyInequals:
+        return Value(!is_strictly_equal(lhs, rhs));
+    case Instruction::Type::StrictlyEquals:
+        return Value(is_strictly_equal(lhs, rhs));
+    case Instruction::Type::BitwiseAnd:
+        return bitwise_and(vm, lhs, rhs);
+    case Instruction::Type::BitwiseOr:
+        return bitwise_or(vm, lhs, rhs);
+    case Instruction::Type::BitwiseXor:
+        return bitwise_xor(vm, lhs, rhs);
+    case Instruction::Type::LeftShift:
+        return left_shift(vm, lhs, rhs);
+    case Instruction::Type::RightShift:
+        return right_shift(vm, lhs, rhs);
+    case Instruction::Type::UnsignedRightShift:
+        return unsigned_right_shift(vm, lhs, rhs);
+    default:
+        // NOTE: We just have to throw *something* to indicate that this is not a constant foldable operation.
+        return throw_completion(js_null());
+    }
+}
+
+static ThrowCompletionOr<Value> fold_unary_operation(VM& vm, Instruction::Type type, Value value)
+{
+    switch (type) {
+    case Instruction::Type::BitwiseNot:
+        return bitwise_not(vm, value);
+    case Instruction::Type::Not:
+        return Value(!value.to_boolean());
+    case Instruction::Type::UnaryMinus:
+        return unary_minus(vm, value);
+    case Instruction::Type::UnaryPlus:
+        return unary_plus(vm, value);
+    default:
+        return throw_completion(js_null());
+    }
+}
+
+static Instruction::Type comparison_for_jump(Instruction::Type type)
+{
+    switch (type) {
+#define __BYTECODE_OP(OpTitleCase, ...)         \
+    case Instruction::Type::Jump##OpTitleCase: \
+        return Instruction::Type::OpTitleCase;
+        JS_ENUMERATE_COMPARISON_OPS(__BYTECODE_OP)
+#undef __BYTECODE_OP
+    default:
+        VERIFY_NOT_REACHED();
+    }
+}
+
+void ConstantFolding::perform(PassPipelineExecutable& executable)
+{
+    auto& generator = executable.generator;
+    auto& vm = generator.vm();
+
+    // Constants that are objects may run arbitrary code when converted, and the empty value never reaches these
+    // operations at runtime, so we only ever fold primitives.
+    auto constant_value = [&](Operand const& operand) -> Optional<Value> {
+        if (!operand.is_constant())
+            return {};
+        auto value = generator.get_constant(operand);
+        if (value.is_empty() || value.is_object())
+            return {};
+        return value;
+    };
+
+    for (auto& block : executable.basic_blocks) {
+        BlockRewriter rewriter(*block);
+
+        for_each_instruction(*block, [&](size_t offset, Instruction& instruction) {
+            switch (instruction.type()) {
+#define __BYTECODE_OP(OpTitleCase, ...)                                                                     \
+    case Instruction::Type::OpTitleCase: {                                                                  \
+        auto& op = static_cast<Op::OpTitleCase const&>(instruction);                                        \
+        auto lhs = constant_value(op.lhs());                                                                \
+        auto rhs = constant_value(op.rhs());                                                                \
+        if (!lhs.has_value() || !rhs.has_value())                                                           \
+            return;                                                                                         \
+        if (auto result = fold_binary_operation(vm, instruction.type(), *lhs, *rhs); !result.is_error())    \
+            rewriter.replace<Op::Mov>(offset, op.dst(), generator.add_constant(result.release_value()));    \
+        return;                                                                                             \
+    }
+                JS_ENUMERATE_COMMON_BINARY_OPS_WITHOUT_FAST_PATH(__BYTECODE_OP)
+                JS_ENUMERATE_COMMON_BINARY_OPS_WITH_FAST_PATH(__BYTECODE_OP)
+#undef __BYTECODE_OP
+
+#define __BYTECODE_OP(OpTitleCase, ...)                                                                  \
+    case Instruction::Type::OpTitleCase: {                                                               \
+        auto& op = static_cast<Op::OpTitleCase const&>(instruction);                                     \
+        auto src = constant_value(op.src());                                                             \
+        if (!src.has_value())                                                                            \
+            return;                                                                                      \
+        if (auto result = fold_unary_operation(vm, instruction.type(), *src); !result.is_error())        \
+            rewriter.replace<Op::Mov>(offset, op.dst(), generator.add_constant(result.release_value())); \
+        return;                                                                                          \
+    }
+                JS_ENUMERATE_COMMON_UNARY_OPS(__BYTECODE_OP)
+#undef __BYTECODE_OP
+
+#define __BYTECODE_OP(OpTitleCase, ...)                                                                      \
+    case Instruction::Type::Jump##OpTitleCase: {                                                             \
+        auto& op = static_cast<Op::Jump##OpTitleCase const&>(instruction);                                   \
+        auto lhs = constant_value(op.lhs());                                                                 \
+        auto rhs = constant_value(op.rhs());                                                                 \
+        if (!lhs.has_value() || !rhs.has_value())                                                            \
+            return;                                                                                          \
+        auto result = fold_binary_operation(vm, comparison_for_jump(instruction.type()), *lhs, *rhs);        \
+        if (!result.is_error())                                                                              \
+            rewriter.replace<Op::Jump>(offset, result.value().as_bool() ? op.true_target() : op.false_target()); \
+        return;                                                                                              \
+    }
+                JS_ENUMERATE_COMPARISON_OPS(__BYTECODE_OP)
+#undef __BYTECODE_OP
+
+            case Instruction::Type::JumpIf: {
+                auto& op = static_cast<Op::JumpIf const&>(instruction);
+                if (auto condition = constant_value(op.condition()); condition.has_value())
+                    rewriter.replace<Op::Jump>(offset, condition->to_boolean() ? op.true_target() : op.false_target());
+                return;
+            }
+            case Instruction::Type::JumpNullish: {
+                auto& op = static_cast<Op::JumpNullish const&>(instruction);
+                if (auto condition = constant_value(op.condition()); condition.has_value())
+                    rewriter.replace<Op::Jump>(offset, condition->is_nullish() ? op.true_target() : op.false_target());
+                return;
+            }
+            case Instruction::Type::JumpUndefined: {
+                auto& op = static_cast<Op::JumpUndefined const&>(instruction);
+                if (auto condition = constant_value(op.condition()); condition.has_value())
+                    rewriter.replace<Op::Jump>(offset, condition->is_undefined() ? op.true_target() : op.false_target());
+                return;
+            }
+            default:
+                return;
+            }
+        });
+
+        rewriter.apply();
+    }
+}
+
+}
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2026, agent <agent@local>
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibJS/Bytecode/Op.h>
+#include <LibJS/Bytecode/Pass/Dataflow.h>
+
+namespace JS::Bytecode::Passes {
+
+// Locals are only ever accessed through the operands of this executable's instructions, so they can hold copies just
+// like the registers allocated by the Generator.
+static bool can_hold_copy(Operand const& operand)
+{
+    return is_allocated_register(operand) || operand.is_local();
+}
+
+static u64 copy_key(Operand const& operand)
+{
+    return (static_cast<u64>(operand.type()) << 32) | operand.index();
+}
+
+void CopyPropagation::perform(PassPipelineExecutable& executable)
+{
+    // Maps a register or local to the operand it currently holds a copy of.
+    HashMap<u64, Operand> copies;
+
+    auto forget_copies_involving = [&](Operand const& operand) {
+        if (can_hold_copy(operand))
+            copies.remove(copy_key(operand));
+        copies.remove_all_matching([&](u64, Operand const& source) { return source == operand; });
+    };
+
+    for (auto& block : executable.basic_blocks) {
+        copies.clear();
+
+        for_each_instruction(*block, [&](size_t, Instruction& instruction) {
+            auto roles = operand_roles(instruction);
+            if (roles == OperandRoles::Unknown) {
+                instruction.visit_operands([&](Operand& operand) {
+                    forget_copies_involving(operand);
+                });
+                return;
+            }
+
+            Optional<Operand> definition;
+            instruction.visit_operands([&](Operand& operand) {
+                if (!definition.has_value() && roles == OperandRoles::DefinitionThenUses) {
+                    definition = operand;
+                    return;
+                }
+                if (!can_hold_copy(operand))
+                    return;
+                if (auto source = copies.get(copy_key(operand)); source.has_value())
+                    operand = *source;
+            });
+
+            if (!definition.has_value())
+                return;
+            forget_copies_involving(*definition);
+
+            if (instruction.type() != Instruction::Type::Mov || !can_hold_copy(*definition))
+                return;
+            auto source = static_cast<Op::Mov const&>(instruction).src();
+            // NOTE: The reserved registers may change behind our back, so we never forward them.
+            if (source == *definition || (source.is_register() && !is_allocated_register(source)))
+                return;
+            copies.set(copy_key(*definition), source);
+        });
+    }
+}
+
+}
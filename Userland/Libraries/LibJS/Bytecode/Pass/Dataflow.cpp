@@ -0,0 +1,218 @@
+/*
+ * Copyright (c) 2026, agent <agent@local>
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibJS/Bytecode/Op.h>
+#include <LibJS/Bytecode/Pass/Dataflow.h>
+
+namespace JS::Bytecode::Passes {
+
+OperandRoles operand_roles(Instruction const& instruction)
+{
+    switch (instruction.type()) {
+#define __BYTECODE_OP(OpTitleCase, ...) case Instruction::Type::OpTitleCase:
+        JS_ENUMERATE_COMMON_BINARY_OPS_WITHOUT_FAST_PATH(__BYTECODE_OP)
+        JS_ENUMERATE_COMMON_BINARY_OPS_WITH_FAST_PATH(__BYTECODE_OP)
+        JS_ENUMERATE_COMMON_UNARY_OPS(__BYTECODE_OP)
+#undef __BYTECODE_OP
+    case Instruction::Type::Call:
+    case Instruction::Type::CallWithArgumentArray:
+    case Instruction::Type::GetArgument:
+    case Instruction::Type::GetBinding:
+    case Instruction::Type::GetById:
+    case Instruction::Type::GetByIdWithThis:
+    case Instruction::Type::GetByValue:
+    case Instruction::Type::GetByValueWithThis:
+    case Instruction::Type::GetGlobal:
+    case Instruction::Type::GetLength:
+    case Instruction::Type::GetLengthWithThis:
+    case Instruction::Type::Mov:
+    case Instruction::Type::NewArray:
+    case Instruction::Type::NewFunction:
+    case Instruction::Type::NewObject:
+    case Instruction::Type::NewPrimitiveArray:
+    case Instruction::Type::NewRegExp:
+        return OperandRoles::DefinitionThenUses;
+#define __BYTECODE_OP(OpTitleCase, ...) case Instruction::Type::Jump##OpTitleCase:
+        JS_ENUMERATE_COMPARISON_OPS(__BYTECODE_OP)
+#undef __BYTECODE_OP
+    case Instruction::Type::Await:
+    case Instruction::Type::End:
+    case Instruction::Type::InitializeLexicalBinding:
+    case Instruction::Type::InitializeVariableBinding:
+    case Instruction::Type::Jump:
+    case Instruction::Type::JumpFalse:
+    case Instruction::Type::JumpIf:
+    case Instruction::Type::JumpNullish:
+    case Instruction::Type::JumpTrue:
+    case Instruction::Type::JumpUndefined:
+    case Instruction::Type::PutById:
+    case Instruction::Type::PutByIdWithThis:
+    case Instruction::Type::PutByValue:
+    case Instruction::Type::PutByValueWithThis:
+    case Instruction::Type::Return:
+    case Instruction::Type::SetArgument:
+    case Instruction::Type::SetLexicalBinding:
+    case Instruction::Type::SetVariableBinding:
+    case Instruction::Type::Throw:
+    case Instruction::Type::ThrowIfNotObject:
+    case Instruction::Type::ThrowIfNullish:
+    case Instruction::Type::ThrowIfTDZ:
+    case Instruction::Type::Yield:
+        return OperandRoles::UsesOnly;
+    default:
+        return OperandRoles::Unknown;
+    }
+}
+
+void update_liveness(Instruction& instruction, RegisterSet& live)
+{
+    auto roles = operand_roles(instruction);
+    if (roles == OperandRoles::DefinitionThenUses) {
+        bool is_first = true;
+        instruction.visit_operands([&](Operand& operand) {
+            if (is_first && is_allocated_register(operand))
+                live.clear(operand.index());
+            is_first = false;
+        });
+    }
+    bool is_first = true;
+    instruction.visit_operands([&](Operand& operand) {
+        bool is_definition = is_first && roles == OperandRoles::DefinitionThenUses;
+        is_first = false;
+        if (!is_definition && is_allocated_register(operand))
+            live.set(operand.index());
+    });
+}
+
+static bool has_known_successors(Instruction const& terminator)
+{
+    switch (terminator.type()) {
+#define __BYTECODE_OP(OpTitleCase, ...) case Instruction::Type::Jump##OpTitleCase:
+        JS_ENUMERATE_COMPARISON_OPS(__BYTECODE_OP)
+#undef __BYTECODE_OP
+    case Instruction::Type::Await:
+    case Instruction::Type::End:
+    case Instruction::Type::Jump:
+    case Instruction::Type::JumpFalse:
+    case Instruction::Type::JumpIf:
+    case Instruction::Type::JumpNullish:
+    case Instruction::Type::JumpTrue:
+    case Instruction::Type::JumpUndefined:
+    case Instruction::Type::Return:
+    case Instruction::Type::Throw:
+    case Instruction::Type::Yield:
+        return true;
+    default:
+        return false;
+    }
+}
+
+bool has_imprecise_liveness(BasicBlock& block)
+{
+    if (block.handler() || block.finalizer())
+        return true;
+    if (!block.is_terminated())
+        return false;
+    auto const& terminator = *reinterpret_cast<Instruction const*>(block.data() + block.last_instruction_start_offset());
+    return !has_known_successors(terminator);
+}
+
+Vector<RegisterSet> compute_live_out(PassPipelineExecutable& executable)
+{
+    auto& blocks = executable.basic_blocks;
+
+    Vector<Vector<size_t>> successors;
+    successors.resize(blocks.size());
+    Vector<bool> is_imprecise;
+    is_imprecise.resize(blocks.size());
+    for (auto& block : blocks) {
+        is_imprecise[block->index()] = has_imprecise_liveness(*block);
+        // NOTE: Every label an instruction refers to is treated as a successor, which also covers unwind entry
+        //       points and the continuations of yields and awaits.
+        for_each_instruction(*block, [&](size_t, Instruction& instruction) {
+            instruction.visit_labels([&](Label& label) {
+                successors[block->index()].append(label.basic_block_index());
+            });
+        });
+    }
+
+    Vector<RegisterSet> live_in;
+    Vector<RegisterSet> live_out;
+    live_in.ensure_capacity(blocks.size());
+    live_out.ensure_capacity(blocks.size());
+    for (size_t i = 0; i < blocks.size(); ++i) {
+        live_in.empend(executable.number_of_registers);
+        live_out.empend(executable.number_of_registers);
+        if (is_imprecise[i]) {
+            live_in[i].set_all();
+            live_out[i].set_all();
+        }
+    }
+
+    bool changed = true;
+    while (changed) {
+        changed = false;
+        for (size_t i = blocks.size(); i > 0; --i) {
+            auto index = i - 1;
+            if (is_imprecise[index])
+                continue;
+            for (auto successor : successors[index])
+                live_out[index].merge(live_in[successor]);
+
+            auto live = live_out[index];
+            Vector<Instruction*> instructions;
+            for_each_instruction(*blocks[index], [&](size_t, Instruction& instruction) {
+                instructions.append(&instruction);
+            });
+            for (size_t j = instructions.size(); j > 0; --j)
+                update_liveness(*instructions[j - 1], live);
+            changed |= live_in[index].merge(live);
+        }
+    }
+
+    return live_out;
+}
+
+size_t BlockRewriter::apply()
+{
+    if (m_changes.is_empty())
+        return 0;
+
+    Vector<u8> buffer;
+    buffer.ensure_capacity(m_block.size());
+    HashMap<size_t, SourceRecord> source_map;
+    size_t last_instruction_start_offset = 0;
+    size_t removed_instruction_count = 0;
+
+    for_each_instruction(m_block, [&](size_t offset, Instruction& instruction) {
+        auto change = m_changes.get(offset);
+        auto source_record = m_block.source_map().get(offset);
+        if (!change.has_value()) {
+            last_instruction_start_offset = buffer.size();
+            if (source_record.has_value())
+                source_map.set(buffer.size(), *source_record);
+            buffer.append(reinterpret_cast<u8 const*>(&instruction), instruction.length());
+            return;
+        }
+
+        Instruction::destroy(instruction);
+        if (!change->has_value()) {
+            ++removed_instruction_count;
+            return;
+        }
+
+        last_instruction_start_offset = buffer.size();
+        if (source_record.has_value())
+            source_map.set(buffer.size(), *source_record);
+        buffer.append(change->value().data(), change->value().size());
+    });
+
+    m_block.set_instruction_stream(move(buffer), move(source_map), last_instruction_start_offset);
+    m_changes.clear();
+    return removed_instruction_count;
+}
+
+}
@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2026, agent <agent@local>
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/HashMap.h>
+#include <AK/Vector.h>
+#include <LibJS/Bytecode/BasicBlock.h>
+#include <LibJS/Bytecode/Instruction.h>
+#include <LibJS/Bytecode/Operand.h>
+#include <LibJS/Bytecode/PassManager.h>
+#include <LibJS/Bytecode/Register.h>
+
+namespace JS::Bytecode::Passes {
+
+// How an instruction accesses the operands it visits in visit_operands().
+enum class OperandRoles {
+    // Anything may be read or written. Passes must treat the instruction as a barrier for all of its operands.
+    Unknown,
+    // All operands are only read.
+    UsesOnly,
+    // The first operand is only written (after all other operands have been read), the rest are only read.
+    DefinitionThenUses,
+};
+
+OperandRoles operand_roles(Instruction const&);
+
+// Registers below Register::reserved_register_count are also read and written implicitly by the interpreter, so only
+// the ones allocated by the Generator are subject to optimization.
+inline bool is_allocated_register(Operand const& operand)
+{
+    return operand.is_register() && operand.index() >= Register::reserved_register_count;
+}
+
+template<typename Callback>
+void for_each_instruction(BasicBlock& block, Callback callback)
+{
+    InstructionStreamIterator it(block.instruction_stream());
+    while (!it.at_end()) {
+        auto offset = it.offset();
+        auto& instruction = const_cast<Instruction&>(*it);
+        ++it;
+        callback(offset, instruction);
+    }
+}
+
+class RegisterSet {
+public:
+    explicit RegisterSet(size_t size = 0)
+    {
+        m_words.resize(ceil_div(size, 64ul));
+    }
+
+    bool contains(u32 index) const { return m_words[index / 64] & (1ull << (index % 64)); }
+    void set(u32 index) { m_words[index / 64] |= 1ull << (index % 64); }
+    void clear(u32 index) { m_words[index / 64] &= ~(1ull << (index % 64)); }
+
+    void set_all()
+    {
+        for (auto& word : m_words)
+            word = ~0ull;
+    }
+
+    // Returns true if this set changed.
+    bool merge(RegisterSet const& other)
+    {
+        bool changed = false;
+        for (size_t i = 0; i < m_words.size(); ++i) {
+            auto merged = m_words[i] | other.m_words[i];
+            changed |= merged != m_words[i];
+            m_words[i] = merged;
+        }
+        return changed;
+    }
+
+private:
+    Vector<u64> m_words;
+};
+
+// Updates `live` from the registers live after `instruction` to the ones live before it.
+void update_liveness(Instruction&, RegisterSet& live);
+
+// Blocks that are protected by a handler or finalizer can transfer control in the middle of any instruction, and
+// blocks that end in a jump whose target is only known at runtime don't have a precise set of successors. All
+// registers are considered live throughout these blocks.
+bool has_imprecise_liveness(BasicBlock&);
+
+// Returns the registers live on exit from each block, indexed by block index.
+Vector<RegisterSet> compute_live_out(PassPipelineExecutable&);
+
+// Collects removals and same-size-or-smaller replacements of a block's instructions, then rebuilds its stream.
+class BlockRewriter {
+public:
+    explicit BlockRewriter(BasicBlock& block)
+        : m_block(block)
+    {
+    }
+
+    void remove(size_t offset) { m_changes.set(offset, {}); }
+
+    template<typename OpType, typename... Args>
+    void replace(size_t offset, Args&&... args)
+    {
+        static_assert(!OpType::IsVariableLength);
+        Vector<u8> bytes;
+        bytes.resize(sizeof(OpType));
+        new (bytes.data()) OpType(forward<Args>(args)...);
+        m_changes.set(offset, move(bytes));
+    }
+
+    bool has_changes() const { return !m_changes.is_empty(); }
+
+    // Returns the number of instructions that were removed.
+    size_t apply();
+
+private:
+    BasicBlock& m_block;
+    HashMap<size_t, Optional<Vector<u8>>> m_changes;
+};
+
+}
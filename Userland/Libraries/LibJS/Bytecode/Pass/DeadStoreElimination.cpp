@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) 2026, agent <agent@local>
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibJS/Bytecode/Op.h>
+#include <LibJS/Bytecode/Pass/Dataflow.h>
+
+namespace JS::Bytecode::Passes {
+
+void DeadStoreElimination::perform(PassPipelineExecutable& executable)
+{
+    auto live_out = compute_live_out(executable);
+
+    for (auto& block : executable.basic_blocks) {
+        BlockRewriter rewriter(*block);
+        bool is_imprecise = has_imprecise_liveness(*block);
+
+        Vector<size_t> offsets;
+        Vector<Instruction*> instructions;
+        for_each_instruction(*block, [&](size_t offset, Instruction& instruction) {
+            offsets.append(offset);
+            instructions.append(&instruction);
+        });
+
+        auto live = live_out[block->index()];
+        for (size_t i = instructions.size(); i > 0; --i) {
+            auto& instruction = *instructions[i - 1];
+            if (instruction.type() == Instruction::Type::Mov) {
+                auto& mov = static_cast<Op::Mov const&>(instruction);
+                // NOTE: A Mov can't throw, so it is always safe to remove one that has no effect.
+                if (mov.dst() == mov.src()) {
+                    rewriter.remove(offsets[i - 1]);
+                    continue;
+                }
+                if (!is_imprecise && is_allocated_register(mov.dst()) && !live.contains(mov.dst().index())) {
+                    rewriter.remove(offsets[i - 1]);
+                    continue;
+                }
+            }
+            update_liveness(instruction, live);
+        }
+
+        rewriter.apply();
+    }
+}
+
+}
@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2026, agent <agent@local>
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibJS/Bytecode/Op.h>
+#include <LibJS/Bytecode/Pass/Dataflow.h>
+
+namespace JS::Bytecode::Passes {
+
+void JumpThreading::perform(PassPipelineExecutable& executable)
+{
+    auto& blocks = executable.basic_blocks;
+
+    // For every block that consists of nothing but a Jump, remember where it jumps to.
+    Vector<Optional<size_t>> forwarded_targets;
+    forwarded_targets.resize(blocks.size());
+    for (auto& block : blocks) {
+        if (block->size() == 0 || block->last_instruction_start_offset() != 0 || !block->is_terminated())
+            continue;
+        auto const& instruction = *reinterpret_cast<Instruction const*>(block->data());
+        if (instruction.type() == Instruction::Type::Jump)
+            forwarded_targets[block->index()] = static_cast<Op::Jump const&>(instruction).target().basic_block_index();
+    }
+
+    auto final_target = [&](size_t index) {
+        // NOTE: Chains of forwarding blocks can form a cycle (e.g. `while (true) {}`), so we stop after as many steps
+        //       as there are blocks.
+        for (size_t steps = 0; steps < blocks.size() && forwarded_targets[index].has_value(); ++steps)
+            index = forwarded_targets[index].value();
+        return index;
+    };
+
+    for (auto& block : blocks) {
+        BlockRewriter rewriter(*block);
+
+        for_each_instruction(*block, [&](size_t offset, Instruction& instruction) {
+            instruction.visit_labels([&](Label& label) {
+                label = Label { static_cast<u32>(final_target(label.basic_block_index())) };
+            });
+
+            if (instruction.type() == Instruction::Type::JumpIf) {
+                auto& jump = static_cast<Op::JumpIf const&>(instruction);
+                if (jump.true_target().basic_block_index() == jump.false_target().basic_block_index())
+                    rewriter.replace<Op::Jump>(offset, jump.true_target());
+            }
+        });
+
+        rewriter.apply();
+    }
+}
+
+}
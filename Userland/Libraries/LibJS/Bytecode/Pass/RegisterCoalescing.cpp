@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2026, agent <agent@local>
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibJS/Bytecode/Op.h>
+#include <LibJS/Bytecode/Pass/Dataflow.h>
+
+namespace JS::Bytecode::Passes {
+
+static bool mentions(Instruction& instruction, Operand const& operand)
+{
+    bool found = false;
+    instruction.visit_operands([&](Operand& candidate) {
+        if (candidate == operand)
+            found = true;
+    });
+    return found;
+}
+
+static Operand& definition_of(Instruction& instruction)
+{
+    VERIFY(operand_roles(instruction) == OperandRoles::DefinitionThenUses);
+    Operand* definition = nullptr;
+    instruction.visit_operands([&](Operand& operand) {
+        if (!definition)
+            definition = &operand;
+    });
+    return *definition;
+}
+
+void RegisterCoalescing::perform(PassPipelineExecutable& executable)
+{
+    auto live_out = compute_live_out(executable);
+
+    for (auto& block : executable.basic_blocks) {
+        // NOTE: Writing the final destination earlier than before could be observed by a handler if any instruction
+        //       in between throws, so we leave protected blocks alone.
+        if (has_imprecise_liveness(*block))
+            continue;
+
+        BlockRewriter rewriter(*block);
+
+        Vector<size_t> offsets;
+        Vector<Instruction*> instructions;
+        for_each_instruction(*block, [&](size_t offset, Instruction& instruction) {
+            offsets.append(offset);
+            instructions.append(&instruction);
+        });
+
+        auto live = live_out[block->index()];
+        for (size_t j = instructions.size(); j > 0; --j) {
+            auto& instruction = *instructions[j - 1];
+            if (instruction.type() == Instruction::Type::Mov) {
+                auto& mov = static_cast<Op::Mov const&>(instruction);
+                auto temporary = mov.src();
+                auto destination = mov.dst();
+                bool is_candidate = is_allocated_register(temporary)
+                    && !live.contains(temporary.index())
+                    && (is_allocated_register(destination) || destination.is_local());
+
+                // Look for the instruction that produced the temporary, making sure nothing in between touches
+                // either the temporary or the destination.
+                bool did_coalesce = false;
+                for (size_t i = j - 1; is_candidate && i > 0; --i) {
+                    auto& producer = *instructions[i - 1];
+                    if (operand_roles(producer) == OperandRoles::DefinitionThenUses && definition_of(producer) == temporary) {
+                        // The producer reads all of its inputs before writing its output, so it's fine if the
+                        // temporary or the destination are also among them.
+                        definition_of(producer) = destination;
+                        rewriter.remove(offsets[j - 1]);
+                        did_coalesce = true;
+                        break;
+                    }
+                    if (mentions(producer, temporary) || mentions(producer, destination))
+                        break;
+                }
+
+                // NOTE: The producer now defines the destination, and updates liveness accordingly once we reach it.
+                if (did_coalesce)
+                    continue;
+            }
+            update_liveness(instruction, live);
+        }
+
+        rewriter.apply();
+    }
+}
+
+}
@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2026, agent <agent@local>
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Array.h>
+#include <LibCore/ElapsedTimer.h>
+#include <LibJS/Bytecode/Instruction.h>
+#include <LibJS/Bytecode/PassManager.h>
+
+namespace JS::Bytecode {
+
+bool g_dump_optimization_pass_statistics = false;
+
+static auto s_enabled_optimization_passes = AK::Array<bool, to_underlying(OptimizationPass::__Count)>::from_repeated_value(true);
+
+struct OptimizationPassStatistics {
+    u64 runs { 0 };
+    u64 microseconds { 0 };
+    i64 removed_instructions { 0 };
+    i64 removed_bytes { 0 };
+};
+
+static AK::Array<OptimizationPassStatistics, to_underlying(OptimizationPass::__Count)> s_optimization_pass_statistics {};
+
+StringView optimization_pass_name(OptimizationPass pass)
+{
+    switch (pass) {
+#define __JS_ENUMERATE(PassName, pass_name) \
+    case OptimizationPass::PassName:        \
+        return pass_name##sv;
+        JS_ENUMERATE_BYTECODE_OPTIMIZATION_PASSES(__JS_ENUMERATE)
+#undef __JS_ENUMERATE
+    default:
+        VERIFY_NOT_REACHED();
+    }
+}
+
+Optional<OptimizationPass> optimization_pass_from_name(StringView name)
+{
+#define __JS_ENUMERATE(PassName, pass_name) \
+    if (name == pass_name##sv)              \
+        return OptimizationPass::PassName;
+    JS_ENUMERATE_BYTECODE_OPTIMIZATION_PASSES(__JS_ENUMERATE)
+#undef __JS_ENUMERATE
+    return {};
+}
+
+void set_optimization_pass_enabled(OptimizationPass pass, bool enabled)
+{
+    s_enabled_optimization_passes[to_underlying(pass)] = enabled;
+}
+
+bool is_optimization_pass_enabled(OptimizationPass pass)
+{
+    return s_enabled_optimization_passes[to_underlying(pass)];
+}
+
+bool is_any_optimization_pass_enabled()
+{
+    for (auto enabled : s_enabled_optimization_passes) {
+        if (enabled)
+            return true;
+    }
+    return false;
+}
+
+void dump_optimization_pass_statistics()
+{
+    dbgln("Bytecode optimization passes:");
+    for (size_t i = 0; i < s_optimization_pass_statistics.size(); ++i) {
+        auto const& statistics = s_optimization_pass_statistics[i];
+        if (statistics.runs == 0)
+            continue;
+        dbgln("  {:24} runs: {:6}, time: {:6}us, removed instructions: {:6}, removed bytes: {:8}",
+            optimization_pass_name(static_cast<OptimizationPass>(i)),
+            statistics.runs,
+            statistics.microseconds,
+            statistics.removed_instructions,
+            statistics.removed_bytes);
+    }
+}
+
+PassManager PassManager::create_optimization_pipeline()
+{
+    PassManager pipeline;
+    if (is_optimization_pass_enabled(OptimizationPass::CopyPropagation))
+        pipeline.add<Passes::CopyPropagation>();
+    if (is_optimization_pass_enabled(OptimizationPass::ConstantFolding)) {
+        pipeline.add<Passes::ConstantFolding>();
+        // Folding turns instructions into Movs of constants, which can be forwarded in turn.
+        if (is_optimization_pass_enabled(OptimizationPass::CopyPropagation))
+            pipeline.add<Passes::CopyPropagation>();
+    }
+    if (is_optimization_pass_enabled(OptimizationPass::DeadStoreElimination))
+        pipeline.add<Passes::DeadStoreElimination>();
+    if (is_optimization_pass_enabled(OptimizationPass::RegisterCoalescing))
+        pipeline.add<Passes::RegisterCoalescing>();
+    if (is_optimization_pass_enabled(OptimizationPass::JumpThreading))
+        pipeline.add<Passes::JumpThreading>();
+    return pipeline;
+}
+
+static void count_instructions(PassPipelineExecutable& executable, i64& instruction_count, i64& byte_count)
+{
+    instruction_count = 0;
+    byte_count = 0;
+    for (auto& block : executable.basic_blocks) {
+        InstructionStreamIterator it(block->instruction_stream());
+        for (; !it.at_end(); ++it)
+            ++instruction_count;
+        byte_count += block->size();
+    }
+}
+
+void PassManager::perform(PassPipelineExecutable& executable)
+{
+    for (auto& pass : m_passes) {
+        if (!g_dump_optimization_pass_statistics) {
+            pass->perform(executable);
+            continue;
+        }
+
+        i64 instructions_before = 0;
+        i64 bytes_before = 0;
+        count_instructions(executable, instructions_before, bytes_before);
+
+        auto timer = Core::ElapsedTimer::start_new(Core::TimerType::Precise);
+        pass->perform(executable);
+        auto elapsed = timer.elapsed_time();
+
+        i64 instructions_after = 0;
+        i64 bytes_after = 0;
+        count_instructions(executable, instructions_after, bytes_after);
+
+        auto& statistics = s_optimization_pass_statistics[to_underlying(pass->kind())];
+        ++statistics.runs;
+        statistics.microseconds += elapsed.to_microseconds();
+        statistics.removed_instructions += instructions_before - instructions_after;
+        statistics.removed_bytes += bytes_before - bytes_after;
+    }
+}
+
+}
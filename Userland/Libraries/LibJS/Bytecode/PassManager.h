@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2026, agent <agent@local>
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/NonnullOwnPtr.h>
+#include <AK/Optional.h>
+#include <AK/StringView.h>
+#include <AK/Vector.h>
+#include <LibJS/Bytecode/BasicBlock.h>
+#include <LibJS/Forward.h>
+
+namespace JS::Bytecode {
+
+// Optimization passes that run over the basic blocks of an executable before they are linearized, in this order.
+// They are all enabled by default. `js --bytecode-optimizations` picks which ones run, and
+// `test-js --disable-bytecode-optimizations` turns them all off.
+#define JS_ENUMERATE_BYTECODE_OPTIMIZATION_PASSES(P)           \
+    P(CopyPropagation, "copy-propagation")                     \
+    P(ConstantFolding, "constant-folding")                     \
+    P(DeadStoreElimination, "dead-store-elimination")          \
+    P(RegisterCoalescing, "register-coalescing")               \
+    P(JumpThreading, "jump-threading")
+
+enum class OptimizationPass {
+#define __JS_ENUMERATE(PassName, pass_name) PassName,
+    JS_ENUMERATE_BYTECODE_OPTIMIZATION_PASSES(__JS_ENUMERATE)
+#undef __JS_ENUMERATE
+        __Count,
+};
+
+StringView optimization_pass_name(OptimizationPass);
+Optional<OptimizationPass> optimization_pass_from_name(StringView);
+
+void set_optimization_pass_enabled(OptimizationPass, bool);
+bool is_optimization_pass_enabled(OptimizationPass);
+bool is_any_optimization_pass_enabled();
+
+extern bool g_dump_optimization_pass_statistics;
+void dump_optimization_pass_statistics();
+
+struct PassPipelineExecutable {
+    Generator& generator;
+    Vector<NonnullOwnPtr<BasicBlock>>& basic_blocks;
+    u32 number_of_registers { 0 };
+};
+
+class Pass {
+public:
+    Pass() = default;
+    virtual ~Pass() = default;
+
+    virtual OptimizationPass kind() const = 0;
+    virtual void perform(PassPipelineExecutable&) = 0;
+};
+
+class PassManager {
+public:
+    // Builds the pipeline of all currently enabled passes.
+    static PassManager create_optimization_pipeline();
+
+    template<typename PassT, typename... Args>
+    void add(Args&&... args) { m_passes.append(make<PassT>(forward<Args>(args)...)); }
+
+    bool is_empty() const { return m_passes.is_empty(); }
+
+    void perform(PassPipelineExecutable&);
+
+private:
+    Vector<NonnullOwnPtr<Pass>> m_passes;
+};
+
+namespace Passes {
+
+// Forwards the sources of `Mov`s into later uses of their destination register within the same block.
+class CopyPropagation final : public Pass {
+public:
+    virtual OptimizationPass kind() const override { return OptimizationPass::CopyPropagation; }
+    virtual void perform(PassPipelineExecutable&) override;
+};
+
+// Evaluates arithmetic, comparisons and conditional jumps whose operands are all numeric constants.
+class ConstantFolding final : public Pass {
+public:
+    virtual OptimizationPass kind() const override { return OptimizationPass::ConstantFolding; }
+    virtual void perform(PassPipelineExecutable&) override;
+};
+
+// Removes `Mov`s into registers that are never read afterwards, as well as `Mov`s of an operand into itself.
+class DeadStoreElimination final : public Pass {
+public:
+    virtual OptimizationPass kind() const override { return OptimizationPass::DeadStoreElimination; }
+    virtual void perform(PassPipelineExecutable&) override;
+};
+
+// Turns `op $tmp, ...; Mov dst, $tmp` into `op dst, ...` when $tmp is not read afterwards.
+class RegisterCoalescing final : public Pass {
+public:
+    virtual OptimizationPass kind() const override { return OptimizationPass::RegisterCoalescing; }
+    virtual void perform(PassPipelineExecutable&) override;
+};
+
+// Retargets jumps to blocks that do nothing but jump elsewhere, and turns branches with two equal targets into jumps.
+class JumpThreading final : public Pass {
+public:
+    virtual OptimizationPass kind() const override { return OptimizationPass::JumpThreading; }
+    virtual void perform(PassPipelineExecutable&) override;
+};
+
+}
+
+}
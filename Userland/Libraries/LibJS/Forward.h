@@ -205,9 +205,11 @@ class PropertyDescriptor;
 class PropertyKey;
 class Realm;
 class Reference;
+class SamplingProfiler;
 class ScopeNode;
 class Script;
 class Shape;
+struct ShapeStatistics;
 class Statement;
 class StringOrSymbol;
 class SourceCode;
@@ -325,4 +327,8 @@ class RegexTable;
 class Register;
 }
 
+namespace JIT {
+class NativeExecutable;
+}
+
 }
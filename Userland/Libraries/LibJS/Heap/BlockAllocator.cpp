@@ -24,6 +24,7 @@ namespace JS {
 
 BlockAllocator::~BlockAllocator()
 {
+    m_blocks.extend(move(m_decommitted_blocks));
     for (auto* block : m_blocks) {
         ASAN_UNPOISON_MEMORY_REGION(block, HeapBlock::block_size);
         if (munmap(block, HeapBlock::block_size) < 0) {
@@ -35,10 +36,13 @@ BlockAllocator::~BlockAllocator()
 
 void* BlockAllocator::allocate_block([[maybe_unused]] char const* name)
 {
-    if (!m_blocks.is_empty()) {
+    // Blocks that are still committed are the cheapest to reuse, so we prefer those.
+    for (auto* blocks : { &m_blocks, &m_decommitted_blocks }) {
+        if (blocks->is_empty())
+            continue;
         // To reduce predictability, take a random block from the cache.
-        size_t random_index = get_random_uniform(m_blocks.size());
-        auto* block = m_blocks.unstable_take(random_index);
+        size_t random_index = get_random_uniform(blocks->size());
+        auto* block = blocks->unstable_take(random_index);
         ASAN_UNPOISON_MEMORY_REGION(block, HeapBlock::block_size);
         LSAN_REGISTER_ROOT_REGION(block, HeapBlock::block_size);
         return block;
@@ -81,4 +85,23 @@ void BlockAllocator::deallocate_block(void* block)
     m_blocks.append(block);
 }
 
+void BlockAllocator::decommit_cached_blocks_above(size_t blocks_to_keep)
+{
+    // NOTE: Blocks are MADV_FREE'd when they're deallocated, but the kernel only reclaims those pages under memory
+    //       pressure, so they keep counting towards our RSS until then. MADV_DONTNEED takes effect immediately.
+#if !defined(USE_FALLBACK_BLOCK_DEALLOCATION) && defined(MADV_DONTNEED)
+    while (m_blocks.size() > blocks_to_keep) {
+        auto* block = m_blocks.take_last();
+        if (madvise(block, HeapBlock::block_size, MADV_DONTNEED) < 0) {
+            perror("madvise(MADV_DONTNEED)");
+            VERIFY_NOT_REACHED();
+        }
+        m_decommitted_blocks.append(block);
+    }
+#else
+    // The fallback deallocation already gives the pages back to the OS.
+    (void)blocks_to_keep;
+#endif
+}
+
 }
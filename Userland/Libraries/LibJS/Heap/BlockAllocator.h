@@ -19,8 +19,16 @@ public:
     void* allocate_block(char const* name);
     void deallocate_block(void*);
 
+    // Returns the memory of all but `blocks_to_keep` cached blocks to the OS right away. The blocks stay mapped
+    // (and are reused before mapping new ones), but will be zero-filled on demand the next time they're touched.
+    void decommit_cached_blocks_above(size_t blocks_to_keep);
+
+    size_t cached_block_count() const { return m_blocks.size(); }
+    size_t decommitted_block_count() const { return m_decommitted_blocks.size(); }
+
 private:
     Vector<void*> m_blocks;
+    Vector<void*> m_decommitted_blocks;
 };
 
 }
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <AK/Atomic.h>
 #include <AK/Badge.h>
 #include <AK/Format.h>
 #include <AK/Forward.h>
@@ -36,6 +37,29 @@ public:                                            \
     }                                              \
     friend class JS::Heap;
 
+// Declares that every store of a cell pointer into cells of exactly this class goes through a write barrier, so that
+// young collections only have to visit the edges of old ones that were stored into. Stores through GCPtr assignment
+// are barriered automatically, everything else (Value members, containers, raw pointers) needs a call to one of the
+// write_barrier() functions after the store. This isn't inherited: subclasses have to declare it again once their own
+// stores are barriered too. Old cells of other classes have their edges visited by every young collection.
+#define JS_WRITE_BARRIERED_CELL(class_) \
+public:                                 \
+    using WriteBarrieredCell = class_
+
+template<typename T>
+concept HasWriteBarrieredStores = IsSame<typename T::WriteBarrieredCell, T>;
+
+// Declares that dead cells of exactly this class may be destroyed on the background sweeping thread, see
+// Heap::set_concurrent_sweeping_enabled(). Their destructor must only free memory owned by the cell itself (no
+// ref-counted members, no caches in the VM), they must not override finalize() or must_survive_garbage_collection(),
+// and nothing may hold a WeakPtr to them or use them as a weak container key. This isn't inherited.
+#define JS_CONCURRENTLY_SWEPT_CELL(class_) \
+public:                                    \
+    using ConcurrentlySweptCell = class_
+
+template<typename T>
+concept CanBeSweptConcurrently = IsSame<typename T::ConcurrentlySweptCell, T>;
+
 class Cell : public Weakable<Cell> {
     AK_MAKE_NONCOPYABLE(Cell);
     AK_MAKE_NONMOVABLE(Cell);
@@ -47,6 +71,26 @@ public:
     bool is_marked() const { return m_mark; }
     void set_marked(bool b) { m_mark = b; }
 
+    // For parallel marking, where threads can race to mark the same cell. Returns true if this call is the one that
+    // marked the cell. Outside of parallel marking, the mark bit is only ever accessed by one thread at a time.
+    bool try_set_marked_atomically()
+    {
+        if (AK::atomic_load(&m_mark, AK::MemoryOrder::memory_order_relaxed))
+            return false;
+        return !AK::atomic_exchange(&m_mark, true, AK::MemoryOrder::memory_order_relaxed);
+    }
+
+    // Young cells have been allocated since the last garbage collection while the heap is in generational mode.
+    bool is_young() const { return m_young; }
+    void set_young(bool b) { m_young = b; }
+
+    // Remembered cells are old cells whose edges will be visited by the next young collection.
+    bool is_remembered() const { return m_remembered; }
+    void set_remembered(bool b) { m_remembered = b; }
+
+    bool has_write_barriered_stores() const { return m_has_write_barriered_stores; }
+    void set_has_write_barriered_stores(Badge<Heap>) { m_has_write_barriered_stores = true; }
+
     enum class State : bool {
         Live,
         Dead,
@@ -177,11 +221,35 @@ protected:
     void set_overrides_must_survive_garbage_collection(bool b) { m_overrides_must_survive_garbage_collection = b; }
 
 private:
-    bool m_mark : 1 { false };
+    // NOTE: The mark bit is kept in its own byte (rather than a bitfield) so that it can be set atomically, see
+    //       try_set_marked_atomically().
+    bool m_mark { false };
     bool m_overrides_must_survive_garbage_collection : 1 { false };
+    bool m_young : 1 { false };
+    bool m_remembered : 1 { false };
+    bool m_has_write_barriered_stores : 1 { false };
     State m_state : 1 { State::Live };
 };
 
+// Write barrier for cells declared with JS_WRITE_BARRIERED_CELL: must be called after storing a pointer to `cell` into
+// `owner`, unless it was stored through a GCPtr or NonnullGCPtr assignment.
+ALWAYS_INLINE void write_barrier(Cell const& owner, Cell const& cell)
+{
+    if (!g_generational_collection_enabled) [[likely]]
+        return;
+    if (cell.is_young() && !owner.is_young() && !owner.is_remembered())
+        bit_cast<HeapBase*>(&owner.heap())->remember_cell(owner);
+}
+
+// For stores into `owner` that can't be barriered one by one, e.g. when replacing a whole container.
+ALWAYS_INLINE void write_barrier_for_all_edges(Cell const& owner)
+{
+    if (!g_generational_collection_enabled) [[likely]]
+        return;
+    if (!owner.is_young() && !owner.is_remembered())
+        bit_cast<HeapBase*>(&owner.heap())->remember_cell(owner);
+}
+
 }
 
 template<>
@@ -5,6 +5,7 @@
  */
 
 #include <AK/Badge.h>
+#include <AK/QuickSort.h>
 #include <LibJS/Heap/BlockAllocator.h>
 #include <LibJS/Heap/CellAllocator.h>
 #include <LibJS/Heap/Heap.h>
@@ -12,9 +13,10 @@
 
 namespace JS {
 
-CellAllocator::CellAllocator(size_t cell_size, char const* class_name)
+CellAllocator::CellAllocator(size_t cell_size, char const* class_name, bool cells_can_be_swept_concurrently)
     : m_class_name(class_name)
     , m_cell_size(cell_size)
+    , m_cells_can_be_swept_concurrently(cells_can_be_swept_concurrently)
 {
 }
 
@@ -23,13 +25,12 @@ Cell* CellAllocator::allocate_cell(Heap& heap)
     if (!m_list_node.is_in_list())
         heap.register_cell_allocator({}, *this);
 
+    if (m_usable_blocks.is_empty() && !m_blocks_being_swept.is_empty())
+        heap.did_run_out_of_usable_blocks({}, *this);
+
     if (m_usable_blocks.is_empty()) {
         auto block = HeapBlock::create_with_cell_size(heap, *this, m_cell_size, m_class_name);
-        auto block_ptr = reinterpret_cast<FlatPtr>(block.ptr());
-        if (m_min_block_address > block_ptr)
-            m_min_block_address = block_ptr;
-        if (m_max_block_address < block_ptr)
-            m_max_block_address = block_ptr;
+        heap.did_create_block({}, *block);
         m_usable_blocks.append(*block.leak_ptr());
     }
 
@@ -44,6 +45,12 @@ Cell* CellAllocator::allocate_cell(Heap& heap)
 void CellAllocator::block_did_become_empty(Badge<Heap>, HeapBlock& block)
 {
     block.m_list_node.remove();
+    destroy_block(block);
+}
+
+void CellAllocator::destroy_block(HeapBlock& block)
+{
+    block.heap().will_destroy_block({}, block);
     // NOTE: HeapBlocks are managed by the BlockAllocator, so we don't want to `delete` the block here.
     block.~HeapBlock();
     m_block_allocator.deallocate_block(&block);
@@ -55,4 +62,35 @@ void CellAllocator::block_did_become_usable(Badge<Heap>, HeapBlock& block)
     m_usable_blocks.append(block);
 }
 
+void CellAllocator::block_will_be_swept_concurrently(Badge<Heap>, HeapBlock& block)
+{
+    m_blocks_being_swept.append(block);
+}
+
+void CellAllocator::take_over_swept_blocks(Badge<Heap>)
+{
+    while (auto* block = m_blocks_being_swept.take_first()) {
+        if (!block->live_cell_count())
+            destroy_block(*block);
+        else if (block->is_full())
+            m_full_blocks.append(*block);
+        else
+            m_usable_blocks.append(*block);
+    }
+}
+
+void CellAllocator::compact(Badge<Heap>, size_t cached_blocks_to_keep)
+{
+    Vector<HeapBlock*> usable_blocks;
+    while (auto* block = m_usable_blocks.take_first())
+        usable_blocks.append(block);
+
+    // We allocate from the last usable block, so the fullest one goes last.
+    quick_sort(usable_blocks, [](auto* a, auto* b) { return a->live_cell_count() < b->live_cell_count(); });
+    for (auto* block : usable_blocks)
+        m_usable_blocks.append(*block);
+
+    m_block_allocator.decommit_cached_blocks_above(cached_blocks_to_keep);
+}
+
 }
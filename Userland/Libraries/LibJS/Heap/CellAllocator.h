@@ -23,11 +23,15 @@ namespace JS {
 
 class CellAllocator {
 public:
-    CellAllocator(size_t cell_size, char const* class_name = nullptr);
+    CellAllocator(size_t cell_size, char const* class_name = nullptr, bool cells_can_be_swept_concurrently = false);
     ~CellAllocator() = default;
 
     size_t cell_size() const { return m_cell_size; }
 
+    // Whether the dead cells in this allocator's blocks may be destroyed off the main thread, see
+    // JS_CONCURRENTLY_SWEPT_CELL. Only type-isolating allocators can know this.
+    bool cells_can_be_swept_concurrently() const { return m_cells_can_be_swept_concurrently; }
+
     Cell* allocate_cell(Heap&);
 
     template<typename Callback>
@@ -41,30 +45,43 @@ public:
             if (callback(block) == IterationDecision::Break)
                 return IterationDecision::Break;
         }
+        for (auto& block : m_blocks_being_swept) {
+            if (callback(block) == IterationDecision::Break)
+                return IterationDecision::Break;
+        }
         return IterationDecision::Continue;
     }
 
     void block_did_become_empty(Badge<Heap>, HeapBlock&);
     void block_did_become_usable(Badge<Heap>, HeapBlock&);
 
+    // Blocks handed to the background sweeper are parked here, and not allocated from, until the sweep is done. Blocks
+    // in which the sweeper freed every cell are destroyed when they are taken over.
+    void block_will_be_swept_concurrently(Badge<Heap>, HeapBlock&);
+    void take_over_swept_blocks(Badge<Heap>);
+
+    // Orders the usable blocks so that the fullest ones are allocated from first, which lets sparsely populated
+    // blocks drain and be freed, and gives the memory of cached free blocks past `cached_blocks_to_keep` back to the OS.
+    void compact(Badge<Heap>, size_t cached_blocks_to_keep);
+
     IntrusiveListNode<CellAllocator> m_list_node;
     using List = IntrusiveList<&CellAllocator::m_list_node>;
 
     BlockAllocator& block_allocator() { return m_block_allocator; }
-    FlatPtr min_block_address() const { return m_min_block_address; }
-    FlatPtr max_block_address() const { return m_max_block_address; }
 
 private:
+    void destroy_block(HeapBlock&);
+
     char const* const m_class_name { nullptr };
     size_t const m_cell_size;
+    bool const m_cells_can_be_swept_concurrently { false };
 
     BlockAllocator m_block_allocator;
 
     using BlockList = IntrusiveList<&HeapBlock::m_list_node>;
     BlockList m_full_blocks;
     BlockList m_usable_blocks;
-    FlatPtr m_min_block_address { explode_byte(0xff) };
-    FlatPtr m_max_block_address { 0 };
+    BlockList m_blocks_being_swept;
 };
 
 template<typename T>
@@ -73,7 +90,7 @@ public:
     using CellType = T;
 
     TypeIsolatingCellAllocator(char const* class_name)
-        : allocator(sizeof(T), class_name)
+        : allocator(sizeof(T), class_name, CanBeSweptConcurrently<T>)
     {
     }
 
@@ -8,6 +8,7 @@
 
 #include <AK/Traits.h>
 #include <AK/Types.h>
+#include <LibJS/Heap/Internals.h>
 
 namespace JS {
 
@@ -24,6 +25,17 @@ public:
     {
     }
 
+    // NOTE: Assignments go through the write barrier, but copy construction doesn't, as that is mostly done on the
+    //       stack. Cells that copy GC pointers into containers have to call write_barrier() themselves.
+    NonnullGCPtr(NonnullGCPtr const&) = default;
+
+    NonnullGCPtr& operator=(NonnullGCPtr const& other)
+    {
+        m_ptr = other.m_ptr;
+        write_barrier(this, m_ptr);
+        return *this;
+    }
+
     template<typename U>
     NonnullGCPtr(U& ptr)
     requires(IsConvertible<U*, T*>)
@@ -43,12 +55,14 @@ public:
     requires(IsConvertible<U*, T*>)
     {
         m_ptr = static_cast<T*>(other.ptr());
+        write_barrier(this, m_ptr);
         return *this;
     }
 
     NonnullGCPtr& operator=(T& other)
     {
         m_ptr = &other;
+        write_barrier(this, m_ptr);
         return *this;
     }
 
@@ -57,6 +71,7 @@ public:
     requires(IsConvertible<U*, T*>)
     {
         m_ptr = &static_cast<T&>(other);
+        write_barrier(this, m_ptr);
         return *this;
     }
 
@@ -79,6 +94,16 @@ class GCPtr {
 public:
     constexpr GCPtr() = default;
 
+    GCPtr(GCPtr const&) = default;
+
+    GCPtr& operator=(GCPtr const& other)
+    {
+        m_ptr = other.m_ptr;
+        if (m_ptr)
+            write_barrier(this, m_ptr);
+        return *this;
+    }
+
     GCPtr(T& ptr)
         : m_ptr(&ptr)
     {
@@ -118,12 +143,16 @@ public:
     requires(IsConvertible<U*, T*>)
     {
         m_ptr = static_cast<T*>(other.ptr());
+        if (m_ptr)
+            write_barrier(this, m_ptr);
         return *this;
     }
 
     GCPtr& operator=(NonnullGCPtr<T> const& other)
     {
         m_ptr = other.ptr();
+        if (m_ptr)
+            write_barrier(this, m_ptr);
         return *this;
     }
 
@@ -132,12 +161,15 @@ public:
     requires(IsConvertible<U*, T*>)
     {
         m_ptr = static_cast<T*>(other.ptr());
+        if (m_ptr)
+            write_barrier(this, m_ptr);
         return *this;
     }
 
     GCPtr& operator=(T& other)
     {
         m_ptr = &other;
+        write_barrier(this, m_ptr);
         return *this;
     }
 
@@ -146,12 +178,15 @@ public:
     requires(IsConvertible<U*, T*>)
     {
         m_ptr = &static_cast<T&>(other);
+        write_barrier(this, m_ptr);
         return *this;
     }
 
     GCPtr& operator=(T* other)
     {
         m_ptr = other;
+        if (m_ptr)
+            write_barrier(this, m_ptr);
         return *this;
     }
 
@@ -160,6 +195,8 @@ public:
     requires(IsConvertible<U*, T*>)
     {
         m_ptr = static_cast<T*>(other);
+        if (m_ptr)
+            write_barrier(this, m_ptr);
         return *this;
     }
 
@@ -19,9 +19,14 @@
 #include <LibJS/Heap/Handle.h>
 #include <LibJS/Heap/Heap.h>
 #include <LibJS/Heap/HeapBlock.h>
+#include <LibJS/Heap/HeapBlockIndex.h>
 #include <LibJS/Runtime/Object.h>
+#include <LibJS/Runtime/Shape.h>
 #include <LibJS/Runtime/WeakContainer.h>
 #include <LibJS/SafeFunction.h>
+#include <LibThreading/ConditionVariable.h>
+#include <LibThreading/Mutex.h>
+#include <LibThreading/WorkerThread.h>
 #include <setjmp.h>
 
 #ifdef HAS_ADDRESS_SANITIZER
@@ -34,6 +39,8 @@ namespace JS {
 static __thread HashMap<FlatPtr*, size_t>* s_custom_ranges_for_conservative_scan = nullptr;
 static __thread HashMap<FlatPtr*, SourceLocation*>* s_safe_function_locations = nullptr;
 
+bool g_generational_collection_enabled { false };
+
 Heap::Heap(VM& vm)
     : HeapBase(vm)
 {
@@ -52,6 +59,7 @@ Heap::~Heap()
     vm().string_cache().clear();
     vm().byte_string_cache().clear();
     collect_garbage(CollectionType::CollectEverything);
+    finish_concurrent_sweeping();
 }
 
 void Heap::will_allocate(size_t size)
@@ -62,58 +70,35 @@ void Heap::will_allocate(size_t size)
     } else if (m_allocated_bytes_since_last_gc + size > m_gc_bytes_threshold) {
         m_allocated_bytes_since_last_gc = 0;
         collect_garbage();
+    } else if (m_generational_collection_enabled && m_young_generation_bytes + size > YOUNG_GENERATION_BYTES_THRESHOLD) {
+        m_young_generation_bytes = 0;
+        collect_garbage(CollectionType::CollectYoungGeneration);
     }
 
     m_allocated_bytes_since_last_gc += size;
+    m_young_generation_bytes += size;
 }
 
-static void add_possible_value(HashMap<FlatPtr, HeapRoot>& possible_pointers, FlatPtr data, HeapRoot origin, FlatPtr min_block_address, FlatPtr max_block_address)
+// Calls `callback` with the cell that `data` may point into, if any, without allocating.
+template<typename Callback>
+ALWAYS_INLINE static void for_cell_at_possible_pointer(HeapBlockIndex const& live_blocks, FlatPtr data, Callback callback)
 {
     if constexpr (sizeof(FlatPtr*) == sizeof(Value)) {
         // Because Value stores pointers in non-canonical form we have to check if the top bytes
         // match any pointer-backed tag, in that case we have to extract the pointer to its
         // canonical form and add that as a possible pointer.
-        FlatPtr possible_pointer;
         if ((data & SHIFTED_IS_CELL_PATTERN) == SHIFTED_IS_CELL_PATTERN)
-            possible_pointer = Value::extract_pointer_bits(data);
-        else
-            possible_pointer = data;
-        if (possible_pointer < min_block_address || possible_pointer > max_block_address)
-            return;
-        possible_pointers.set(possible_pointer, move(origin));
+            data = Value::extract_pointer_bits(data);
     } else {
+        // In the 32-bit case we will look at the top and bottom part of Value separately,
+        // so each half is a possible pointer on its own.
         static_assert((sizeof(Value) % sizeof(FlatPtr*)) == 0);
-        if (data < min_block_address || data > max_block_address)
-            return;
-        // In the 32-bit case we will look at the top and bottom part of Value separately we just
-        // add both the upper and lower bytes as possible pointers.
-        possible_pointers.set(data, move(origin));
-    }
-}
-
-void Heap::find_min_and_max_block_addresses(FlatPtr& min_address, FlatPtr& max_address)
-{
-    min_address = explode_byte(0xff);
-    max_address = 0;
-    for (auto& allocator : m_all_cell_allocators) {
-        min_address = min(min_address, allocator.min_block_address());
-        max_address = max(max_address, allocator.max_block_address() + HeapBlockBase::block_size);
-    }
-}
-
-template<typename Callback>
-static void for_each_cell_among_possible_pointers(HashTable<HeapBlock*> const& all_live_heap_blocks, HashMap<FlatPtr, HeapRoot>& possible_pointers, Callback callback)
-{
-    for (auto possible_pointer : possible_pointers.keys()) {
-        if (!possible_pointer)
-            continue;
-        auto* possible_heap_block = HeapBlock::from_cell(reinterpret_cast<Cell const*>(possible_pointer));
-        if (!all_live_heap_blocks.contains(possible_heap_block))
-            continue;
-        if (auto* cell = possible_heap_block->cell_from_possible_pointer(possible_pointer)) {
-            callback(cell, possible_pointer);
-        }
     }
+    auto* block = live_blocks.block_containing(data);
+    if (!block)
+        return;
+    if (auto* cell = block->cell_from_possible_pointer(data))
+        callback(cell);
 }
 
 class GraphConstructorVisitor final : public Cell::Visitor {
@@ -121,12 +106,6 @@ public:
     explicit GraphConstructorVisitor(Heap& heap, HashMap<Cell*, HeapRoot> const& roots)
         : m_heap(heap)
     {
-        m_heap.find_min_and_max_block_addresses(m_min_block_address, m_max_block_address);
-        m_heap.for_each_block([&](auto& block) {
-            m_all_live_heap_blocks.set(&block);
-            return IterationDecision::Continue;
-        });
-
         for (auto& [root, root_origin] : roots) {
             auto& graph_node = m_graph.ensure(bit_cast<FlatPtr>(root));
             graph_node.class_name = root->class_name();
@@ -149,20 +128,17 @@ public:
 
     virtual void visit_possible_values(ReadonlyBytes bytes) override
     {
-        HashMap<FlatPtr, HeapRoot> possible_pointers;
-
         auto* raw_pointer_sized_values = reinterpret_cast<FlatPtr const*>(bytes.data());
-        for (size_t i = 0; i < (bytes.size() / sizeof(FlatPtr)); ++i)
-            add_possible_value(possible_pointers, raw_pointer_sized_values[i], HeapRoot { .type = HeapRoot::Type::HeapFunctionCapturedPointer }, m_min_block_address, m_max_block_address);
-
-        for_each_cell_among_possible_pointers(m_all_live_heap_blocks, possible_pointers, [&](Cell* cell, FlatPtr) {
-            if (m_node_being_visited)
-                m_node_being_visited->edges.set(reinterpret_cast<FlatPtr>(&cell));
-
-            if (m_graph.get(reinterpret_cast<FlatPtr>(&cell)).has_value())
-                return;
-            m_work_queue.append(*cell);
-        });
+        for (size_t i = 0; i < (bytes.size() / sizeof(FlatPtr)); ++i) {
+            for_cell_at_possible_pointer(m_heap.m_live_block_index, raw_pointer_sized_values[i], [&](Cell* cell) {
+                if (m_node_being_visited)
+                    m_node_being_visited->edges.set(reinterpret_cast<FlatPtr>(&cell));
+
+                if (m_graph.get(reinterpret_cast<FlatPtr>(&cell)).has_value())
+                    return;
+                m_work_queue.append(*cell);
+            });
+        }
     }
 
     void visit_all_cells()
@@ -232,13 +208,12 @@ private:
     HashMap<FlatPtr, GraphNode> m_graph;
 
     Heap& m_heap;
-    HashTable<HeapBlock*> m_all_live_heap_blocks;
-    FlatPtr m_min_block_address;
-    FlatPtr m_max_block_address;
 };
 
 AK::JsonObject Heap::dump_graph()
 {
+    finish_concurrent_sweeping();
+
     HashMap<Cell*, HeapRoot> roots;
     gather_roots(roots);
     GraphConstructorVisitor visitor(*this, roots);
@@ -255,15 +230,25 @@ void Heap::collect_garbage(CollectionType collection_type, bool print_report)
     if (print_report)
         collection_measurement_timer.start();
 
-    if (collection_type == CollectionType::CollectGarbage) {
+    // The sweeper must be done with the blocks of the previous collection before we look at any mark bits.
+    finish_concurrent_sweeping();
+
+    if (collection_type == CollectionType::CollectGarbage || collection_type == CollectionType::CollectYoungGeneration) {
         if (m_gc_deferrals) {
             m_should_gc_when_deferral_ends = true;
             return;
         }
         HashMap<Cell*, HeapRoot> roots;
         gather_roots(roots);
+        if (collection_type == CollectionType::CollectYoungGeneration) {
+            mark_young_cells(roots);
+            finalize_unmarked_young_cells();
+            sweep_dead_young_cells(print_report, collection_measurement_timer);
+            return;
+        }
         mark_live_cells(roots);
     }
+    forget_remembered_cells();
     finalize_unmarked_cells();
     sweep_dead_cells(print_report, collection_measurement_timer);
 }
@@ -287,7 +272,7 @@ void Heap::gather_roots(HashMap<Cell*, HeapRoot>& roots)
 }
 
 #ifdef HAS_ADDRESS_SANITIZER
-NO_SANITIZE_ADDRESS void Heap::gather_asan_fake_stack_roots(HashMap<FlatPtr, HeapRoot>& possible_pointers, FlatPtr addr, FlatPtr min_block_address, FlatPtr max_block_address)
+NO_SANITIZE_ADDRESS void Heap::gather_asan_fake_stack_roots(HashMap<Cell*, HeapRoot>& roots, FlatPtr addr)
 {
     void* begin = nullptr;
     void* end = nullptr;
@@ -298,16 +283,28 @@ NO_SANITIZE_ADDRESS void Heap::gather_asan_fake_stack_roots(HashMap<FlatPtr, Hea
             void const* real_address = *real_stack_addr;
             if (real_address == nullptr)
                 continue;
-            add_possible_value(possible_pointers, reinterpret_cast<FlatPtr>(real_address), HeapRoot { .type = HeapRoot::Type::StackPointer }, min_block_address, max_block_address);
+            add_possible_root(roots, reinterpret_cast<FlatPtr>(real_address), HeapRoot { .type = HeapRoot::Type::StackPointer });
         }
     }
 }
 #else
-void Heap::gather_asan_fake_stack_roots(HashMap<FlatPtr, HeapRoot>&, FlatPtr, FlatPtr, FlatPtr)
+void Heap::gather_asan_fake_stack_roots(HashMap<Cell*, HeapRoot>&, FlatPtr)
 {
 }
 #endif
 
+ALWAYS_INLINE void Heap::add_possible_root(HashMap<Cell*, HeapRoot>& roots, FlatPtr data, HeapRoot origin)
+{
+    for_cell_at_possible_pointer(m_live_block_index, data, [&](Cell* cell) {
+        if (cell->state() == Cell::State::Live) {
+            dbgln_if(HEAP_DEBUG, "  ?-> {}", (void const*)cell);
+            roots.set(cell, move(origin));
+        } else {
+            dbgln_if(HEAP_DEBUG, "  #-> {}", (void const*)cell);
+        }
+    });
+}
+
 NO_SANITIZE_ADDRESS void Heap::gather_conservative_roots(HashMap<Cell*, HeapRoot>& roots)
 {
     FlatPtr dummy;
@@ -317,23 +314,18 @@ NO_SANITIZE_ADDRESS void Heap::gather_conservative_roots(HashMap<Cell*, HeapRoot
     jmp_buf buf;
     setjmp(buf);
 
-    HashMap<FlatPtr, HeapRoot> possible_pointers;
-
     auto* raw_jmp_buf = reinterpret_cast<FlatPtr const*>(buf);
 
-    FlatPtr min_block_address, max_block_address;
-    find_min_and_max_block_addresses(min_block_address, max_block_address);
-
     for (size_t i = 0; i < ((size_t)sizeof(buf)) / sizeof(FlatPtr); ++i)
-        add_possible_value(possible_pointers, raw_jmp_buf[i], HeapRoot { .type = HeapRoot::Type::RegisterPointer }, min_block_address, max_block_address);
+        add_possible_root(roots, raw_jmp_buf[i], HeapRoot { .type = HeapRoot::Type::RegisterPointer });
 
     auto stack_reference = bit_cast<FlatPtr>(&dummy);
     auto& stack_info = m_vm.stack_info();
 
     for (FlatPtr stack_address = stack_reference; stack_address < stack_info.top(); stack_address += sizeof(FlatPtr)) {
         auto data = *reinterpret_cast<FlatPtr*>(stack_address);
-        add_possible_value(possible_pointers, data, HeapRoot { .type = HeapRoot::Type::StackPointer }, min_block_address, max_block_address);
-        gather_asan_fake_stack_roots(possible_pointers, data, min_block_address, max_block_address);
+        add_possible_root(roots, data, HeapRoot { .type = HeapRoot::Type::StackPointer });
+        gather_asan_fake_stack_roots(roots, data);
     }
 
     // NOTE: If we have any custom ranges registered, scan those as well.
@@ -342,90 +334,200 @@ NO_SANITIZE_ADDRESS void Heap::gather_conservative_roots(HashMap<Cell*, HeapRoot
         for (auto& custom_range : *s_custom_ranges_for_conservative_scan) {
             for (size_t i = 0; i < (custom_range.value / sizeof(FlatPtr)); ++i) {
                 auto safe_function_location = s_safe_function_locations->get(custom_range.key);
-                add_possible_value(possible_pointers, custom_range.key[i], HeapRoot { .type = HeapRoot::Type::SafeFunction, .location = *safe_function_location }, min_block_address, max_block_address);
+                add_possible_root(roots, custom_range.key[i], HeapRoot { .type = HeapRoot::Type::SafeFunction, .location = *safe_function_location });
             }
         }
     }
 
     for (auto& vector : m_conservative_vectors) {
         for (auto possible_value : vector.possible_values()) {
-            add_possible_value(possible_pointers, possible_value, HeapRoot { .type = HeapRoot::Type::ConservativeVector }, min_block_address, max_block_address);
+            add_possible_root(roots, possible_value, HeapRoot { .type = HeapRoot::Type::ConservativeVector });
         }
     }
+}
 
-    HashTable<HeapBlock*> all_live_heap_blocks;
-    for_each_block([&](auto& block) {
-        all_live_heap_blocks.set(&block);
-        return IterationDecision::Continue;
-    });
+// Shared by the threads of a parallel marking phase. Threads that run out of work wait here for busy threads to
+// donate part of their mark stack. Marking is done once every thread is waiting and there is nothing left to take.
+class ParallelMarkingState {
+    AK_MAKE_NONCOPYABLE(ParallelMarkingState);
+    AK_MAKE_NONMOVABLE(ParallelMarkingState);
 
-    for_each_cell_among_possible_pointers(all_live_heap_blocks, possible_pointers, [&](Cell* cell, FlatPtr possible_pointer) {
-        if (cell->state() == Cell::State::Live) {
-            dbgln_if(HEAP_DEBUG, "  ?-> {}", (void const*)cell);
-            roots.set(cell, *possible_pointers.get(possible_pointer));
-        } else {
-            dbgln_if(HEAP_DEBUG, "  #-> {}", (void const*)cell);
+public:
+    explicit ParallelMarkingState(size_t thread_count)
+        : m_thread_count(thread_count)
+    {
+    }
+
+    bool has_waiting_threads() const { return m_has_waiting_threads.load(AK::MemoryOrder::memory_order_relaxed); }
+
+    void donate(Vector<NonnullGCPtr<Cell>>&& segment)
+    {
+        Threading::MutexLocker locker(m_mutex);
+        m_segments.append(move(segment));
+        m_has_waiting_threads.store(false, AK::MemoryOrder::memory_order_relaxed);
+        m_condition.signal();
+    }
+
+    // Returns false when marking is done.
+    bool take(Vector<NonnullGCPtr<Cell>>& work_queue)
+    {
+        Threading::MutexLocker locker(m_mutex);
+        ++m_waiting_thread_count;
+        while (m_segments.is_empty()) {
+            if (m_waiting_thread_count == m_thread_count) {
+                m_condition.broadcast();
+                return false;
+            }
+            m_has_waiting_threads.store(true, AK::MemoryOrder::memory_order_relaxed);
+            m_condition.wait();
         }
-    });
-}
+        --m_waiting_thread_count;
+        work_queue = m_segments.take_last();
+        m_has_waiting_threads.store(m_waiting_thread_count > 0, AK::MemoryOrder::memory_order_relaxed);
+        return true;
+    }
+
+private:
+    Threading::Mutex m_mutex;
+    Threading::ConditionVariable m_condition { m_mutex };
+    Vector<Vector<NonnullGCPtr<Cell>>> m_segments;
+    size_t const m_thread_count;
+    size_t m_waiting_thread_count { 0 };
+    Atomic<bool> m_has_waiting_threads { false };
+};
 
 class MarkingVisitor final : public Cell::Visitor {
 public:
-    explicit MarkingVisitor(Heap& heap, HashMap<Cell*, HeapRoot> const& roots)
+    enum class Mode {
+        AllCells,
+        YoungCellsOnly,
+    };
+
+    explicit MarkingVisitor(Heap& heap, HashMap<Cell*, HeapRoot> const& roots, Mode mode = Mode::AllCells)
         : m_heap(heap)
+        , m_mode(mode)
     {
-        m_heap.find_min_and_max_block_addresses(m_min_block_address, m_max_block_address);
-        m_heap.for_each_block([&](auto& block) {
-            m_all_live_heap_blocks.set(&block);
-            return IterationDecision::Continue;
-        });
-
         for (auto* root : roots.keys()) {
             visit(root);
         }
     }
 
+    // Helper visitor for a parallel marking phase.
+    MarkingVisitor(MarkingVisitor const& main_visitor, ParallelMarkingState& parallel_marking_state)
+        : m_heap(main_visitor.m_heap)
+        , m_mode(main_visitor.m_mode)
+        , m_parallel_marking_state(&parallel_marking_state)
+    {
+    }
+
     virtual void visit_impl(Cell& cell) override
     {
-        if (cell.is_marked())
+        // Old cells are assumed to be live during a young generation collection.
+        if (m_mode == Mode::YoungCellsOnly && !cell.is_young())
+            return;
+        if (!mark(cell))
             return;
         dbgln_if(HEAP_DEBUG, "  ! {}", &cell);
 
-        cell.set_marked(true);
         m_work_queue.append(cell);
     }
 
     virtual void visit_possible_values(ReadonlyBytes bytes) override
     {
-        HashMap<FlatPtr, HeapRoot> possible_pointers;
-
         auto* raw_pointer_sized_values = reinterpret_cast<FlatPtr const*>(bytes.data());
-        for (size_t i = 0; i < (bytes.size() / sizeof(FlatPtr)); ++i)
-            add_possible_value(possible_pointers, raw_pointer_sized_values[i], HeapRoot { .type = HeapRoot::Type::HeapFunctionCapturedPointer }, m_min_block_address, m_max_block_address);
+        for (size_t i = 0; i < (bytes.size() / sizeof(FlatPtr)); ++i) {
+            for_cell_at_possible_pointer(m_heap.m_live_block_index, raw_pointer_sized_values[i], [&](Cell* cell) {
+                if (cell->state() != Cell::State::Live)
+                    return;
+                if (m_mode == Mode::YoungCellsOnly && !cell->is_young())
+                    return;
+                if (!mark(*cell))
+                    return;
+                m_work_queue.append(*cell);
+            });
+        }
+    }
 
-        for_each_cell_among_possible_pointers(m_all_live_heap_blocks, possible_pointers, [&](Cell* cell, FlatPtr) {
-            if (cell->is_marked())
-                return;
-            if (cell->state() != Cell::State::Live)
+    void mark_all_live_cells()
+    {
+        while (true) {
+            while (!m_work_queue.is_empty()) {
+                m_work_queue.take_last()->visit_edges(*this);
+                if (m_parallel_marking_state && m_parallel_marking_state->has_waiting_threads())
+                    donate_work();
+            }
+            if (!m_parallel_marking_state || !m_parallel_marking_state->take(m_work_queue))
                 return;
-            cell->set_marked(true);
-            m_work_queue.append(*cell);
-        });
+        }
     }
 
-    void mark_all_live_cells()
+    void mark_all_live_cells_in_parallel(Vector<NonnullOwnPtr<Threading::WorkerThread<AK::Error>>>& helper_threads)
     {
-        while (!m_work_queue.is_empty()) {
-            m_work_queue.take_last()->visit_edges(*this);
+        ParallelMarkingState parallel_marking_state(helper_threads.size() + 1);
+        m_parallel_marking_state = &parallel_marking_state;
+
+        for (auto& thread : helper_threads) {
+            thread->start_task([&]() -> ErrorOr<void> {
+                MarkingVisitor helper_visitor(*this, parallel_marking_state);
+                helper_visitor.mark_all_live_cells();
+                return {};
+            });
         }
+
+        mark_all_live_cells();
+
+        for (auto& thread : helper_threads)
+            MUST(thread->wait_until_task_is_finished());
+
+        m_parallel_marking_state = nullptr;
+    }
+
+    Cell* live_cell_containing_address(FlatPtr address)
+    {
+        auto* block = m_heap.m_live_block_index.block_containing(address);
+        if (!block)
+            return nullptr;
+        auto* cell = block->cell_from_possible_pointer(address);
+        if (!cell || cell->state() != Cell::State::Live)
+            return nullptr;
+        return cell;
     }
 
 private:
+    // Returns true if the cell was unmarked, i.e. this visitor is responsible for visiting its edges.
+    ALWAYS_INLINE bool mark(Cell& cell)
+    {
+        if (m_parallel_marking_state) [[unlikely]] {
+            if (!cell.try_set_marked_atomically())
+                return false;
+            HeapBlock::from_cell(&cell)->did_mark_cell_atomically();
+            return true;
+        }
+        if (cell.is_marked())
+            return false;
+        cell.set_marked(true);
+        HeapBlock::from_cell(&cell)->did_mark_cell();
+        return true;
+    }
+
+    void donate_work()
+    {
+        if (m_work_queue.size() < 2)
+            return;
+        // NOTE: We move cells one by one (rather than removing a slice) so that no GC pointers are assigned to,
+        //       as that would run the write barrier on this thread.
+        Vector<NonnullGCPtr<Cell>> segment;
+        auto donated_cell_count = m_work_queue.size() / 2;
+        segment.ensure_capacity(donated_cell_count);
+        for (size_t i = 0; i < donated_cell_count; ++i)
+            segment.unchecked_append(m_work_queue.take_last());
+        m_parallel_marking_state->donate(move(segment));
+    }
+
     Heap& m_heap;
+    Mode m_mode { Mode::AllCells };
+    ParallelMarkingState* m_parallel_marking_state { nullptr };
     Vector<NonnullGCPtr<Cell>> m_work_queue;
-    HashTable<HeapBlock*> m_all_live_heap_blocks;
-    FlatPtr m_min_block_address;
-    FlatPtr m_max_block_address;
 };
 
 void Heap::mark_live_cells(HashMap<Cell*, HeapRoot> const& roots)
@@ -434,14 +536,317 @@ void Heap::mark_live_cells(HashMap<Cell*, HeapRoot> const& roots)
 
     MarkingVisitor visitor(*this, roots);
 
-    visitor.mark_all_live_cells();
+    if (m_marking_threads.is_empty())
+        visitor.mark_all_live_cells();
+    else
+        visitor.mark_all_live_cells_in_parallel(m_marking_threads);
+
+    unmark_uprooted_cells();
+}
 
-    for (auto& inverse_root : m_uprooted_cells)
+void Heap::unmark_uprooted_cells()
+{
+    for (auto& inverse_root : m_uprooted_cells) {
+        if (!inverse_root->is_marked())
+            continue;
         inverse_root->set_marked(false);
+        HeapBlock::from_cell(inverse_root.ptr())->did_unmark_cell();
+    }
 
     m_uprooted_cells.clear();
 }
 
+void Heap::set_parallel_marking_thread_count(size_t thread_count)
+{
+    if (m_marking_threads.size() > thread_count)
+        m_marking_threads.shrink(thread_count);
+    while (m_marking_threads.size() < thread_count)
+        m_marking_threads.append(MUST(Threading::WorkerThread<AK::Error>::create("GC marking"sv)));
+}
+
+void Heap::set_concurrent_sweeping_enabled(bool enabled)
+{
+    m_concurrent_sweeping_enabled = enabled;
+    if (!enabled) {
+        finish_concurrent_sweeping();
+        m_sweeping_thread = nullptr;
+    }
+}
+
+// Clears the marks of the cells that survived and destroys the others. This runs on the background sweeping thread, so
+// any dead cells in the block must be of a class declared with JS_CONCURRENTLY_SWEPT_CELL.
+static void sweep_block_concurrently(HeapBlock& block)
+{
+    block.for_each_cell_in_state<Cell::State::Live>([&](Cell* cell) {
+        if (cell->is_marked())
+            cell->set_marked(false);
+        else
+            block.deallocate(cell);
+    });
+    block.did_unmark_all_cells();
+}
+
+void Heap::sweep_blocks_concurrently(Vector<HeapBlock*>&& blocks)
+{
+    VERIFY(m_blocks_being_swept.is_empty());
+
+    if (!m_sweeping_thread)
+        m_sweeping_thread = MUST(Threading::WorkerThread<AK::Error>::create("GC sweeping"sv));
+
+    for (auto* block : blocks)
+        block->cell_allocator().block_will_be_swept_concurrently({}, *block);
+    m_blocks_being_swept = move(blocks);
+
+    dbgln_if(HEAP_DEBUG, "sweep_blocks_concurrently: {} blocks", m_blocks_being_swept.size());
+
+    m_concurrent_sweeping_in_progress.store(true, AK::MemoryOrder::memory_order_relaxed);
+    m_sweeping_thread->start_task([this]() -> ErrorOr<void> {
+        for (auto* block : m_blocks_being_swept)
+            sweep_block_concurrently(*block);
+        m_concurrent_sweeping_in_progress.store(false, AK::MemoryOrder::memory_order_release);
+        return {};
+    });
+}
+
+void Heap::finish_concurrent_sweeping()
+{
+    if (m_blocks_being_swept.is_empty())
+        return;
+
+    MUST(m_sweeping_thread->wait_until_task_is_finished());
+    m_blocks_being_swept.clear();
+
+    for (auto& allocator : m_all_cell_allocators)
+        allocator.take_over_swept_blocks({});
+}
+
+void Heap::did_run_out_of_usable_blocks(Badge<CellAllocator>, CellAllocator& allocator)
+{
+    // Rather than waiting for the sweeper, the allocator will just create a new block if it isn't done yet.
+    if (m_concurrent_sweeping_in_progress.load(AK::MemoryOrder::memory_order_acquire))
+        return;
+    allocator.take_over_swept_blocks({});
+}
+
+void Heap::set_generational_collection_enabled(bool enabled)
+{
+    if (m_generational_collection_enabled == enabled)
+        return;
+    m_generational_collection_enabled = enabled;
+
+    if (enabled) {
+        g_generational_collection_enabled = true;
+        finish_concurrent_sweeping();
+
+        // Every cell that already exists is old, so the ones without write barriers have to be visited by young
+        // collections from now on.
+        for_each_block([&](auto& block) {
+            block.template for_each_cell_in_state<Cell::State::Live>([&](Cell* cell) {
+                if (cell->has_write_barriered_stores())
+                    return;
+                cell->set_remembered(true);
+                m_old_cells_without_write_barriers.append(*cell);
+            });
+            return IterationDecision::Continue;
+        });
+        return;
+    }
+
+    for (auto& cell : m_remembered_cells)
+        cell->set_remembered(false);
+    m_remembered_cells.clear();
+    for (auto& cell : m_old_cells_without_write_barriers)
+        cell->set_remembered(false);
+    m_old_cells_without_write_barriers.clear();
+}
+
+void HeapBase::remember_cell(Cell const& cell)
+{
+    static_cast<Heap&>(*this).remember_cell({}, const_cast<Cell&>(cell));
+}
+
+void Heap::remember_cell(Badge<HeapBase>, Cell& cell)
+{
+    // Cells without write barriers are remembered for good as soon as they are old, see did_promote_cell().
+    if (!m_generational_collection_enabled || cell.is_young() || cell.is_remembered() || !cell.has_write_barriered_stores())
+        return;
+    cell.set_remembered(true);
+    m_remembered_cells.append(cell);
+}
+
+void HeapBase::write_barrier_slow_path(void const* slot, void const* cell)
+{
+    static_cast<Heap&>(*this).did_store_into_slot({}, slot, cell);
+}
+
+void Heap::did_store_into_slot(Badge<HeapBase>, void const* slot, void const* cell)
+{
+    auto* stored_cell = HeapBlock::from_cell(static_cast<Cell const*>(cell))->cell_from_possible_pointer(bit_cast<FlatPtr>(cell));
+    if (!stored_cell || !stored_cell->is_young())
+        return;
+
+    // Slots outside of our blocks are either roots (the stack, handles, etc.), which every collection visits, or
+    // belong to containers of cells that have to call write_barrier() themselves.
+    auto* block = m_live_block_index.block_containing(bit_cast<FlatPtr>(slot));
+    if (!block)
+        return;
+    auto* owner = block->cell_from_possible_pointer(bit_cast<FlatPtr>(slot));
+    if (!owner || owner->state() != Cell::State::Live)
+        return;
+    HeapBase::remember_cell(*owner);
+}
+
+void Heap::mark_young_cells(HashMap<Cell*, HeapRoot> const& roots)
+{
+    dbgln_if(HEAP_DEBUG, "mark_young_cells:");
+
+    MarkingVisitor visitor(*this, roots, MarkingVisitor::Mode::YoungCellsOnly);
+
+    // Old cells are never traced through, so the young cells they point to are found by visiting the edges of the
+    // remembered ones only: those that were stored into since the last collection, and those without write barriers.
+    for (auto& cell : m_remembered_cells) {
+        cell->set_remembered(false);
+        cell->visit_edges(visitor);
+    }
+    for (auto& cell : m_old_cells_without_write_barriers)
+        cell->visit_edges(visitor);
+
+    dbgln_if(HEAP_DEBUG, "  visited the edges of {} remembered and {} unbarriered old cells", m_remembered_cells.size(), m_old_cells_without_write_barriers.size());
+
+    // After this collection, every surviving cell is old, so no old cell points to a young one anymore.
+    m_remembered_cells.clear();
+
+    visitor.mark_all_live_cells();
+
+    unmark_uprooted_cells();
+}
+
+void Heap::forget_remembered_cells()
+{
+    for (auto& cell : m_remembered_cells)
+        cell->set_remembered(false);
+    m_remembered_cells.clear();
+
+    // Must be called before sweeping, while the mark bits still tell which cells are about to die.
+    m_old_cells_without_write_barriers.remove_all_matching([](auto& cell) {
+        return !cell->is_marked() && !cell_must_survive_garbage_collection(*cell);
+    });
+}
+
+void Heap::did_promote_cell(Cell& cell)
+{
+    cell.set_young(false);
+    if (m_generational_collection_enabled && !cell.has_write_barriered_stores()) {
+        cell.set_remembered(true);
+        m_old_cells_without_write_barriers.append(cell);
+    }
+}
+
+void Heap::finalize_unmarked_young_cells()
+{
+    for (auto* block : m_blocks_with_young_cells) {
+        block->for_each_cell_in_state<Cell::State::Live>([](Cell* cell) {
+            if (cell->is_young() && !cell->is_marked() && !cell_must_survive_garbage_collection(*cell))
+                cell->finalize();
+        });
+    }
+}
+
+void Heap::sweep_dead_young_cells(bool print_report, Core::ElapsedTimer const& measurement_timer)
+{
+    dbgln_if(HEAP_DEBUG, "sweep_dead_young_cells:");
+    Vector<HeapBlock*, 32> empty_blocks;
+    Vector<HeapBlock*, 32> full_blocks_that_became_usable;
+
+    size_t collected_cells = 0;
+    size_t promoted_cells = 0;
+    size_t collected_cell_bytes = 0;
+    size_t promoted_cell_bytes = 0;
+
+    for (auto* block : m_blocks_with_young_cells) {
+        block->set_has_young_cells(false);
+        bool block_has_live_cells = false;
+        bool block_was_full = block->is_full();
+        block->for_each_cell_in_state<Cell::State::Live>([&](Cell* cell) {
+            if (!cell->is_young()) {
+                block_has_live_cells = true;
+                return;
+            }
+            if (!cell->is_marked() && !cell_must_survive_garbage_collection(*cell)) {
+                dbgln_if(HEAP_DEBUG, "  ~ {}", cell);
+                block->deallocate(cell);
+                ++collected_cells;
+                collected_cell_bytes += block->cell_size();
+            } else {
+                cell->set_marked(false);
+                did_promote_cell(*cell);
+                block_has_live_cells = true;
+                ++promoted_cells;
+                promoted_cell_bytes += block->cell_size();
+            }
+        });
+        block->did_unmark_all_cells();
+        if (!block_has_live_cells)
+            empty_blocks.append(block);
+        else if (block_was_full != block->is_full())
+            full_blocks_that_became_usable.append(block);
+    }
+    m_blocks_with_young_cells.clear();
+
+    for (auto& weak_container : m_weak_containers)
+        weak_container.remove_dead_cells({});
+
+    for (auto* block : empty_blocks) {
+        dbgln_if(HEAP_DEBUG, " - HeapBlock empty @ {}: cell_size={}", block, block->cell_size());
+        block->cell_allocator().block_did_become_empty({}, *block);
+    }
+
+    for (auto* block : full_blocks_that_became_usable) {
+        dbgln_if(HEAP_DEBUG, " - HeapBlock usable again @ {}: cell_size={}", block, block->cell_size());
+        block->cell_allocator().block_did_become_usable({}, *block);
+    }
+
+    // Only promoted cells count towards the next full collection.
+    m_allocated_bytes_since_last_gc -= min(m_allocated_bytes_since_last_gc, collected_cell_bytes);
+
+    if (print_report) {
+        AK::Duration const time_spent = measurement_timer.elapsed_time();
+
+        dbgln("Young generation collection report");
+        dbgln("=============================================");
+        dbgln("     Time spent: {} ms", time_spent.to_milliseconds());
+        dbgln(" Promoted cells: {} ({} bytes)", promoted_cells, promoted_cell_bytes);
+        dbgln("Collected cells: {} ({} bytes)", collected_cells, collected_cell_bytes);
+        dbgln("   Freed blocks: {} ({} bytes)", empty_blocks.size(), empty_blocks.size() * HeapBlock::block_size);
+        print_shape_statistics();
+        dbgln("=============================================");
+    }
+}
+
+void Heap::print_shape_statistics()
+{
+    auto shapes = shape_statistics();
+    dbgln("         Shapes: {} ({} dictionaries, {} bytes)", shapes.shape_count, shapes.dictionary_shape_count, shapes.shape_bytes);
+    dbgln("Property tables: {} ({} bytes)", shapes.property_table_count, shapes.property_table_bytes);
+    dbgln("    Transitions: {} bytes", shapes.transition_cache_bytes);
+}
+
+ShapeStatistics Heap::shape_statistics()
+{
+    finish_concurrent_sweeping();
+
+    ShapeStatistics statistics;
+    HashTable<PropertyTable const*> seen_property_tables;
+    for_each_block([&](auto& block) {
+        block.template for_each_cell_in_state<Cell::State::Live>([&](Cell* cell) {
+            if (auto* shape = dynamic_cast<Shape*>(cell))
+                shape->add_to_statistics(statistics, seen_property_tables);
+        });
+        return IterationDecision::Continue;
+    });
+    return statistics;
+}
+
 bool Heap::cell_must_survive_garbage_collection(Cell const& cell)
 {
     if (!cell.overrides_must_survive_garbage_collection({}))
@@ -452,6 +857,8 @@ bool Heap::cell_must_survive_garbage_collection(Cell const& cell)
 void Heap::finalize_unmarked_cells()
 {
     for_each_block([&](auto& block) {
+        if (!block.has_unmarked_live_cells())
+            return IterationDecision::Continue;
         block.template for_each_cell_in_state<Cell::State::Live>([](Cell* cell) {
             if (!cell->is_marked() && !cell_must_survive_garbage_collection(*cell))
                 cell->finalize();
@@ -471,7 +878,22 @@ void Heap::sweep_dead_cells(bool print_report, Core::ElapsedTimer const& measure
     size_t collected_cell_bytes = 0;
     size_t live_cell_bytes = 0;
 
+    Vector<HeapBlock*> blocks_to_sweep_concurrently;
+
     for_each_block([&](auto& block) {
+        // Blocks in which every cell survived only need their marks cleared, and the dead cells of some classes can be
+        // destroyed by any thread, so those blocks can be swept off the main thread. The marked cell count tells how
+        // many cells will survive. Blocks with young cells are left to the main thread, which promotes them below.
+        if (m_concurrent_sweeping_enabled && block.live_cell_count() && !block.has_young_cells()
+            && (!block.has_unmarked_live_cells() || block.cell_allocator().cells_can_be_swept_concurrently())) {
+            blocks_to_sweep_concurrently.append(&block);
+            live_cells += block.marked_cell_count();
+            live_cell_bytes += block.marked_cell_count() * block.cell_size();
+            collected_cells += block.live_cell_count() - block.marked_cell_count();
+            collected_cell_bytes += (block.live_cell_count() - block.marked_cell_count()) * block.cell_size();
+            return IterationDecision::Continue;
+        }
+
         bool block_has_live_cells = false;
         bool block_was_full = block.is_full();
         block.template for_each_cell_in_state<Cell::State::Live>([&](Cell* cell) {
@@ -482,11 +904,14 @@ void Heap::sweep_dead_cells(bool print_report, Core::ElapsedTimer const& measure
                 collected_cell_bytes += block.cell_size();
             } else {
                 cell->set_marked(false);
+                if (cell->is_young())
+                    did_promote_cell(*cell);
                 block_has_live_cells = true;
                 ++live_cells;
                 live_cell_bytes += block.cell_size();
             }
         });
+        block.did_unmark_all_cells();
         if (!block_has_live_cells)
             empty_blocks.append(&block);
         else if (block_was_full != block.is_full())
@@ -494,6 +919,25 @@ void Heap::sweep_dead_cells(bool print_report, Core::ElapsedTimer const& measure
         return IterationDecision::Continue;
     });
 
+    if (blocks_to_sweep_concurrently.size() >= CONCURRENT_SWEEPING_MIN_BLOCK_COUNT) {
+        sweep_blocks_concurrently(move(blocks_to_sweep_concurrently));
+    } else {
+        for (auto* block : blocks_to_sweep_concurrently) {
+            bool block_was_full = block->is_full();
+            sweep_block_concurrently(*block);
+            if (!block->live_cell_count())
+                empty_blocks.append(block);
+            else if (block_was_full != block->is_full())
+                full_blocks_that_became_usable.append(block);
+        }
+    }
+
+    // A full collection promotes every surviving cell.
+    for (auto* block : m_blocks_with_young_cells)
+        block->set_has_young_cells(false);
+    m_blocks_with_young_cells.clear();
+    m_young_generation_bytes = 0;
+
     for (auto& weak_container : m_weak_containers)
         weak_container.remove_dead_cells({});
 
@@ -514,6 +958,9 @@ void Heap::sweep_dead_cells(bool print_report, Core::ElapsedTimer const& measure
         });
     }
 
+    if (m_compaction_enabled)
+        compact();
+
     m_gc_bytes_threshold = live_cell_bytes > GC_MIN_BYTES_THRESHOLD ? live_cell_bytes : GC_MIN_BYTES_THRESHOLD;
 
     if (print_report) {
@@ -531,10 +978,18 @@ void Heap::sweep_dead_cells(bool print_report, Core::ElapsedTimer const& measure
         dbgln("Collected cells: {} ({} bytes)", collected_cells, collected_cell_bytes);
         dbgln("    Live blocks: {} ({} bytes)", live_block_count, live_block_count * HeapBlock::block_size);
         dbgln("   Freed blocks: {} ({} bytes)", empty_blocks.size(), empty_blocks.size() * HeapBlock::block_size);
+        print_shape_statistics();
         dbgln("=============================================");
     }
 }
 
+void Heap::compact()
+{
+    dbgln_if(HEAP_DEBUG, "compact:");
+    for (auto& allocator : m_all_cell_allocators)
+        allocator.compact({}, COMPACTION_CACHED_BLOCKS_HIGH_WATER_MARK);
+}
+
 void Heap::defer_gc()
 {
     ++m_gc_deferrals;
@@ -6,11 +6,13 @@
 
 #pragma once
 
+#include <AK/Atomic.h>
 #include <AK/Badge.h>
 #include <AK/HashTable.h>
 #include <AK/IntrusiveList.h>
 #include <AK/Noncopyable.h>
 #include <AK/NonnullOwnPtr.h>
+#include <AK/OwnPtr.h>
 #include <AK/Types.h>
 #include <AK/Vector.h>
 #include <LibCore/Forward.h>
@@ -19,12 +21,14 @@
 #include <LibJS/Heap/CellAllocator.h>
 #include <LibJS/Heap/ConservativeVector.h>
 #include <LibJS/Heap/Handle.h>
+#include <LibJS/Heap/HeapBlockIndex.h>
 #include <LibJS/Heap/HeapRoot.h>
 #include <LibJS/Heap/Internals.h>
 #include <LibJS/Heap/MarkedVector.h>
 #include <LibJS/Runtime/Completion.h>
 #include <LibJS/Runtime/ExecutionContext.h>
 #include <LibJS/Runtime/WeakContainer.h>
+#include <LibThreading/Forward.h>
 
 namespace JS {
 
@@ -42,6 +46,7 @@ public:
         auto* memory = allocate_cell<T>();
         defer_gc();
         new (memory) T(forward<Args>(args)...);
+        did_construct_cell<T>(*memory);
         undefer_gc();
         return *static_cast<T*>(memory);
     }
@@ -52,6 +57,7 @@ public:
         auto* memory = allocate_cell<T>();
         defer_gc();
         new (memory) T(forward<Args>(args)...);
+        did_construct_cell<T>(*memory);
         undefer_gc();
         auto* cell = static_cast<T*>(memory);
         memory->initialize(realm);
@@ -61,6 +67,7 @@ public:
     enum class CollectionType {
         CollectGarbage,
         CollectEverything,
+        CollectYoungGeneration,
     };
 
     void collect_garbage(CollectionType = CollectionType::CollectGarbage, bool print_report = false);
@@ -69,6 +76,44 @@ public:
     bool should_collect_on_every_allocation() const { return m_should_collect_on_every_allocation; }
     void set_should_collect_on_every_allocation(bool b) { m_should_collect_on_every_allocation = b; }
 
+    // In generational mode, new cells are allocated young and most collections only trace and sweep the young
+    // generation. Old cells are not traced. Instead, the write barrier adds old cells that get a pointer to a young
+    // cell stored into them to the remembered set, and only their edges are visited to find the young cells that
+    // old ones point to. Old cells of classes that aren't declared JS_WRITE_BARRIERED_CELL stay in the remembered set.
+    bool is_generational_collection_enabled() const { return m_generational_collection_enabled; }
+    void set_generational_collection_enabled(bool);
+
+    void remember_cell(Badge<HeapBase>, Cell&);
+    void did_store_into_slot(Badge<HeapBase>, void const* slot, void const* cell);
+
+    // Walks the heap to find out how many shapes there are, and how much memory they and their property tables use.
+    ShapeStatistics shape_statistics();
+
+    // With helper threads, the marking phase of full collections is shared between the main thread and the helpers.
+    // Each thread marks from its own stack, and threads that run out of work steal segments that busy threads donate
+    // to a shared pool.
+    // NOTE: This requires visit_edges() to be safe to call from any thread, which is the case as long as it only
+    //       reads the cell and calls visit().
+    size_t parallel_marking_thread_count() const { return m_marking_threads.size(); }
+    void set_parallel_marking_thread_count(size_t);
+
+    // When enabled, blocks in which every cell survived, and blocks of classes declared with JS_CONCURRENTLY_SWEPT_CELL,
+    // are swept on a background thread: it clears their mark bits and destroys their dead cells, building the blocks'
+    // freelists. Other dead cells are always destroyed on the main thread, as their destructors can run arbitrary code.
+    // The swept blocks are taken back by their CellAllocator when it runs out of usable blocks, or before the next
+    // collection.
+    bool is_concurrent_sweeping_enabled() const { return m_concurrent_sweeping_enabled; }
+    void set_concurrent_sweeping_enabled(bool);
+
+    void did_run_out_of_usable_blocks(Badge<CellAllocator>, CellAllocator&);
+
+    // Cells are never moved, as C++ code holds raw pointers to them and roots are found conservatively. Instead, in
+    // compaction mode, every full collection makes allocation prefer the fullest blocks of each size class, so that
+    // sparsely populated blocks empty out over time, and returns cached free blocks past a small high-water mark to
+    // the OS with MADV_DONTNEED.
+    bool is_compaction_enabled() const { return m_compaction_enabled; }
+    void set_compaction_enabled(bool b) { m_compaction_enabled = b; }
+
     void did_create_handle(Badge<HandleImpl>, HandleImpl&);
     void did_destroy_handle(Badge<HandleImpl>, HandleImpl&);
 
@@ -85,6 +130,8 @@ public:
     void did_destroy_execution_context(Badge<ExecutionContext>, ExecutionContext&);
 
     void register_cell_allocator(Badge<CellAllocator>, CellAllocator&);
+    void did_create_block(Badge<CellAllocator>, HeapBlock&);
+    void will_destroy_block(Badge<CellAllocator>, HeapBlock&);
 
     void uproot_cell(Cell* cell);
 
@@ -112,13 +159,46 @@ private:
 
     void will_allocate(size_t);
 
-    void find_min_and_max_block_addresses(FlatPtr& min_address, FlatPtr& max_address);
     void gather_roots(HashMap<Cell*, HeapRoot>&);
     void gather_conservative_roots(HashMap<Cell*, HeapRoot>&);
-    void gather_asan_fake_stack_roots(HashMap<FlatPtr, HeapRoot>&, FlatPtr, FlatPtr min_block_address, FlatPtr max_block_address);
+    void gather_asan_fake_stack_roots(HashMap<Cell*, HeapRoot>&, FlatPtr);
+    void add_possible_root(HashMap<Cell*, HeapRoot>&, FlatPtr, HeapRoot);
     void mark_live_cells(HashMap<Cell*, HeapRoot> const& live_cells);
+    void unmark_uprooted_cells();
     void finalize_unmarked_cells();
     void sweep_dead_cells(bool print_report, Core::ElapsedTimer const&);
+    void compact();
+
+    void mark_young_cells(HashMap<Cell*, HeapRoot> const& roots);
+    void forget_remembered_cells();
+    void did_promote_cell(Cell&);
+    void finalize_unmarked_young_cells();
+    void sweep_dead_young_cells(bool print_report, Core::ElapsedTimer const&);
+
+    // Shared by the reports of both kinds of collection.
+    void print_shape_statistics();
+
+    void sweep_blocks_concurrently(Vector<HeapBlock*>&&);
+    void finish_concurrent_sweeping();
+
+    template<typename T>
+    ALWAYS_INLINE void did_construct_cell(Cell& cell)
+    {
+        if constexpr (HasWriteBarrieredStores<T>)
+            cell.set_has_write_barriered_stores({});
+        if (m_generational_collection_enabled) [[unlikely]]
+            did_allocate_young_cell(cell);
+    }
+
+    ALWAYS_INLINE void did_allocate_young_cell(Cell& cell)
+    {
+        cell.set_young(true);
+        auto* block = HeapBlock::from_cell(&cell);
+        if (!block->has_young_cells()) {
+            block->set_has_young_cells(true);
+            m_blocks_with_young_cells.append(block);
+        }
+    }
 
     ALWAYS_INLINE CellAllocator& allocator_for_size(size_t cell_size)
     {
@@ -146,9 +226,32 @@ private:
 
     bool m_should_collect_on_every_allocation { false };
 
+    static constexpr size_t YOUNG_GENERATION_BYTES_THRESHOLD { 1 * 1024 * 1024 };
+    size_t m_young_generation_bytes { 0 };
+    bool m_generational_collection_enabled { false };
+    Vector<HeapBlock*> m_blocks_with_young_cells;
+    Vector<NonnullGCPtr<Cell>> m_remembered_cells;
+    Vector<NonnullGCPtr<Cell>> m_old_cells_without_write_barriers;
+
+    Vector<NonnullOwnPtr<Threading::WorkerThread<AK::Error>>> m_marking_threads;
+
+    // Below this many blocks, handing them over to the background thread costs more than sweeping them right away.
+    static constexpr size_t CONCURRENT_SWEEPING_MIN_BLOCK_COUNT { 64 };
+    bool m_concurrent_sweeping_enabled { false };
+    OwnPtr<Threading::WorkerThread<AK::Error>> m_sweeping_thread;
+    Vector<HeapBlock*> m_blocks_being_swept;
+    Atomic<bool> m_concurrent_sweeping_in_progress { false };
+
+    // Number of free blocks each CellAllocator keeps committed for reuse in compaction mode.
+    static constexpr size_t COMPACTION_CACHED_BLOCKS_HIGH_WATER_MARK { 4 };
+    bool m_compaction_enabled { false };
+
     Vector<NonnullOwnPtr<CellAllocator>> m_size_based_cell_allocators;
     CellAllocator::List m_all_cell_allocators;
 
+    // Used to tell whether a possible pointer found by a conservative scan points into one of our blocks.
+    HeapBlockIndex m_live_block_index;
+
     HandleImpl::List m_handles;
     MarkedVectorBase::List m_marked_vectors;
     ConservativeVectorBase::List m_conservative_vectors;
@@ -215,4 +318,14 @@ inline void Heap::register_cell_allocator(Badge<CellAllocator>, CellAllocator& a
     m_all_cell_allocators.append(allocator);
 }
 
+inline void Heap::did_create_block(Badge<CellAllocator>, HeapBlock& block)
+{
+    m_live_block_index.add(block);
+}
+
+inline void Heap::will_destroy_block(Badge<CellAllocator>, HeapBlock& block)
+{
+    m_live_block_index.remove(block);
+}
+
 }
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <AK/Atomic.h>
 #include <AK/IntrusiveList.h>
 #include <AK/Platform.h>
 #include <AK/StringView.h>
@@ -44,12 +45,27 @@ public:
 
         if (allocated_cell) {
             ASAN_UNPOISON_MEMORY_REGION(allocated_cell, m_cell_size);
+            ++m_live_cell_count;
         }
         return allocated_cell;
     }
 
     void deallocate(Cell*);
 
+    // Number of cells that have been allocated and not yet swept.
+    size_t live_cell_count() const { return m_live_cell_count; }
+
+    // Kept up to date by the garbage collector while marking, so that blocks without any unmarked cells can be
+    // recognized without visiting every cell in them.
+    size_t marked_cell_count() const { return m_marked_cell_count; }
+    void did_mark_cell() { ++m_marked_cell_count; }
+    void did_unmark_cell() { --m_marked_cell_count; }
+    void did_unmark_all_cells() { m_marked_cell_count = 0; }
+
+    // For parallel marking, where several threads may mark cells in this block at the same time.
+    void did_mark_cell_atomically() { AK::atomic_fetch_add(&m_marked_cell_count, static_cast<size_t>(1), AK::MemoryOrder::memory_order_relaxed); }
+    bool has_unmarked_live_cells() const { return marked_cell_count() < m_live_cell_count; }
+
     template<typename Callback>
     void for_each_cell(Callback callback)
     {
@@ -111,6 +127,8 @@ private:
     CellAllocator& m_cell_allocator;
     size_t m_cell_size { 0 };
     size_t m_next_lazy_freelist_index { 0 };
+    size_t m_live_cell_count { 0 };
+    size_t m_marked_cell_count { 0 };
     GCPtr<FreelistEntry> m_freelist;
     alignas(__BIGGEST_ALIGNMENT__) u8 m_storage[];
 
@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2026, agent <agent@local>
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/BuiltinWrappers.h>
+#include <LibJS/Heap/HeapBlockIndex.h>
+#include <stdio.h>
+#include <sys/mman.h>
+
+namespace JS {
+
+// User space addresses usually fit in 48 bits on 64-bit platforms. Higher ones go into HeapBlockIndex::m_high_leaves.
+static constexpr size_t address_bits = sizeof(FlatPtr) == 8 ? 48 : 32;
+
+HeapBlockIndex::HeapBlockIndex()
+{
+    VERIFY(is_power_of_two(HeapBlockBase::block_size));
+    m_block_shift = count_trailing_zeroes(HeapBlockBase::block_size);
+    auto block_number_bits = address_bits - m_block_shift;
+    m_top_level_size = block_number_bits > leaf_bits ? 1ull << (block_number_bits - leaf_bits) : 1;
+
+    // NOTE: We mmap the top level so that only the pages covering address ranges we actually use get committed.
+    auto* top_level = mmap(nullptr, m_top_level_size * sizeof(Leaf*), PROT_READ | PROT_WRITE, MAP_ANONYMOUS | MAP_PRIVATE, -1, 0);
+    VERIFY(top_level != MAP_FAILED);
+    m_top_level = static_cast<Leaf**>(top_level);
+}
+
+HeapBlockIndex::~HeapBlockIndex()
+{
+    for (size_t i = 0; i < m_top_level_size; ++i)
+        delete m_top_level[i];
+    if (munmap(m_top_level, m_top_level_size * sizeof(Leaf*)) < 0) {
+        perror("munmap");
+        VERIFY_NOT_REACHED();
+    }
+}
+
+void HeapBlockIndex::add(HeapBlock& block)
+{
+    auto block_number = bit_cast<FlatPtr>(&block) >> m_block_shift;
+    auto top_level_index = block_number >> leaf_bits;
+
+    Leaf* leaf = nullptr;
+    if (top_level_index < m_top_level_size) {
+        auto*& top_level_leaf = m_top_level[top_level_index];
+        if (!top_level_leaf)
+            top_level_leaf = new Leaf;
+        leaf = top_level_leaf;
+    } else {
+        leaf = m_high_leaves.ensure(top_level_index, [] { return make<Leaf>(); }).ptr();
+    }
+
+    auto leaf_index = block_number & (leaf_size - 1);
+    VERIFY(!(leaf->bits[leaf_index / 64] & (1ull << (leaf_index % 64))));
+    leaf->bits[leaf_index / 64] |= 1ull << (leaf_index % 64);
+}
+
+void HeapBlockIndex::remove(HeapBlock& block)
+{
+    auto block_number = bit_cast<FlatPtr>(&block) >> m_block_shift;
+    auto top_level_index = block_number >> leaf_bits;
+    // NOTE: Leaves are kept around when they become empty, as the BlockAllocator is likely to reuse their blocks.
+    Leaf* leaf = nullptr;
+    if (top_level_index < m_top_level_size)
+        leaf = m_top_level[top_level_index];
+    else if (auto it = m_high_leaves.find(top_level_index); it != m_high_leaves.end())
+        leaf = it->value.ptr();
+    VERIFY(leaf);
+
+    auto leaf_index = block_number & (leaf_size - 1);
+    VERIFY(leaf->bits[leaf_index / 64] & (1ull << (leaf_index % 64)));
+    leaf->bits[leaf_index / 64] &= ~(1ull << (leaf_index % 64));
+}
+
+}
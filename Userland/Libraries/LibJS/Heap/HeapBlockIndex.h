@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2026, agent <agent@local>
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/HashMap.h>
+#include <AK/Noncopyable.h>
+#include <AK/NonnullOwnPtr.h>
+#include <AK/Types.h>
+#include <LibJS/Forward.h>
+#include <LibJS/Heap/HeapBlock.h>
+
+namespace JS {
+
+// A two-level radix table keyed by block address, answering "is this address inside one of our HeapBlocks?"
+// with two loads and no hashing. The top level is a lazily committed array of pointers to leaves, and each leaf is
+// a bitmap with one bit per block-sized chunk of address space.
+//
+// The top level covers the 48-bit address spaces that are the norm. Kernels with larger address spaces (5-level
+// paging on x86-64, 52-bit virtual addresses on AArch64) can hand out addresses above that, whose leaves are kept in a
+// hash map instead, so that the table doesn't have to reserve space for 57 address bits up front.
+class HeapBlockIndex {
+    AK_MAKE_NONCOPYABLE(HeapBlockIndex);
+    AK_MAKE_NONMOVABLE(HeapBlockIndex);
+
+public:
+    HeapBlockIndex();
+    ~HeapBlockIndex();
+
+    void add(HeapBlock&);
+    void remove(HeapBlock&);
+
+    ALWAYS_INLINE HeapBlock* block_containing(FlatPtr address) const
+    {
+        auto block_number = address >> m_block_shift;
+        auto top_level_index = block_number >> leaf_bits;
+        auto const* leaf = top_level_index < m_top_level_size ? m_top_level[top_level_index] : high_leaf(top_level_index);
+        if (!leaf)
+            return nullptr;
+        auto leaf_index = block_number & (leaf_size - 1);
+        if (!(leaf->bits[leaf_index / 64] & (1ull << (leaf_index % 64))))
+            return nullptr;
+        return reinterpret_cast<HeapBlock*>(block_number << m_block_shift);
+    }
+
+private:
+    // Each leaf covers 2^18 blocks, i.e. 1 GiB of address space with 4 KiB blocks.
+    static constexpr size_t leaf_bits = 18;
+    static constexpr size_t leaf_size = 1 << leaf_bits;
+
+    struct Leaf {
+        u64 bits[leaf_size / 64] {};
+    };
+
+    Leaf const* high_leaf(FlatPtr top_level_index) const
+    {
+        if (m_high_leaves.is_empty())
+            return nullptr;
+        auto it = m_high_leaves.find(top_level_index);
+        return it != m_high_leaves.end() ? it->value.ptr() : nullptr;
+    }
+
+    Leaf** m_top_level { nullptr };
+    size_t m_top_level_size { 0 };
+    size_t m_block_shift { 0 };
+
+    // Leaves for addresses beyond what the top level covers, keyed by their top level index.
+    HashMap<FlatPtr, NonnullOwnPtr<Leaf>> m_high_leaves;
+};
+
+}
@@ -19,6 +19,9 @@ class HeapBase {
 public:
     VM& vm() { return m_vm; }
 
+    void remember_cell(Cell const&);
+    void write_barrier_slow_path(void const* slot, void const* cell);
+
 protected:
     HeapBase(VM& vm)
         : m_vm(vm)
@@ -41,6 +44,9 @@ public:
 
     Heap& heap() { return m_heap; }
 
+    bool has_young_cells() const { return m_has_young_cells; }
+    void set_has_young_cells(bool b) { m_has_young_cells = b; }
+
 protected:
     HeapBlockBase(Heap& heap)
         : m_heap(heap)
@@ -48,6 +54,23 @@ protected:
     }
 
     Heap& m_heap;
+    bool m_has_young_cells { false };
 };
 
+// Set once any heap in this process has enabled generational collection, until then no store needs a write barrier.
+extern bool g_generational_collection_enabled;
+
+// Write barrier for stores through GCPtr and NonnullGCPtr: must be called after storing a pointer to `cell` into
+// `slot`. If `slot` is inside an old cell and `cell` is young, the old cell is added to the remembered set.
+// This is a single load and branch unless generational collection is enabled, in which case stores of cells from
+// blocks without young cells are filtered out without looking at the slot.
+ALWAYS_INLINE void write_barrier(void const* slot, void const* cell)
+{
+    if (!g_generational_collection_enabled) [[likely]]
+        return;
+    auto* block = HeapBlockBase::from_cell(static_cast<Cell const*>(cell));
+    if (block->has_young_cells())
+        bit_cast<HeapBase*>(&block->heap())->write_barrier_slow_path(slot, cell);
+}
+
 }
@@ -0,0 +1,393 @@
+/*
+ * Copyright (c) 2026, agent <agent@local>
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/BitCast.h>
+#include <AK/NumericLimits.h>
+#include <AK/Optional.h>
+#include <AK/Platform.h>
+#include <AK/StdLibExtras.h>
+#include <AK/Vector.h>
+
+#if ARCH(X86_64)
+
+namespace JS::JIT {
+
+// A tiny x86-64 assembler with just enough instructions for the baseline JIT.
+struct Assembler {
+    explicit Assembler(Vector<u8>& output)
+        : m_output(output)
+    {
+    }
+
+    Vector<u8>& m_output;
+
+    enum class Reg {
+        RAX = 0,
+        RCX = 1,
+        RDX = 2,
+        RBX = 3,
+        RSP = 4,
+        RBP = 5,
+        RSI = 6,
+        RDI = 7,
+        R8 = 8,
+        R9 = 9,
+        R10 = 10,
+        R11 = 11,
+        R12 = 12,
+        R13 = 13,
+        R14 = 14,
+        R15 = 15,
+    };
+
+    enum class Condition {
+        Overflow = 0x0,
+        Below = 0x2,
+        EqualTo = 0x4,
+        NotEqualTo = 0x5,
+        SignedLessThan = 0xC,
+        SignedGreaterThanOrEqualTo = 0xD,
+        SignedLessThanOrEqualTo = 0xE,
+        SignedGreaterThan = 0xF,
+    };
+
+    struct Operand {
+        enum class Type {
+            Reg,
+            Imm,
+            Mem64BaseAndOffset,
+        };
+
+        Type type {};
+
+        Reg reg {};
+        u64 offset_or_immediate { 0 };
+
+        static Operand Register(Reg reg)
+        {
+            Operand operand;
+            operand.type = Type::Reg;
+            operand.reg = reg;
+            return operand;
+        }
+
+        static Operand Imm(u64 imm)
+        {
+            Operand operand;
+            operand.type = Type::Imm;
+            operand.offset_or_immediate = imm;
+            return operand;
+        }
+
+        static Operand Mem64BaseAndOffset(Reg base, u64 offset)
+        {
+            Operand operand;
+            operand.type = Type::Mem64BaseAndOffset;
+            operand.reg = base;
+            operand.offset_or_immediate = offset;
+            return operand;
+        }
+
+        bool fits_in_i32() const
+        {
+            return static_cast<i64>(offset_or_immediate) == static_cast<i32>(offset_or_immediate);
+        }
+    };
+
+    struct Label {
+        Optional<size_t> offset_of_label_in_instruction_stream;
+        Vector<size_t> jump_slot_offsets_in_instruction_stream;
+
+        void add_jump(Assembler& assembler, size_t offset)
+        {
+            jump_slot_offsets_in_instruction_stream.append(offset);
+            if (offset_of_label_in_instruction_stream.has_value())
+                link_jump(assembler, offset);
+        }
+
+        void link(Assembler& assembler)
+        {
+            link_to(assembler, assembler.m_output.size());
+        }
+
+        void link_to(Assembler& assembler, size_t link_offset)
+        {
+            VERIFY(!offset_of_label_in_instruction_stream.has_value());
+            offset_of_label_in_instruction_stream = link_offset;
+            for (auto offset : jump_slot_offsets_in_instruction_stream)
+                link_jump(assembler, offset);
+        }
+
+    private:
+        void link_jump(Assembler& assembler, size_t offset_in_instruction_stream)
+        {
+            // The rel32 operand is the last thing in every jump we emit, so the jump is relative to the end of it.
+            auto offset = static_cast<i64>(offset_of_label_in_instruction_stream.value()) - static_cast<i64>(offset_in_instruction_stream);
+            VERIFY(offset == static_cast<i32>(offset));
+            auto jump_slot = offset_in_instruction_stream - 4;
+            assembler.m_output[jump_slot + 0] = (offset >> 0) & 0xff;
+            assembler.m_output[jump_slot + 1] = (offset >> 8) & 0xff;
+            assembler.m_output[jump_slot + 2] = (offset >> 16) & 0xff;
+            assembler.m_output[jump_slot + 3] = (offset >> 24) & 0xff;
+        }
+    };
+
+    [[nodiscard]] Label make_label()
+    {
+        return Label {};
+    }
+
+    static constexpr u8 encode_reg(Reg reg)
+    {
+        return to_underlying(reg) & 0x7;
+    }
+
+    static constexpr bool is_extended_reg(Reg reg)
+    {
+        return to_underlying(reg) >= 8;
+    }
+
+    void emit8(u8 value)
+    {
+        m_output.append(value);
+    }
+
+    void emit32(u32 value)
+    {
+        m_output.append((value >> 0) & 0xff);
+        m_output.append((value >> 8) & 0xff);
+        m_output.append((value >> 16) & 0xff);
+        m_output.append((value >> 24) & 0xff);
+    }
+
+    void emit64(u64 value)
+    {
+        emit32(value & 0xffffffff);
+        emit32(value >> 32);
+    }
+
+    // REX prefix for an instruction whose ModRM reg field is `reg` and whose r/m field (or opcode register) is `rm`.
+    void emit_rex(bool is_64bit, Reg reg, Reg rm)
+    {
+        u8 rex = 0x40;
+        if (is_64bit)
+            rex |= 0x08;
+        if (is_extended_reg(reg))
+            rex |= 0x04;
+        if (is_extended_reg(rm))
+            rex |= 0x01;
+        if (rex != 0x40)
+            emit8(rex);
+    }
+
+    void emit_modrm_register(Reg reg, Reg rm)
+    {
+        emit8(0xc0 | (encode_reg(reg) << 3) | encode_reg(rm));
+    }
+
+    void emit_modrm_memory(Reg reg, Operand const& memory)
+    {
+        VERIFY(memory.type == Operand::Type::Mem64BaseAndOffset);
+        VERIFY(memory.fits_in_i32());
+        // NOTE: We always use a 32-bit displacement, which sidesteps the special meaning of RBP/R13 with mod=00.
+        emit8(0x80 | (encode_reg(reg) << 3) | encode_reg(memory.reg));
+        // RSP/R12 as a base always need a SIB byte.
+        if (encode_reg(memory.reg) == encode_reg(Reg::RSP))
+            emit8(0x24);
+        emit32(static_cast<u32>(memory.offset_or_immediate));
+    }
+
+    void mov(Operand dst, Operand src)
+    {
+        if (dst.type == Operand::Type::Reg && src.type == Operand::Type::Reg) {
+            if (dst.reg == src.reg)
+                return;
+            emit_rex(true, src.reg, dst.reg);
+            emit8(0x89);
+            emit_modrm_register(src.reg, dst.reg);
+            return;
+        }
+
+        if (dst.type == Operand::Type::Reg && src.type == Operand::Type::Imm) {
+            if (src.offset_or_immediate <= NumericLimits<u32>::max()) {
+                // mov r32, imm32 zero-extends into the full register.
+                emit_rex(false, Reg::RAX, dst.reg);
+                emit8(0xb8 | encode_reg(dst.reg));
+                emit32(src.offset_or_immediate);
+                return;
+            }
+            emit_rex(true, Reg::RAX, dst.reg);
+            emit8(0xb8 | encode_reg(dst.reg));
+            emit64(src.offset_or_immediate);
+            return;
+        }
+
+        if (dst.type == Operand::Type::Mem64BaseAndOffset && src.type == Operand::Type::Reg) {
+            emit_rex(true, src.reg, dst.reg);
+            emit8(0x89);
+            emit_modrm_memory(src.reg, dst);
+            return;
+        }
+
+        if (dst.type == Operand::Type::Mem64BaseAndOffset && src.type == Operand::Type::Imm) {
+            VERIFY(src.fits_in_i32());
+            emit_rex(true, Reg::RAX, dst.reg);
+            emit8(0xc7);
+            emit_modrm_memory(Reg::RAX, dst);
+            emit32(src.offset_or_immediate);
+            return;
+        }
+
+        if (dst.type == Operand::Type::Reg && src.type == Operand::Type::Mem64BaseAndOffset) {
+            emit_rex(true, dst.reg, src.reg);
+            emit8(0x8b);
+            emit_modrm_memory(dst.reg, src);
+            return;
+        }
+
+        VERIFY_NOT_REACHED();
+    }
+
+    void lea(Reg dst, Operand src)
+    {
+        emit_rex(true, dst, src.reg);
+        emit8(0x8d);
+        emit_modrm_memory(dst, src);
+    }
+
+    void shift_right(Reg reg, u8 amount)
+    {
+        emit_rex(true, Reg::RAX, reg);
+        emit8(0xc1);
+        emit_modrm_register(static_cast<Reg>(5), reg);
+        emit8(amount);
+    }
+
+    // The 32-bit ALU instructions below zero the upper half of their destination, which is exactly what we want when
+    // the result is about to be boxed as an Int32 Value.
+    void emit_alu32(u8 opcode, Reg dst, Reg src)
+    {
+        emit_rex(false, src, dst);
+        emit8(opcode);
+        emit_modrm_register(src, dst);
+    }
+
+    void emit_alu32_immediate(u8 extension, Reg dst, u32 imm)
+    {
+        emit_rex(false, Reg::RAX, dst);
+        emit8(0x81);
+        emit_modrm_register(static_cast<Reg>(extension), dst);
+        emit32(imm);
+    }
+
+    void add32(Reg dst, Reg src) { emit_alu32(0x01, dst, src); }
+    void or32(Reg dst, Reg src) { emit_alu32(0x09, dst, src); }
+    void and32(Reg dst, Reg src) { emit_alu32(0x21, dst, src); }
+    void sub32(Reg dst, Reg src) { emit_alu32(0x29, dst, src); }
+    void xor32(Reg dst, Reg src) { emit_alu32(0x31, dst, src); }
+    void cmp32(Reg lhs, Reg rhs) { emit_alu32(0x39, lhs, rhs); }
+    void test32(Reg lhs, Reg rhs) { emit_alu32(0x85, lhs, rhs); }
+
+    void add32(Reg dst, u32 imm) { emit_alu32_immediate(0, dst, imm); }
+    void and32(Reg dst, u32 imm) { emit_alu32_immediate(4, dst, imm); }
+    void sub32(Reg dst, u32 imm) { emit_alu32_immediate(5, dst, imm); }
+    void cmp32(Reg lhs, u32 imm) { emit_alu32_immediate(7, lhs, imm); }
+
+    void or64(Reg dst, Reg src)
+    {
+        emit_rex(true, src, dst);
+        emit8(0x09);
+        emit_modrm_register(src, dst);
+    }
+
+    void add64(Reg dst, u8 imm)
+    {
+        emit_rex(true, Reg::RAX, dst);
+        emit8(0x83);
+        emit_modrm_register(static_cast<Reg>(0), dst);
+        emit8(imm);
+    }
+
+    void sub64(Reg dst, u8 imm)
+    {
+        emit_rex(true, Reg::RAX, dst);
+        emit8(0x83);
+        emit_modrm_register(static_cast<Reg>(5), dst);
+        emit8(imm);
+    }
+
+    void test8(Reg lhs, Reg rhs)
+    {
+        VERIFY(to_underlying(lhs) < 4 && to_underlying(rhs) < 4);
+        emit8(0x84);
+        emit_modrm_register(rhs, lhs);
+    }
+
+    // Sets the low byte of `dst` to 0 or 1, then zero-extends it into the full register.
+    void set_if(Condition condition, Reg dst)
+    {
+        VERIFY(to_underlying(dst) < 4);
+        emit8(0x0f);
+        emit8(0x90 | to_underlying(condition));
+        emit_modrm_register(Reg::RAX, dst);
+        emit8(0x0f);
+        emit8(0xb6);
+        emit_modrm_register(dst, dst);
+    }
+
+    void jump(Label& label)
+    {
+        emit8(0xe9);
+        emit32(0xdeadbeef);
+        label.add_jump(*this, m_output.size());
+    }
+
+    void jump(Reg target)
+    {
+        emit_rex(false, Reg::RAX, target);
+        emit8(0xff);
+        emit_modrm_register(static_cast<Reg>(4), target);
+    }
+
+    void jump_if(Condition condition, Label& label)
+    {
+        emit8(0x0f);
+        emit8(0x80 | to_underlying(condition));
+        emit32(0xdeadbeef);
+        label.add_jump(*this, m_output.size());
+    }
+
+    void native_call(void* callee)
+    {
+        mov(Operand::Register(Reg::RAX), Operand::Imm(bit_cast<FlatPtr>(callee)));
+        emit_rex(false, Reg::RAX, Reg::RAX);
+        emit8(0xff);
+        emit_modrm_register(static_cast<Reg>(2), Reg::RAX);
+    }
+
+    void push(Reg reg)
+    {
+        emit_rex(false, Reg::RAX, reg);
+        emit8(0x50 | encode_reg(reg));
+    }
+
+    void pop(Reg reg)
+    {
+        emit_rex(false, Reg::RAX, reg);
+        emit8(0x58 | encode_reg(reg));
+    }
+
+    void ret()
+    {
+        emit8(0xc3);
+    }
+};
+
+}
+
+#endif
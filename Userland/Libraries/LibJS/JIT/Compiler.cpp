@@ -0,0 +1,634 @@
+/*
+ * Copyright (c) 2026, agent <agent@local>
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibJS/Bytecode/Instruction.h>
+#include <LibJS/Bytecode/Interpreter.h>
+#include <LibJS/Bytecode/Op.h>
+#include <LibJS/JIT/Compiler.h>
+#include <LibJS/Runtime/ValueInlines.h>
+
+namespace JS::JIT {
+
+bool g_jit_enabled = ARCH(X86_64);
+u32 g_jit_threshold = 100;
+
+#if ARCH(X86_64)
+
+// The C++ side of the native code. None of these are allowed to keep a Value in a machine register across a call,
+// everything lives in the value array of the running execution context.
+
+static Value operand_value(Bytecode::Interpreter& interpreter, Bytecode::Operand operand)
+{
+    return interpreter.running_execution_context().registers_and_constants_and_locals[operand.index()];
+}
+
+template<typename OpType>
+static bool cxx_execute(Bytecode::Interpreter& interpreter, OpType const& instruction)
+{
+    if constexpr (IsSame<decltype(instruction.execute_impl(interpreter)), void>) {
+        instruction.execute_impl(interpreter);
+    } else {
+        auto result = instruction.execute_impl(interpreter);
+        if (result.is_error()) {
+            interpreter.reg(Bytecode::Register::exception()) = result.error_value();
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool cxx_to_boolean(Value const* value)
+{
+    return value->to_boolean();
+}
+
+static ThrowCompletionOr<Value> loosely_equals(VM& vm, Value lhs, Value rhs)
+{
+    return Value(TRY(is_loosely_equal(vm, lhs, rhs)));
+}
+
+static ThrowCompletionOr<Value> loosely_inequals(VM& vm, Value lhs, Value rhs)
+{
+    return Value(!TRY(is_loosely_equal(vm, lhs, rhs)));
+}
+
+static ThrowCompletionOr<Value> strict_equals(VM&, Value lhs, Value rhs)
+{
+    return Value(is_strictly_equal(lhs, rhs));
+}
+
+static ThrowCompletionOr<Value> strict_inequals(VM&, Value lhs, Value rhs)
+{
+    return Value(!is_strictly_equal(lhs, rhs));
+}
+
+// The slow cases of the comparison jumps return 0 or 1 for the outcome of the comparison, or this if it threw.
+static constexpr u32 comparison_threw = 2;
+
+#    define __JS_ENUMERATE(op_TitleCase, op_snake_case, numeric_operator)                                                       \
+        static u64 cxx_jump_##op_snake_case(Bytecode::Interpreter& interpreter, Bytecode::Op::Jump##op_TitleCase const& instruction) \
+        {                                                                                                                       \
+            auto lhs = operand_value(interpreter, instruction.lhs());                                                           \
+            auto rhs = operand_value(interpreter, instruction.rhs());                                                           \
+            if (lhs.is_number() && rhs.is_number())                                                                             \
+                return lhs.as_double() numeric_operator rhs.as_double();                                                        \
+            auto result = op_snake_case(interpreter.vm(), lhs, rhs);                                                            \
+            if (result.is_error()) {                                                                                            \
+                interpreter.reg(Bytecode::Register::exception()) = result.error_value();                                        \
+                return comparison_threw;                                                                                        \
+            }                                                                                                                   \
+            return result.value().to_boolean();                                                                                 \
+        }
+JS_ENUMERATE_COMPARISON_OPS(__JS_ENUMERATE)
+#    undef __JS_ENUMERATE
+
+// Instructions without an inline fast path, which run exactly as they would in the interpreter by calling their
+// execute_impl().
+// NOTE: This must be kept in sync with Interpreter::run_bytecode(). Anything not listed here, nor handled specially
+//       in compile_instruction(), exits to the interpreter.
+#    define JS_ENUMERATE_INSTRUCTIONS_WITH_HANDLERS(O) \
+        O(AddPrivateName)                              \
+        O(ArrayAppend)                                 \
+        O(AsyncIteratorClose)                          \
+        O(BitwiseNot)                                  \
+        O(BlockDeclarationInstantiation)               \
+        O(Call)                                        \
+        O(CallWithArgumentArray)                       \
+        O(Catch)                                       \
+        O(ConcatString)                                \
+        O(CopyObjectExcludingProperties)               \
+        O(CreateLexicalEnvironment)                    \
+        O(CreateVariableEnvironment)                   \
+        O(CreatePrivateEnvironment)                    \
+        O(CreateVariable)                              \
+        O(CreateRestParams)                            \
+        O(CreateArguments)                             \
+        O(DeleteById)                                  \
+        O(DeleteByIdWithThis)                          \
+        O(DeleteByValue)                               \
+        O(DeleteByValueWithThis)                       \
+        O(DeleteVariable)                              \
+        O(Div)                                         \
+        O(Dump)                                        \
+        O(EnterObjectEnvironment)                      \
+        O(Exp)                                         \
+        O(GetById)                                     \
+        O(GetByIdWithThis)                             \
+        O(GetByValue)                                  \
+        O(GetByValueWithThis)                          \
+        O(GetCalleeAndThisFromEnvironment)             \
+        O(GetGlobal)                                   \
+        O(GetImportMeta)                               \
+        O(GetIterator)                                 \
+        O(GetLength)                                   \
+        O(GetLengthWithThis)                           \
+        O(GetMethod)                                   \
+        O(GetNewTarget)                                \
+        O(GetNextMethodFromIteratorRecord)             \
+        O(GetObjectFromIteratorRecord)                 \
+        O(GetObjectPropertyIterator)                   \
+        O(GetPrivateById)                              \
+        O(GetBinding)                                  \
+        O(HasPrivateId)                                \
+        O(ImportCall)                                  \
+        O(In)                                          \
+        O(InitializeLexicalBinding)                    \
+        O(InitializeVariableBinding)                   \
+        O(InstanceOf)                                  \
+        O(IteratorClose)                               \
+        O(IteratorNext)                                \
+        O(IteratorToArray)                             \
+        O(LeaveFinally)                                \
+        O(LeaveLexicalEnvironment)                     \
+        O(LeavePrivateEnvironment)                     \
+        O(LeaveUnwindContext)                          \
+        O(LeftShift)                                   \
+        O(Mod)                                         \
+        O(Mul)                                         \
+        O(NewArray)                                    \
+        O(NewClass)                                    \
+        O(NewFunction)                                 \
+        O(NewObject)                                   \
+        O(NewPrimitiveArray)                           \
+        O(NewRegExp)                                   \
+        O(NewTypeError)                                \
+        O(Not)                                         \
+        O(PrepareYield)                                \
+        O(PostfixDecrement)                            \
+        O(PostfixIncrement)                            \
+        O(PutById)                                     \
+        O(PutByIdWithThis)                             \
+        O(PutByValue)                                  \
+        O(PutByValueWithThis)                          \
+        O(PutPrivateById)                              \
+        O(ResolveSuperBase)                            \
+        O(ResolveThisBinding)                          \
+        O(RestoreScheduledJump)                        \
+        O(RightShift)                                  \
+        O(SetLexicalBinding)                           \
+        O(SetVariableBinding)                          \
+        O(SuperCallWithArgumentArray)                  \
+        O(Throw)                                       \
+        O(ThrowIfNotObject)                            \
+        O(ThrowIfNullish)                              \
+        O(ThrowIfTDZ)                                  \
+        O(Typeof)                                      \
+        O(TypeofBinding)                               \
+        O(UnaryMinus)                                  \
+        O(UnaryPlus)                                   \
+        O(UnsignedRightShift)
+
+void Compiler::load_value(Assembler::Reg dst, Bytecode::Operand operand)
+{
+    m_assembler.mov(
+        Assembler::Operand::Register(dst),
+        Assembler::Operand::Mem64BaseAndOffset(VALUE_ARRAY_BASE, operand.index() * sizeof(Value)));
+}
+
+void Compiler::store_value(Bytecode::Operand operand, Assembler::Reg src)
+{
+    m_assembler.mov(
+        Assembler::Operand::Mem64BaseAndOffset(VALUE_ARRAY_BASE, operand.index() * sizeof(Value)),
+        Assembler::Operand::Register(src));
+}
+
+void Compiler::branch_if_not_int32(Assembler::Reg reg, Assembler::Label& label)
+{
+    m_assembler.mov(Assembler::Operand::Register(GPR2), Assembler::Operand::Register(reg));
+    m_assembler.shift_right(GPR2, TAG_SHIFT);
+    m_assembler.cmp32(GPR2, INT32_TAG);
+    m_assembler.jump_if(Assembler::Condition::NotEqualTo, label);
+}
+
+// NOTE: The boxing helpers expect the upper half of `reg` to be clear, which all the 32-bit instructions we use
+//       to compute payloads guarantee.
+void Compiler::box_int32(Assembler::Reg reg)
+{
+    m_assembler.mov(Assembler::Operand::Register(GPR2), Assembler::Operand::Imm(SHIFTED_INT32_TAG));
+    m_assembler.or64(reg, GPR2);
+}
+
+void Compiler::box_boolean(Assembler::Reg reg)
+{
+    m_assembler.mov(Assembler::Operand::Register(GPR2), Assembler::Operand::Imm(SHIFTED_BOOLEAN_TAG));
+    m_assembler.or64(reg, GPR2);
+}
+
+void Compiler::store_program_counter()
+{
+    // The runtime looks at the program counter for things like stack traces, so it must be accurate whenever we call
+    // into C++.
+    m_assembler.mov(
+        Assembler::Operand::Mem64BaseAndOffset(PROGRAM_COUNTER_BASE, 0),
+        Assembler::Operand::Imm(m_program_counter));
+}
+
+void Compiler::exit_to_interpreter(NativeExecutable::ExitKind kind)
+{
+    m_assembler.mov(Assembler::Operand::Register(GPR0), Assembler::Operand::Imm(m_program_counter));
+    m_assembler.mov(Assembler::Operand::Register(GPR2), Assembler::Operand::Imm(to_underlying(kind)));
+    m_assembler.jump(m_exit_label);
+}
+
+void Compiler::exit_to_interpreter_if_thrown()
+{
+    // All of our C++ helpers return false (in AL) after leaving an exception in Register::exception().
+    auto did_not_throw = m_assembler.make_label();
+    m_assembler.test8(GPR0, GPR0);
+    m_assembler.jump_if(Assembler::Condition::NotEqualTo, did_not_throw);
+    exit_to_interpreter(NativeExecutable::ExitKind::Threw);
+    did_not_throw.link(m_assembler);
+}
+
+Assembler::Label& Compiler::label_for(Bytecode::Label label)
+{
+    auto it = m_instruction_labels.find(label.address());
+    VERIFY(it != m_instruction_labels.end());
+    return it->value;
+}
+
+template<typename OpType>
+void Compiler::compile_call_to_instruction_handler(OpType const& instruction)
+{
+    store_program_counter();
+    m_assembler.mov(Assembler::Operand::Register(ARG0), Assembler::Operand::Register(INTERPRETER_BASE));
+    m_assembler.mov(Assembler::Operand::Register(ARG1), Assembler::Operand::Imm(bit_cast<FlatPtr>(&instruction)));
+    m_assembler.native_call(reinterpret_cast<void*>(&cxx_execute<OpType>));
+
+    constexpr bool can_throw = !IsSame<decltype(instruction.execute_impl(declval<Bytecode::Interpreter&>())), void>;
+    if constexpr (can_throw)
+        exit_to_interpreter_if_thrown();
+}
+
+template<typename OpType, typename FastPath>
+void Compiler::compile_with_int32_fast_path(OpType const& instruction, Bytecode::Operand lhs, Bytecode::Operand rhs, FastPath fast_path)
+{
+    auto slow_case = m_assembler.make_label();
+    auto end = m_assembler.make_label();
+
+    load_value(GPR0, lhs);
+    load_value(GPR1, rhs);
+    branch_if_not_int32(GPR0, slow_case);
+    branch_if_not_int32(GPR1, slow_case);
+    fast_path(slow_case);
+    m_assembler.jump(end);
+
+    slow_case.link(m_assembler);
+    compile_call_to_instruction_handler(instruction);
+    end.link(m_assembler);
+}
+
+template<typename OpType>
+void Compiler::compile_int32_arithmetic(OpType const& instruction, void (Assembler::*operation)(Assembler::Reg, Assembler::Reg), bool can_overflow)
+{
+    compile_with_int32_fast_path(instruction, instruction.lhs(), instruction.rhs(), [&](Assembler::Label& slow_case) {
+        (m_assembler.*operation)(GPR0, GPR1);
+        if (can_overflow)
+            m_assembler.jump_if(Assembler::Condition::Overflow, slow_case);
+        box_int32(GPR0);
+        store_value(instruction.dst(), GPR0);
+    });
+}
+
+template<typename OpType>
+void Compiler::compile_int32_comparison(OpType const& instruction, Assembler::Condition condition)
+{
+    compile_with_int32_fast_path(instruction, instruction.lhs(), instruction.rhs(), [&](Assembler::Label&) {
+        m_assembler.cmp32(GPR0, GPR1);
+        m_assembler.set_if(condition, GPR0);
+        box_boolean(GPR0);
+        store_value(instruction.dst(), GPR0);
+    });
+}
+
+template<typename OpType>
+void Compiler::compile_comparison_jump(OpType const& instruction, Assembler::Condition condition, void* slow_case_function)
+{
+    auto& true_target = label_for(instruction.true_target());
+    auto& false_target = label_for(instruction.false_target());
+    auto slow_case = m_assembler.make_label();
+
+    load_value(GPR0, instruction.lhs());
+    load_value(GPR1, instruction.rhs());
+    branch_if_not_int32(GPR0, slow_case);
+    branch_if_not_int32(GPR1, slow_case);
+    m_assembler.cmp32(GPR0, GPR1);
+    m_assembler.jump_if(condition, true_target);
+    m_assembler.jump(false_target);
+
+    slow_case.link(m_assembler);
+    store_program_counter();
+    m_assembler.mov(Assembler::Operand::Register(ARG0), Assembler::Operand::Register(INTERPRETER_BASE));
+    m_assembler.mov(Assembler::Operand::Register(ARG1), Assembler::Operand::Imm(bit_cast<FlatPtr>(&instruction)));
+    m_assembler.native_call(slow_case_function);
+
+    auto did_not_throw = m_assembler.make_label();
+    m_assembler.cmp32(GPR0, comparison_threw);
+    m_assembler.jump_if(Assembler::Condition::NotEqualTo, did_not_throw);
+    exit_to_interpreter(NativeExecutable::ExitKind::Threw);
+    did_not_throw.link(m_assembler);
+
+    m_assembler.test8(GPR0, GPR0);
+    m_assembler.jump_if(Assembler::Condition::NotEqualTo, true_target);
+    m_assembler.jump(false_target);
+}
+
+void Compiler::compile_to_boolean(Bytecode::Operand condition)
+{
+    // Leaves the result in AL and the flags set from it, so that it can be followed by a conditional jump.
+    auto slow_case = m_assembler.make_label();
+    auto end = m_assembler.make_label();
+
+    load_value(GPR0, condition);
+    m_assembler.mov(Assembler::Operand::Register(GPR1), Assembler::Operand::Register(GPR0));
+    m_assembler.shift_right(GPR1, TAG_SHIFT);
+    m_assembler.cmp32(GPR1, BOOLEAN_TAG);
+    m_assembler.jump_if(Assembler::Condition::NotEqualTo, slow_case);
+    m_assembler.jump(end);
+
+    slow_case.link(m_assembler);
+    m_assembler.lea(ARG0, Assembler::Operand::Mem64BaseAndOffset(VALUE_ARRAY_BASE, condition.index() * sizeof(Value)));
+    m_assembler.native_call(reinterpret_cast<void*>(&cxx_to_boolean));
+
+    end.link(m_assembler);
+    m_assembler.test8(GPR0, GPR0);
+}
+
+void Compiler::compile_mov(Bytecode::Op::Mov const& instruction)
+{
+    load_value(GPR0, instruction.src());
+    store_value(instruction.dst(), GPR0);
+}
+
+void Compiler::compile_get_argument(Bytecode::Op::GetArgument const& instruction)
+{
+    m_assembler.mov(
+        Assembler::Operand::Register(GPR0),
+        Assembler::Operand::Mem64BaseAndOffset(ARGUMENT_ARRAY_BASE, instruction.index() * sizeof(Value)));
+    store_value(instruction.dst(), GPR0);
+}
+
+void Compiler::compile_set_argument(Bytecode::Op::SetArgument const& instruction)
+{
+    load_value(GPR0, instruction.src());
+    m_assembler.mov(
+        Assembler::Operand::Mem64BaseAndOffset(ARGUMENT_ARRAY_BASE, instruction.index() * sizeof(Value)),
+        Assembler::Operand::Register(GPR0));
+}
+
+void Compiler::compile_jump_if(Bytecode::Op::JumpIf const& instruction)
+{
+    compile_to_boolean(instruction.condition());
+    m_assembler.jump_if(Assembler::Condition::NotEqualTo, label_for(instruction.true_target()));
+    m_assembler.jump(label_for(instruction.false_target()));
+}
+
+void Compiler::compile_jump_true(Bytecode::Op::JumpTrue const& instruction)
+{
+    compile_to_boolean(instruction.condition());
+    m_assembler.jump_if(Assembler::Condition::NotEqualTo, label_for(instruction.target()));
+}
+
+void Compiler::compile_jump_false(Bytecode::Op::JumpFalse const& instruction)
+{
+    compile_to_boolean(instruction.condition());
+    m_assembler.jump_if(Assembler::Condition::EqualTo, label_for(instruction.target()));
+}
+
+void Compiler::compile_jump_nullish(Bytecode::Op::JumpNullish const& instruction)
+{
+    load_value(GPR0, instruction.condition());
+    m_assembler.shift_right(GPR0, TAG_SHIFT);
+    m_assembler.and32(GPR0, IS_NULLISH_EXTRACT_PATTERN);
+    m_assembler.cmp32(GPR0, IS_NULLISH_PATTERN);
+    m_assembler.jump_if(Assembler::Condition::EqualTo, label_for(instruction.true_target()));
+    m_assembler.jump(label_for(instruction.false_target()));
+}
+
+void Compiler::compile_jump_undefined(Bytecode::Op::JumpUndefined const& instruction)
+{
+    load_value(GPR0, instruction.condition());
+    m_assembler.shift_right(GPR0, TAG_SHIFT);
+    m_assembler.cmp32(GPR0, UNDEFINED_TAG);
+    m_assembler.jump_if(Assembler::Condition::EqualTo, label_for(instruction.true_target()));
+    m_assembler.jump(label_for(instruction.false_target()));
+}
+
+void Compiler::compile_increment(Bytecode::Op::Increment const& instruction)
+{
+    auto slow_case = m_assembler.make_label();
+    auto end = m_assembler.make_label();
+
+    load_value(GPR0, instruction.dst());
+    branch_if_not_int32(GPR0, slow_case);
+    m_assembler.add32(GPR0, 1);
+    m_assembler.jump_if(Assembler::Condition::Overflow, slow_case);
+    box_int32(GPR0);
+    store_value(instruction.dst(), GPR0);
+    m_assembler.jump(end);
+
+    slow_case.link(m_assembler);
+    compile_call_to_instruction_handler(instruction);
+    end.link(m_assembler);
+}
+
+void Compiler::compile_decrement(Bytecode::Op::Decrement const& instruction)
+{
+    auto slow_case = m_assembler.make_label();
+    auto end = m_assembler.make_label();
+
+    load_value(GPR0, instruction.dst());
+    branch_if_not_int32(GPR0, slow_case);
+    m_assembler.sub32(GPR0, 1);
+    m_assembler.jump_if(Assembler::Condition::Overflow, slow_case);
+    box_int32(GPR0);
+    store_value(instruction.dst(), GPR0);
+    m_assembler.jump(end);
+
+    slow_case.link(m_assembler);
+    compile_call_to_instruction_handler(instruction);
+    end.link(m_assembler);
+}
+
+void Compiler::compile_instruction(Bytecode::Instruction const& instruction)
+{
+    using Type = Bytecode::Instruction::Type;
+    using Condition = Assembler::Condition;
+    namespace Op = Bytecode::Op;
+
+    switch (instruction.type()) {
+    case Type::Mov:
+        compile_mov(static_cast<Op::Mov const&>(instruction));
+        return;
+    case Type::GetArgument:
+        compile_get_argument(static_cast<Op::GetArgument const&>(instruction));
+        return;
+    case Type::SetArgument:
+        compile_set_argument(static_cast<Op::SetArgument const&>(instruction));
+        return;
+    case Type::Jump:
+        m_assembler.jump(label_for(static_cast<Op::Jump const&>(instruction).target()));
+        return;
+    case Type::JumpIf:
+        compile_jump_if(static_cast<Op::JumpIf const&>(instruction));
+        return;
+    case Type::JumpTrue:
+        compile_jump_true(static_cast<Op::JumpTrue const&>(instruction));
+        return;
+    case Type::JumpFalse:
+        compile_jump_false(static_cast<Op::JumpFalse const&>(instruction));
+        return;
+    case Type::JumpNullish:
+        compile_jump_nullish(static_cast<Op::JumpNullish const&>(instruction));
+        return;
+    case Type::JumpUndefined:
+        compile_jump_undefined(static_cast<Op::JumpUndefined const&>(instruction));
+        return;
+    case Type::Increment:
+        compile_increment(static_cast<Op::Increment const&>(instruction));
+        return;
+    case Type::Decrement:
+        compile_decrement(static_cast<Op::Decrement const&>(instruction));
+        return;
+    case Type::Add:
+        compile_int32_arithmetic(static_cast<Op::Add const&>(instruction), &Assembler::add32, true);
+        return;
+    case Type::Sub:
+        compile_int32_arithmetic(static_cast<Op::Sub const&>(instruction), &Assembler::sub32, true);
+        return;
+    case Type::BitwiseAnd:
+        compile_int32_arithmetic(static_cast<Op::BitwiseAnd const&>(instruction), &Assembler::and32, false);
+        return;
+    case Type::BitwiseOr:
+        compile_int32_arithmetic(static_cast<Op::BitwiseOr const&>(instruction), &Assembler::or32, false);
+        return;
+    case Type::BitwiseXor:
+        compile_int32_arithmetic(static_cast<Op::BitwiseXor const&>(instruction), &Assembler::xor32, false);
+        return;
+    case Type::LessThan:
+        compile_int32_comparison(static_cast<Op::LessThan const&>(instruction), Condition::SignedLessThan);
+        return;
+    case Type::LessThanEquals:
+        compile_int32_comparison(static_cast<Op::LessThanEquals const&>(instruction), Condition::SignedLessThanOrEqualTo);
+        return;
+    case Type::GreaterThan:
+        compile_int32_comparison(static_cast<Op::GreaterThan const&>(instruction), Condition::SignedGreaterThan);
+        return;
+    case Type::GreaterThanEquals:
+        compile_int32_comparison(static_cast<Op::GreaterThanEquals const&>(instruction), Condition::SignedGreaterThanOrEqualTo);
+        return;
+    case Type::StrictlyEquals:
+        compile_int32_comparison(static_cast<Op::StrictlyEquals const&>(instruction), Condition::EqualTo);
+        return;
+    case Type::StrictlyInequals:
+        compile_int32_comparison(static_cast<Op::StrictlyInequals const&>(instruction), Condition::NotEqualTo);
+        return;
+    case Type::LooselyEquals:
+        compile_int32_comparison(static_cast<Op::LooselyEquals const&>(instruction), Condition::EqualTo);
+        return;
+    case Type::LooselyInequals:
+        compile_int32_comparison(static_cast<Op::LooselyInequals const&>(instruction), Condition::NotEqualTo);
+        return;
+    case Type::JumpLessThan:
+        compile_comparison_jump(static_cast<Op::JumpLessThan const&>(instruction), Condition::SignedLessThan, reinterpret_cast<void*>(&cxx_jump_less_than));
+        return;
+    case Type::JumpLessThanEquals:
+        compile_comparison_jump(static_cast<Op::JumpLessThanEquals const&>(instruction), Condition::SignedLessThanOrEqualTo, reinterpret_cast<void*>(&cxx_jump_less_than_equals));
+        return;
+    case Type::JumpGreaterThan:
+        compile_comparison_jump(static_cast<Op::JumpGreaterThan const&>(instruction), Condition::SignedGreaterThan, reinterpret_cast<void*>(&cxx_jump_greater_than));
+        return;
+    case Type::JumpGreaterThanEquals:
+        compile_comparison_jump(static_cast<Op::JumpGreaterThanEquals const&>(instruction), Condition::SignedGreaterThanOrEqualTo, reinterpret_cast<void*>(&cxx_jump_greater_than_equals));
+        return;
+    case Type::JumpLooselyEquals:
+        compile_comparison_jump(static_cast<Op::JumpLooselyEquals const&>(instruction), Condition::EqualTo, reinterpret_cast<void*>(&cxx_jump_loosely_equals));
+        return;
+    case Type::JumpLooselyInequals:
+        compile_comparison_jump(static_cast<Op::JumpLooselyInequals const&>(instruction), Condition::NotEqualTo, reinterpret_cast<void*>(&cxx_jump_loosely_inequals));
+        return;
+    case Type::JumpStrictlyEquals:
+        compile_comparison_jump(static_cast<Op::JumpStrictlyEquals const&>(instruction), Condition::EqualTo, reinterpret_cast<void*>(&cxx_jump_strict_equals));
+        return;
+    case Type::JumpStrictlyInequals:
+        compile_comparison_jump(static_cast<Op::JumpStrictlyInequals const&>(instruction), Condition::NotEqualTo, reinterpret_cast<void*>(&cxx_jump_strict_inequals));
+        return;
+
+#    define __JS_ENUMERATE(name)                                                            \
+    case Type::name:                                                                        \
+        compile_call_to_instruction_handler(static_cast<Op::name const&>(instruction)); \
+        return;
+        JS_ENUMERATE_INSTRUCTIONS_WITH_HANDLERS(__JS_ENUMERATE)
+#    undef __JS_ENUMERATE
+
+    default:
+        // End, Return, Yield, Await and the unwinding instructions only make sense inside run_bytecode(), so we let the
+        // interpreter take it from here.
+        exit_to_interpreter(NativeExecutable::ExitKind::ContinueInInterpreter);
+        return;
+    }
+}
+
+OwnPtr<NativeExecutable> Compiler::compile_executable()
+{
+    // Prologue: Save the callee-saved registers we use, set up our fixed registers from the arguments, and jump to the
+    //           code for the instruction we're entering at. See NativeExecutable::run().
+    m_assembler.push(Assembler::Reg::RBP);
+    m_assembler.push(Assembler::Reg::RBX);
+    m_assembler.push(VALUE_ARRAY_BASE);
+    m_assembler.push(INTERPRETER_BASE);
+    m_assembler.push(PROGRAM_COUNTER_BASE);
+    m_assembler.push(ARGUMENT_ARRAY_BASE);
+    // NOTE: Keep the stack 16-byte aligned for the calls we make.
+    m_assembler.sub64(Assembler::Reg::RSP, 8);
+    m_assembler.mov(Assembler::Operand::Register(VALUE_ARRAY_BASE), Assembler::Operand::Register(ARG0));
+    m_assembler.mov(Assembler::Operand::Register(ARGUMENT_ARRAY_BASE), Assembler::Operand::Register(ARG1));
+    m_assembler.mov(Assembler::Operand::Register(INTERPRETER_BASE), Assembler::Operand::Register(ARG2));
+    m_assembler.mov(Assembler::Operand::Register(PROGRAM_COUNTER_BASE), Assembler::Operand::Register(ARG3));
+    m_assembler.jump(ARG4);
+
+    // Every instruction is a potential jump target and entry point, so give each of them a label up front.
+    Bytecode::InstructionStreamIterator it(m_bytecode_executable.bytecode, &m_bytecode_executable);
+    for (; !it.at_end(); ++it)
+        m_instruction_labels.set(it.offset(), m_assembler.make_label());
+
+    HashMap<size_t, size_t> entry_points;
+    Bytecode::InstructionStreamIterator compile_it(m_bytecode_executable.bytecode, &m_bytecode_executable);
+    for (; !compile_it.at_end(); ++compile_it) {
+        m_program_counter = compile_it.offset();
+        entry_points.set(m_program_counter, m_output.size());
+        m_instruction_labels.find(m_program_counter)->value.link(m_assembler);
+        compile_instruction(*compile_it);
+    }
+
+    // Epilogue: Every exit leaves the program counter in RAX and the exit kind in RDX, which is how an Exit is returned.
+    m_exit_label.link(m_assembler);
+    m_assembler.add64(Assembler::Reg::RSP, 8);
+    m_assembler.pop(ARGUMENT_ARRAY_BASE);
+    m_assembler.pop(PROGRAM_COUNTER_BASE);
+    m_assembler.pop(INTERPRETER_BASE);
+    m_assembler.pop(VALUE_ARRAY_BASE);
+    m_assembler.pop(Assembler::Reg::RBX);
+    m_assembler.pop(Assembler::Reg::RBP);
+    m_assembler.ret();
+
+    return NativeExecutable::create(m_output, move(entry_points));
+}
+
+#endif
+
+OwnPtr<NativeExecutable> Compiler::compile(Bytecode::Executable& bytecode_executable)
+{
+#if ARCH(X86_64)
+    Compiler compiler { bytecode_executable };
+    return compiler.compile_executable();
+#else
+    (void)bytecode_executable;
+    return nullptr;
+#endif
+}
+
+}
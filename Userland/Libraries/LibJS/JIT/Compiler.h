@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2026, agent <agent@local>
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/HashMap.h>
+#include <AK/OwnPtr.h>
+#include <LibJS/Bytecode/Op.h>
+#include <LibJS/Forward.h>
+#include <LibJS/JIT/Assembler.h>
+#include <LibJS/JIT/NativeExecutable.h>
+
+namespace JS::JIT {
+
+// The baseline JIT is enabled by default on x86-64, the only architecture it supports. An executable is compiled as
+// soon as either the number of times it has been entered, or the number of backward jumps taken in it, reaches
+// g_jit_threshold.
+extern bool g_jit_enabled;
+extern u32 g_jit_threshold;
+
+// A baseline compiler that turns a Bytecode::Executable into straight-line x86-64 code.
+//
+// Every instruction is compiled to a call to the same C++ code the interpreter would run for it, except for moves,
+// jumps, and int32 arithmetic and comparisons, which are done inline. Instructions that need the interpreter's
+// unwinding machinery (returns, yields, try/finally bookkeeping) and thrown exceptions exit back to the interpreter.
+class Compiler {
+public:
+    static OwnPtr<NativeExecutable> compile(Bytecode::Executable&);
+
+private:
+#if ARCH(X86_64)
+    static constexpr auto GPR0 = Assembler::Reg::RAX;
+    static constexpr auto GPR1 = Assembler::Reg::RCX;
+    static constexpr auto GPR2 = Assembler::Reg::RDX;
+    static constexpr auto ARG0 = Assembler::Reg::RDI;
+    static constexpr auto ARG1 = Assembler::Reg::RSI;
+    static constexpr auto ARG2 = Assembler::Reg::RDX;
+    static constexpr auto ARG3 = Assembler::Reg::RCX;
+    static constexpr auto ARG4 = Assembler::Reg::R8;
+
+    // These live in callee-saved registers for the whole run of the native code.
+    static constexpr auto VALUE_ARRAY_BASE = Assembler::Reg::R12;
+    static constexpr auto INTERPRETER_BASE = Assembler::Reg::R13;
+    static constexpr auto PROGRAM_COUNTER_BASE = Assembler::Reg::R14;
+    static constexpr auto ARGUMENT_ARRAY_BASE = Assembler::Reg::R15;
+
+    explicit Compiler(Bytecode::Executable& bytecode_executable)
+        : m_bytecode_executable(bytecode_executable)
+    {
+    }
+
+    OwnPtr<NativeExecutable> compile_executable();
+    void compile_instruction(Bytecode::Instruction const&);
+
+    void compile_mov(Bytecode::Op::Mov const&);
+    void compile_get_argument(Bytecode::Op::GetArgument const&);
+    void compile_set_argument(Bytecode::Op::SetArgument const&);
+    void compile_jump_if(Bytecode::Op::JumpIf const&);
+    void compile_jump_true(Bytecode::Op::JumpTrue const&);
+    void compile_jump_false(Bytecode::Op::JumpFalse const&);
+    void compile_jump_nullish(Bytecode::Op::JumpNullish const&);
+    void compile_jump_undefined(Bytecode::Op::JumpUndefined const&);
+    void compile_increment(Bytecode::Op::Increment const&);
+    void compile_decrement(Bytecode::Op::Decrement const&);
+
+    template<typename OpType, typename FastPath>
+    void compile_with_int32_fast_path(OpType const&, Bytecode::Operand lhs, Bytecode::Operand rhs, FastPath);
+    template<typename OpType>
+    void compile_int32_arithmetic(OpType const&, void (Assembler::*)(Assembler::Reg, Assembler::Reg), bool can_overflow);
+    template<typename OpType>
+    void compile_int32_comparison(OpType const&, Assembler::Condition);
+    template<typename OpType>
+    void compile_comparison_jump(OpType const&, Assembler::Condition, void* slow_case);
+    template<typename OpType>
+    void compile_call_to_instruction_handler(OpType const&);
+
+    void load_value(Assembler::Reg, Bytecode::Operand);
+    void store_value(Bytecode::Operand, Assembler::Reg);
+    void branch_if_not_int32(Assembler::Reg, Assembler::Label&);
+    void box_int32(Assembler::Reg);
+    void box_boolean(Assembler::Reg);
+    void compile_to_boolean(Bytecode::Operand);
+    void store_program_counter();
+    void exit_to_interpreter(NativeExecutable::ExitKind);
+    void exit_to_interpreter_if_thrown();
+
+    Assembler::Label& label_for(Bytecode::Label);
+
+    Vector<u8> m_output;
+    Assembler m_assembler { m_output };
+    Bytecode::Executable& m_bytecode_executable;
+    HashMap<size_t, Assembler::Label> m_instruction_labels;
+    Assembler::Label m_exit_label;
+    size_t m_program_counter { 0 };
+#endif
+};
+
+}
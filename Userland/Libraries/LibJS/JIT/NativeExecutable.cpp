@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2026, agent <agent@local>
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibJS/JIT/NativeExecutable.h>
+#include <sys/mman.h>
+
+namespace JS::JIT {
+
+// The native code is entered through a shared prologue at the start of the buffer, which takes the entry address of
+// the instruction to start at as its last argument. See Compiler::compile().
+using NativeFunction = NativeExecutable::Exit (*)(Value* registers_and_constants_and_locals, Value* arguments, Bytecode::Interpreter*, size_t* program_counter, void* entry);
+
+OwnPtr<NativeExecutable> NativeExecutable::create(ReadonlyBytes code, HashMap<size_t, size_t> entry_points)
+{
+    auto* memory = mmap(nullptr, code.size(), PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (memory == MAP_FAILED) {
+        perror("NativeExecutable: mmap");
+        return nullptr;
+    }
+    memcpy(memory, code.data(), code.size());
+    if (mprotect(memory, code.size(), PROT_READ | PROT_EXEC) < 0) {
+        perror("NativeExecutable: mprotect");
+        munmap(memory, code.size());
+        return nullptr;
+    }
+    return adopt_own(*new NativeExecutable(memory, code.size(), move(entry_points)));
+}
+
+NativeExecutable::NativeExecutable(void* code, size_t size, HashMap<size_t, size_t> entry_points)
+    : m_code(code)
+    , m_size(size)
+    , m_entry_points(move(entry_points))
+{
+}
+
+NativeExecutable::~NativeExecutable()
+{
+    munmap(m_code, m_size);
+}
+
+Optional<NativeExecutable::Exit> NativeExecutable::run(Bytecode::Interpreter& interpreter, Value* registers_and_constants_and_locals, Value* arguments, size_t& program_counter) const
+{
+    auto entry_point = m_entry_points.get(program_counter);
+    if (!entry_point.has_value())
+        return {};
+    auto function = reinterpret_cast<NativeFunction>(m_code);
+    return function(registers_and_constants_and_locals, arguments, &interpreter, &program_counter, static_cast<u8*>(m_code) + entry_point.value());
+}
+
+}
@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2026, agent <agent@local>
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/HashMap.h>
+#include <AK/Noncopyable.h>
+#include <AK/OwnPtr.h>
+#include <LibJS/Forward.h>
+
+namespace JS::JIT {
+
+// Machine code for a Bytecode::Executable, produced by JIT::Compiler.
+//
+// The native code operates directly on the registers, constants and locals of the running execution context, so
+// control can move between it and the bytecode interpreter at any instruction boundary without translating any state.
+class NativeExecutable {
+    AK_MAKE_NONCOPYABLE(NativeExecutable);
+    AK_MAKE_NONMOVABLE(NativeExecutable);
+
+public:
+    enum class ExitKind : u64 {
+        // The instruction at the exit's program counter should be run by the interpreter.
+        ContinueInInterpreter,
+        // The instruction at the exit's program counter threw, and the exception is in Register::exception().
+        Threw,
+    };
+
+    struct Exit {
+        size_t program_counter;
+        ExitKind kind;
+    };
+
+    static OwnPtr<NativeExecutable> create(ReadonlyBytes code, HashMap<size_t, size_t> entry_points);
+    ~NativeExecutable();
+
+    // Runs native code from the instruction at `program_counter` until it has to hand control back to the
+    // interpreter. `program_counter` is kept up to date whenever native code calls back into the runtime.
+    // Returns an empty Optional if there is no native code for that instruction.
+    [[nodiscard]] Optional<Exit> run(Bytecode::Interpreter&, Value* registers_and_constants_and_locals, Value* arguments, size_t& program_counter) const;
+
+    size_t size() const { return m_size; }
+
+private:
+    NativeExecutable(void* code, size_t size, HashMap<size_t, size_t> entry_points);
+
+    void* m_code { nullptr };
+    size_t m_size { 0 };
+
+    // Bytecode offset -> offset of the corresponding native code.
+    HashMap<size_t, size_t> m_entry_points;
+};
+
+}
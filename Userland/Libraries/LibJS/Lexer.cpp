@@ -223,7 +223,19 @@ static consteval Array<TokenType, 256> make_single_char_tokens_array()
 static constexpr auto s_single_char_tokens = make_single_char_tokens_array();
 
 Lexer::Lexer(StringView source, StringView filename, size_t line_number, size_t line_column)
+    : Lexer(source, filename, line_number, line_column, 0)
+{
+}
+
+Lexer::Lexer(StringView source, StringView filename, Position const& start)
+    : Lexer(source, filename, start.line, start.column - 1, start.offset)
+{
+    VERIFY(start.column > 0);
+}
+
+Lexer::Lexer(StringView source, StringView filename, size_t line_number, size_t line_column, size_t offset)
     : m_source(source)
+    , m_position(offset)
     , m_current_token(TokenType::Eof, {}, {}, {}, 0, 0, 0)
     , m_filename(String::from_utf8(filename).release_value_but_fixme_should_propagate_errors())
     , m_line_number(line_number)
@@ -12,16 +12,21 @@
 #include <AK/HashMap.h>
 #include <AK/String.h>
 #include <AK/StringView.h>
+#include <LibJS/Position.h>
 
 namespace JS {
 
 class Lexer {
 public:
+    // NOTE: The lexer doesn't copy `source`, so it has to outlive the lexer and the tokens it produces.
     explicit Lexer(StringView source, StringView filename = "(unknown)"sv, size_t line_number = 1, size_t line_column = 0);
 
+    // Starts lexing at the token at `start`, somewhere in the middle of `source`.
+    Lexer(StringView source, StringView filename, Position const& start);
+
     Token next();
 
-    ByteString const& source() const { return m_source; }
+    StringView source() const { return m_source; }
     String const& filename() const { return m_filename; }
 
     void disallow_html_comments() { m_allow_html_comments = false; }
@@ -29,6 +34,8 @@ public:
     Token force_slash_as_regex();
 
 private:
+    Lexer(StringView source, StringView filename, size_t line_number, size_t line_column, size_t offset);
+
     void consume();
     bool consume_exponent();
     bool consume_octal_number();
@@ -58,7 +65,7 @@ private:
 
     TokenType consume_regex_literal();
 
-    ByteString m_source;
+    StringView m_source;
     size_t m_position { 0 };
     Token m_current_token;
     char m_current_char { 0 };
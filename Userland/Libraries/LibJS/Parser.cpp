@@ -16,11 +16,14 @@
 #include <AK/ScopeGuard.h>
 #include <AK/StdLibExtras.h>
 #include <AK/TemporaryChange.h>
+#include <LibJS/Bytecode/ExecutableCache.h>
 #include <LibJS/Runtime/RegExpObject.h>
 #include <LibRegex/Regex.h>
 
 namespace JS {
 
+bool g_lazy_function_parsing = true;
+
 class ScopePusher {
 
     // NOTE: We really only need ModuleTopLevel and NotModuleTopLevel as the only
@@ -75,6 +78,18 @@ private:
     }
 
 public:
+    // Function, class and block nodes are collected by the function or program whose own code they are in, see
+    // Program::top_level_code_nodes() and FunctionBody::top_level_code_nodes().
+    void add_top_level_code_node(ASTNode const& node)
+    {
+        m_top_level_scope->m_top_level_code_nodes.append(node);
+    }
+
+    Vector<NonnullRefPtr<ASTNode const>> take_top_level_code_nodes()
+    {
+        return move(m_top_level_code_nodes);
+    }
+
     static ScopePusher function_scope(Parser& parser, RefPtr<Identifier const> function_name = nullptr)
     {
         ScopePusher scope_pusher(parser, nullptr, ScopeLevel::FunctionTopLevel, ScopeType::Function);
@@ -281,6 +296,9 @@ public:
             return;
         }
 
+        if ((m_type == ScopeType::Function || m_type == ScopeType::ClassStaticInit) && !m_top_level_code_nodes.is_empty())
+            static_cast<FunctionBody&>(*m_node).set_top_level_code_nodes(move(m_top_level_code_nodes));
+
         if (m_parent_scope && m_contains_direct_call_to_eval) {
             m_parent_scope->m_screwed_by_eval_in_scope_chain = true;
         }
@@ -491,6 +509,8 @@ private:
     ScopePusher* m_parent_scope { nullptr };
     ScopePusher* m_top_level_scope { nullptr };
 
+    Vector<NonnullRefPtr<ASTNode const>> m_top_level_code_nodes;
+
     HashTable<DeprecatedFlyString> m_lexical_names;
     HashTable<DeprecatedFlyString> m_var_names;
     HashTable<DeprecatedFlyString> m_function_names;
@@ -662,9 +682,10 @@ Parser::ParserState::ParserState(Lexer l, Program::Type program_type)
 }
 
 Parser::Parser(Lexer lexer, Program::Type program_type, Optional<EvalInitialState> initial_state_for_eval)
-    : m_source_code(SourceCode::create(lexer.filename(), String::from_byte_string(lexer.source()).release_value_but_fixme_should_propagate_errors()))
+    : m_source_code(SourceCode::create(lexer.filename(), String::from_utf8(lexer.source()).release_value_but_fixme_should_propagate_errors()))
     , m_state(move(lexer), program_type)
     , m_program_type(program_type)
+    , m_collects_top_level_code_nodes(!Bytecode::g_bytecode_cache_directory.is_empty())
 {
     if (initial_state_for_eval.has_value()) {
         m_state.initiated_by_eval = true;
@@ -675,6 +696,15 @@ Parser::Parser(Lexer lexer, Program::Type program_type, Optional<EvalInitialStat
     }
 }
 
+Parser::Parser(LazyFunctionSource const& lazy_function_source)
+    : m_source_code(lazy_function_source.source_code)
+    , m_state(Lexer(lazy_function_source.source_code->code(), lazy_function_source.source_code->filename(), lazy_function_source.function_start), lazy_function_source.program_type)
+    , m_program_type(lazy_function_source.program_type)
+    , m_collects_top_level_code_nodes(!Bytecode::g_bytecode_cache_directory.is_empty())
+{
+    m_state.strict_mode = lazy_function_source.strict_mode;
+}
+
 Associativity Parser::operator_associativity(TokenType type) const
 {
     switch (type) {
@@ -757,9 +787,16 @@ NonnullRefPtr<Program> Parser::parse_program(bool starts_in_strict_mode)
         parse_module(program);
 
     program->set_end_offset({}, position().offset);
+    program->set_top_level_code_nodes(program_scope.take_top_level_code_nodes());
     return program;
 }
 
+void Parser::add_top_level_code_node(ASTNode const& node)
+{
+    if (m_collects_top_level_code_nodes && m_state.current_scope_pusher)
+        m_state.current_scope_pusher->add_top_level_code_node(node);
+}
+
 void Parser::parse_script(Program& program, bool starts_in_strict_mode)
 {
     bool strict_before = m_state.strict_mode;
@@ -1134,10 +1171,12 @@ RefPtr<FunctionExpression const> Parser::try_parse_arrow_function_expression(boo
     auto function_start_offset = rule_start.position().offset;
     auto function_end_offset = position().offset - m_state.current_token.trivia().length();
     auto source_text = ByteString { m_state.lexer.source().substring_view(function_start_offset, function_end_offset - function_start_offset) };
-    return create_ast_node<FunctionExpression>(
+    auto function = create_ast_node<FunctionExpression>(
         { m_source_code, rule_start.position(), position() }, nullptr, move(source_text),
         move(body), move(parameters), function_length, function_kind, body->in_strict_mode(),
         parsing_insights, move(local_variables_names), /* is_arrow_function */ true);
+    add_top_level_code_node(*function);
+    return function;
 }
 
 RefPtr<LabelledStatement const> Parser::try_parse_labelled_statement(AllowLabelledFunction allow_function)
@@ -1658,7 +1697,9 @@ NonnullRefPtr<ClassExpression const> Parser::parse_class_expression(bool expect_
     auto function_end_offset = position().offset - m_state.current_token.trivia().length();
     auto source_text = ByteString { m_state.lexer.source().substring_view(function_start_offset, function_end_offset - function_start_offset) };
 
-    return create_ast_node<ClassExpression>({ m_source_code, rule_start.position(), position() }, move(class_name), move(source_text), move(constructor), move(super_class), move(elements));
+    auto class_expression = create_ast_node<ClassExpression>({ m_source_code, rule_start.position(), position() }, move(class_name), move(source_text), move(constructor), move(super_class), move(elements));
+    add_top_level_code_node(*class_expression);
+    return class_expression;
 }
 
 Parser::PrimaryExpressionParseResult Parser::parse_primary_expression()
@@ -2868,6 +2909,7 @@ NonnullRefPtr<BlockStatement const> Parser::parse_block_statement()
 {
     auto rule_start = push_start();
     auto block = create_ast_node<BlockStatement>({ m_source_code, rule_start.position(), position() });
+    add_top_level_code_node(*block);
     ScopePusher block_scope = ScopePusher::block_scope(*this, block);
     consume(TokenType::CurlyOpen);
     parse_statement_list(block);
@@ -2876,6 +2918,637 @@ NonnullRefPtr<BlockStatement const> Parser::parse_block_statement()
     return block;
 }
 
+bool Parser::can_skip_function_body(u16 parse_options) const
+{
+    if (!g_lazy_function_parsing)
+        return false;
+
+    // Only plain function declarations and expressions are skipped. Methods and accessors can refer to their home
+    // object, and default exports are parsed right away as well.
+    if ((parse_options & ~(FunctionNodeParseOptions::IsAsyncFunction | FunctionNodeParseOptions::IsGeneratorFunction)) != FunctionNodeParseOptions::CheckForFunctionAndName)
+        return false;
+
+    // A function without a surrounding scope is either being parsed on its own already, or about to be compiled.
+    VERIFY(m_state.current_scope_pusher);
+    if (!m_state.current_scope_pusher->parent_scope())
+        return false;
+
+    // Code inside a class body can refer to private names, which can only be checked while the class is being parsed.
+    if (m_state.referenced_private_names)
+        return false;
+
+    if (m_state.initiated_by_eval || m_state.in_catch_parameter_context)
+        return false;
+
+    // A directive prologue can make the function strict, which changes how its name and parameters have to be checked.
+    if (match(TokenType::StringLiteral))
+        return false;
+
+    return true;
+}
+
+static bool slash_after_token_starts_regex_literal(TokenType previous_token_type, bool previous_token_closed_statement_header, bool previous_token_closed_block)
+{
+    // The lexer decides between division and regex literals by looking at the previous token, which is wrong after
+    // keywords that are followed by an expression, after the header of an if or loop statement, and after a block.
+    // The parser knows better and re-lexes the slash, so we have to approximate that here.
+    switch (previous_token_type) {
+    case TokenType::Await:
+    case TokenType::Case:
+    case TokenType::Delete:
+    case TokenType::Do:
+    case TokenType::Else:
+    case TokenType::Extends:
+    case TokenType::In:
+    case TokenType::Instanceof:
+    case TokenType::New:
+    case TokenType::Return:
+    case TokenType::Throw:
+    case TokenType::Typeof:
+    case TokenType::Void:
+    case TokenType::Yield:
+        return true;
+    case TokenType::ParenClose:
+        return previous_token_closed_statement_header;
+    case TokenType::CurlyClose:
+        return previous_token_closed_block;
+    default:
+        return false;
+    }
+}
+
+// Whether a curly bracket after this token opens a block or function body, rather than an object literal.
+static bool curly_after_token_opens_block(TokenType previous_token_type)
+{
+    switch (previous_token_type) {
+    case TokenType::Arrow:
+    case TokenType::CurlyClose:
+    case TokenType::CurlyOpen:
+    case TokenType::Do:
+    case TokenType::Else:
+    case TokenType::Finally:
+    case TokenType::ParenClose:
+    case TokenType::Semicolon:
+    case TokenType::Try:
+        return true;
+    default:
+        return false;
+    }
+}
+
+static bool is_literal_token(TokenType type)
+{
+    switch (type) {
+    case TokenType::BigIntLiteral:
+    case TokenType::BoolLiteral:
+    case TokenType::NullLiteral:
+    case TokenType::NumericLiteral:
+    case TokenType::RegexFlags:
+    case TokenType::RegexLiteral:
+    case TokenType::StringLiteral:
+    case TokenType::TemplateLiteralEnd:
+    case TokenType::This:
+        return true;
+    default:
+        return false;
+    }
+}
+
+// Two operands in a row on the same line are a syntax error, unless one of them is a contextual keyword.
+static bool token_ends_operand(TokenType type)
+{
+    return type == TokenType::Identifier || type == TokenType::BracketClose || is_literal_token(type);
+}
+
+static bool token_starts_operand(TokenType type)
+{
+    return type == TokenType::Identifier || (is_literal_token(type) && type != TokenType::RegexFlags && type != TokenType::TemplateLiteralEnd);
+}
+
+static bool is_contextual_keyword(StringView name)
+{
+    return name.is_one_of("accessor"sv, "as"sv, "from"sv, "get"sv, "of"sv, "set"sv);
+}
+
+static bool is_assignment_operator(TokenType type)
+{
+    switch (type) {
+    case TokenType::AmpersandEquals:
+    case TokenType::AsteriskEquals:
+    case TokenType::CaretEquals:
+    case TokenType::DoubleAmpersandEquals:
+    case TokenType::DoubleAsteriskEquals:
+    case TokenType::DoublePipeEquals:
+    case TokenType::DoubleQuestionMarkEquals:
+    case TokenType::Equals:
+    case TokenType::MinusEquals:
+    case TokenType::PercentEquals:
+    case TokenType::PipeEquals:
+    case TokenType::PlusEquals:
+    case TokenType::ShiftLeftEquals:
+    case TokenType::ShiftRightEquals:
+    case TokenType::SlashEquals:
+    case TokenType::UnsignedShiftRightEquals:
+        return true;
+    default:
+        return false;
+    }
+}
+
+// Operators and keywords that can't be the last token of an expression.
+static bool token_requires_operand(TokenType type)
+{
+    if (is_assignment_operator(type))
+        return true;
+    switch (type) {
+    case TokenType::Ampersand:
+    case TokenType::Arrow:
+    case TokenType::Asterisk:
+    case TokenType::Caret:
+    case TokenType::Delete:
+    case TokenType::DoubleAmpersand:
+    case TokenType::DoubleAsterisk:
+    case TokenType::DoublePipe:
+    case TokenType::DoubleQuestionMark:
+    case TokenType::EqualsEquals:
+    case TokenType::EqualsEqualsEquals:
+    case TokenType::ExclamationMark:
+    case TokenType::ExclamationMarkEquals:
+    case TokenType::ExclamationMarkEqualsEquals:
+    case TokenType::GreaterThan:
+    case TokenType::GreaterThanEquals:
+    case TokenType::In:
+    case TokenType::Instanceof:
+    case TokenType::LessThan:
+    case TokenType::LessThanEquals:
+    case TokenType::Minus:
+    case TokenType::New:
+    case TokenType::Percent:
+    case TokenType::Period:
+    case TokenType::Pipe:
+    case TokenType::Plus:
+    case TokenType::QuestionMark:
+    case TokenType::QuestionMarkPeriod:
+    case TokenType::ShiftLeft:
+    case TokenType::ShiftRight:
+    case TokenType::Slash:
+    case TokenType::Throw:
+    case TokenType::Tilde:
+    case TokenType::TripleDot:
+    case TokenType::Typeof:
+    case TokenType::UnsignedShiftRight:
+    case TokenType::Void:
+        return true;
+    default:
+        return false;
+    }
+}
+
+static bool token_ends_expression(TokenType type)
+{
+    switch (type) {
+    case TokenType::Arrow:
+    case TokenType::BracketClose:
+    case TokenType::Colon:
+    case TokenType::Comma:
+    case TokenType::CurlyClose:
+    case TokenType::Eof:
+    case TokenType::Equals:
+    case TokenType::ParenClose:
+    case TokenType::Semicolon:
+    case TokenType::TemplateLiteralExprEnd:
+        return true;
+    default:
+        return false;
+    }
+}
+
+// A yield expression is an AssignmentExpression, so it can't be the operand of an operator that binds more tightly.
+static bool yield_expression_can_follow_token(TokenType type, bool closed_statement_header)
+{
+    if (is_assignment_operator(type))
+        return true;
+    switch (type) {
+    case TokenType::BracketOpen:
+    case TokenType::Case:
+    case TokenType::Colon:
+    case TokenType::Comma:
+    case TokenType::CurlyClose:
+    case TokenType::CurlyOpen:
+    case TokenType::Do:
+    case TokenType::Else:
+    case TokenType::ParenOpen:
+    case TokenType::QuestionMark:
+    case TokenType::Return:
+    case TokenType::Semicolon:
+    case TokenType::TemplateLiteralExprStart:
+    case TokenType::Throw:
+    case TokenType::TripleDot:
+    case TokenType::Yield:
+        return true;
+    case TokenType::ParenClose:
+        return closed_statement_header;
+    default:
+        return false;
+    }
+}
+
+static bool is_strict_mode_reserved_word(TokenType type)
+{
+    switch (type) {
+    case TokenType::Implements:
+    case TokenType::Interface:
+    case TokenType::Package:
+    case TokenType::Private:
+    case TokenType::Protected:
+    case TokenType::Public:
+        return true;
+    default:
+        return false;
+    }
+}
+
+static bool is_valid_regex_literal(StringView literal, StringView flags)
+{
+    auto parsed_flags = regex_flags_from_string(flags);
+    if (parsed_flags.is_error())
+        return false;
+    auto pattern = literal.substring_view(1, literal.length() - 2);
+    auto parsed_pattern = parse_regex_pattern(pattern, parsed_flags.value().has_flag_set(ECMAScriptFlags::Unicode), parsed_flags.value().has_flag_set(ECMAScriptFlags::UnicodeSets));
+    if (parsed_pattern.is_error())
+        return false;
+    return Regex<ECMA262>::parse_pattern(parsed_pattern.value(), parsed_flags.value()).error == regex::Error::NoError;
+}
+
+// Pre-parses the body of a function without building an AST for it. The function is parsed properly when it is first
+// called, see LazyFunctionSource.
+// Syntax errors still have to be reported right away, so the body is checked for the early errors that can be told
+// from its tokens: invalid tokens, regex literals and escape sequences, unbalanced brackets, operands and operators
+// that are missing or out of place, lexical declarations that clash with each other, with var declarations or with
+// parameters, break and continue without a target, misplaced await and yield, and what strict mode disallows.
+// We also have to find out which names the body uses, so that variables it captures from surrounding scopes don't
+// get turned into locals. Every name is treated as a reference, which errs on the side of capturing too much.
+// Returns nullptr if the body has an error, or anything that needs more context than the tokens to be checked. It's
+// then parsed normally, and the parser reports the error.
+RefPtr<FunctionBody const> Parser::skip_function_body(Position const& function_start, Vector<FunctionParameter> const& parameters, FunctionParsingInsights& parsing_insights)
+{
+    auto body_start = position();
+
+    // NOTE: We skim with a copy of the lexer, so that nothing has to be undone if we have to give up.
+    auto lexer = m_state.lexer;
+    auto token = m_state.current_token;
+    auto strict_mode = m_state.strict_mode;
+
+    struct OpenBracket {
+        TokenType closing_type;
+        size_t offset { 0 };
+        bool is_statement_header { false };
+        bool is_block { false };
+    };
+    Vector<OpenBracket, 16> open_brackets;
+
+    // Lexical declarations are kept along with the depth of the bracket they are in, until that bracket is closed.
+    struct LexicalDeclaration {
+        DeprecatedFlyString name;
+        size_t depth { 0 };
+    };
+    Vector<LexicalDeclaration> lexical_declarations;
+    HashMap<DeprecatedFlyString, size_t> var_declaration_offsets;
+    HashTable<DeprecatedFlyString> parameter_names;
+    for (auto const& parameter : parameters) {
+        parameter.binding.visit(
+            [&](NonnullRefPtr<Identifier const> const& identifier) { parameter_names.set(identifier->string()); },
+            [&](NonnullRefPtr<BindingPattern const> const& pattern) {
+                MUST(pattern->for_each_bound_identifier([&](auto const& identifier) -> ThrowCompletionOr<void> {
+                    parameter_names.set(identifier.string());
+                    return {};
+                }));
+            });
+    }
+
+    auto declare_lexical_name = [&](DeprecatedFlyString const& name) {
+        auto depth = open_brackets.size();
+        for (auto const& declaration : lexical_declarations.in_reverse()) {
+            if (declaration.depth != depth)
+                break;
+            if (declaration.name == name)
+                return false;
+        }
+        if (depth == 0 && parameter_names.contains(name))
+            return false;
+        // A var declaration that came after the start of the block that the lexical declaration is in hoists past it.
+        auto block_start = depth == 0 ? body_start.offset : open_brackets.last().offset;
+        if (auto var_offset = var_declaration_offsets.get(name); var_offset.has_value() && *var_offset >= block_start)
+            return false;
+        lexical_declarations.append({ name, depth });
+        return true;
+    };
+    auto declare_var_name = [&](DeprecatedFlyString const& name, size_t offset) {
+        if (any_of(lexical_declarations, [&](auto const& declaration) { return declaration.name == name; }))
+            return false;
+        var_declaration_offsets.set(name, offset);
+        return true;
+    };
+
+    HashTable<DeprecatedFlyString> seen_names;
+    HashTable<DeprecatedFlyString> label_names;
+    Vector<Token> name_tokens;
+    bool contains_eval = false;
+    bool seen_async = false;
+    bool seen_generator = false;
+    bool seen_loop = false;
+    bool seen_switch = false;
+    Optional<StringView> pending_regex_literal;
+
+    auto previous_token = token;
+    auto previous_token_type = TokenType::CurlyOpen;
+    bool previous_token_was_period = false;
+    bool previous_token_closed_statement_header = false;
+    bool previous_token_closed_block = false;
+    bool previous_token_was_property_name = false;
+    bool previous_token_is_deleted_identifier = false;
+
+    for (;; token = lexer.next()) {
+        if (token.type() == TokenType::Slash || token.type() == TokenType::SlashEquals) {
+            if (!previous_token_was_period && slash_after_token_starts_regex_literal(previous_token_type, previous_token_closed_statement_header, previous_token_closed_block))
+                token = lexer.force_slash_as_regex();
+        }
+
+        auto type = token.type();
+        auto value = token.value();
+        bool on_same_line = !token.trivia_contains_line_terminator();
+        bool is_property_name = previous_token_was_period;
+
+        if (pending_regex_literal.has_value()) {
+            if (!is_valid_regex_literal(*pending_regex_literal, type == TokenType::RegexFlags ? value : ""sv))
+                return nullptr;
+            pending_regex_literal.clear();
+        }
+
+        // NOTE: await and yield are only keywords inside async functions and generators. The body might contain a
+        //       nested one, in which case we can't tell which one they are in, but treating them as keywords then is
+        //       the right call for well-formed code.
+        auto effective_type = type;
+        if (!is_property_name) {
+            if (type == TokenType::Await && !m_state.await_expression_is_valid && !seen_async) {
+                if (m_program_type == Program::Type::Module || previous_token_type == TokenType::For)
+                    return nullptr;
+                effective_type = TokenType::Identifier;
+            }
+            if (type == TokenType::Yield && !m_state.in_generator_function_context && !seen_generator) {
+                if (strict_mode)
+                    return nullptr;
+                effective_type = TokenType::Identifier;
+            }
+        }
+
+        if (on_same_line && token_ends_operand(previous_token_type) && token_starts_operand(effective_type)
+            && !(previous_token_type == TokenType::Identifier && is_contextual_keyword(previous_token.value()))
+            && !(effective_type == TokenType::Identifier && is_contextual_keyword(value)))
+            return nullptr;
+        if (token_requires_operand(previous_token_type) && token_ends_expression(type))
+            return nullptr;
+        if (previous_token_type == TokenType::Await && token_ends_expression(type))
+            return nullptr;
+        if (is_assignment_operator(type) || ((type == TokenType::PlusPlus || type == TokenType::MinusMinus) && on_same_line)) {
+            if (is_literal_token(previous_token_type))
+                return nullptr;
+            if (strict_mode && previous_token_type == TokenType::Identifier && !previous_token_was_property_name && previous_token.value().is_one_of("eval"sv, "arguments"sv))
+                return nullptr;
+        }
+        if (type == TokenType::Arrow && !on_same_line)
+            return nullptr;
+        if (type == TokenType::Yield && effective_type == TokenType::Yield && m_state.in_generator_function_context
+            && on_same_line && !yield_expression_can_follow_token(previous_token_type, previous_token_closed_statement_header))
+            return nullptr;
+        if (previous_token_is_deleted_identifier && type != TokenType::Period && type != TokenType::BracketOpen && type != TokenType::ParenOpen && type != TokenType::QuestionMarkPeriod)
+            return nullptr;
+        previous_token_is_deleted_identifier = false;
+
+        if (type == TokenType::CurlyClose && open_brackets.is_empty())
+            break;
+
+        bool closes_statement_header = false;
+        bool closes_block = false;
+        switch (type) {
+        case TokenType::CurlyOpen:
+            open_brackets.append({ TokenType::CurlyClose, token.offset(), false, curly_after_token_opens_block(previous_token_type) });
+            break;
+        case TokenType::BracketOpen:
+            open_brackets.append({ TokenType::BracketClose, token.offset() });
+            break;
+        case TokenType::TemplateLiteralExprStart:
+            open_brackets.append({ TokenType::TemplateLiteralExprEnd, token.offset() });
+            break;
+        case TokenType::ParenOpen: {
+            auto is_statement_header = !previous_token_was_period
+                && (previous_token_type == TokenType::If || previous_token_type == TokenType::For || previous_token_type == TokenType::While || previous_token_type == TokenType::With);
+            open_brackets.append({ TokenType::ParenClose, token.offset(), is_statement_header });
+            break;
+        }
+        case TokenType::CurlyClose:
+        case TokenType::BracketClose:
+        case TokenType::ParenClose:
+        case TokenType::TemplateLiteralExprEnd: {
+            if (open_brackets.is_empty() || open_brackets.last().closing_type != type)
+                return nullptr;
+            auto bracket = open_brackets.take_last();
+            closes_statement_header = bracket.is_statement_header;
+            closes_block = bracket.is_block;
+            while (!lexical_declarations.is_empty() && lexical_declarations.last().depth > open_brackets.size())
+                lexical_declarations.take_last();
+            break;
+        }
+        case TokenType::StringLiteral:
+            if (value.contains('\\')) {
+                Token::StringValueStatus status;
+                (void)token.string_value(status);
+                if (status != Token::StringValueStatus::Ok && (status != Token::StringValueStatus::LegacyOctalEscapeSequence || strict_mode))
+                    return nullptr;
+            }
+            break;
+        case TokenType::TemplateLiteralString:
+            // NOTE: Only tagged templates may contain malformed escapes, so we leave anything that might be one to the parser.
+            for (size_t i = value.find('\\').value_or(value.length()); i + 1 < value.length(); ++i) {
+                if (value[i] == '\\' && (value[i + 1] == 'u' || value[i + 1] == 'x' || is_ascii_digit(value[i + 1])))
+                    return nullptr;
+            }
+            break;
+        case TokenType::NumericLiteral:
+            if (strict_mode && value.length() > 1 && value[0] == '0' && is_ascii_digit(value[1]))
+                return nullptr;
+            break;
+        case TokenType::RegexLiteral:
+            pending_regex_literal = value;
+            break;
+        case TokenType::Async:
+            seen_async = true;
+            break;
+        case TokenType::Asterisk:
+            if (previous_token_type == TokenType::Function || previous_token_type == TokenType::CurlyOpen || previous_token_type == TokenType::Comma || previous_token_type == TokenType::Static)
+                seen_generator = true;
+            break;
+        case TokenType::For:
+        case TokenType::While:
+        case TokenType::Do:
+            seen_loop = true;
+            break;
+        case TokenType::Switch:
+            seen_switch = true;
+            break;
+        case TokenType::With:
+            if (strict_mode)
+                return nullptr;
+            break;
+        case TokenType::Colon:
+            // NOTE: This also picks up object keys and conditional expressions, which is fine for checking that a
+            //       label exists.
+            if (previous_token_type == TokenType::Identifier)
+                label_names.set(previous_token.DeprecatedFlyString_value());
+            break;
+        case TokenType::Enum:
+        case TokenType::Export:
+            if (!is_property_name)
+                return nullptr;
+            break;
+        default:
+            break;
+        }
+
+        if (is_strict_mode_reserved_word(type) && strict_mode && !is_property_name)
+            return nullptr;
+
+        if (!previous_token_was_property_name) {
+            switch (previous_token_type) {
+            case TokenType::Break:
+            case TokenType::Continue:
+                if (effective_type == TokenType::Identifier && on_same_line) {
+                    if (!label_names.contains(token.DeprecatedFlyString_value()))
+                        return nullptr;
+                } else if (!seen_loop && (previous_token_type == TokenType::Continue || !seen_switch)) {
+                    return nullptr;
+                }
+                break;
+            case TokenType::Let:
+            case TokenType::Const:
+            case TokenType::Class:
+                if (effective_type == TokenType::Identifier && !declare_lexical_name(token.DeprecatedFlyString_value()))
+                    return nullptr;
+                break;
+            case TokenType::Var:
+                if (effective_type == TokenType::Identifier && !declare_var_name(token.DeprecatedFlyString_value(), token.offset()))
+                    return nullptr;
+                break;
+            case TokenType::Function:
+                if (type == TokenType::Await || type == TokenType::Yield)
+                    return nullptr;
+                break;
+            case TokenType::ParenClose:
+                // Declarations can't be the body of an if or loop statement.
+                if (previous_token_closed_statement_header && (type == TokenType::Function || type == TokenType::Class || type == TokenType::Const))
+                    return nullptr;
+                break;
+            case TokenType::Delete:
+                if (strict_mode && effective_type == TokenType::Identifier)
+                    previous_token_is_deleted_identifier = true;
+                break;
+            // import.meta is only allowed in modules, and import declarations only at the top level.
+            case TokenType::Import:
+                if (type != TokenType::ParenOpen)
+                    return nullptr;
+                break;
+            default:
+                break;
+            }
+
+            if (strict_mode && effective_type == TokenType::Identifier && !is_property_name && value.is_one_of("eval"sv, "arguments"sv)) {
+                switch (previous_token_type) {
+                case TokenType::Class:
+                case TokenType::Const:
+                case TokenType::Function:
+                case TokenType::Let:
+                case TokenType::MinusMinus:
+                case TokenType::PlusPlus:
+                case TokenType::Var:
+                    return nullptr;
+                default:
+                    break;
+                }
+            }
+        }
+
+        switch (type) {
+        case TokenType::Identifier:
+        case TokenType::Async:
+        case TokenType::Await:
+        case TokenType::Let:
+        case TokenType::Yield:
+        case TokenType::Static:
+        case TokenType::Implements:
+        case TokenType::Interface:
+        case TokenType::Package:
+        case TokenType::Private:
+        case TokenType::Protected:
+        case TokenType::Public:
+            if (is_property_name)
+                break;
+            if (value == "eval"sv)
+                contains_eval = true;
+            if (seen_names.set(token.DeprecatedFlyString_value()) == AK::HashSetResult::InsertedNewEntry)
+                name_tokens.append(token);
+            break;
+        // These are either errors or need context we don't have, so we leave them to the parser.
+        case TokenType::Eof:
+        case TokenType::EscapedKeyword:
+        case TokenType::Invalid:
+        case TokenType::PrivateIdentifier:
+        case TokenType::Super:
+        case TokenType::UnterminatedRegexLiteral:
+        case TokenType::UnterminatedStringLiteral:
+        case TokenType::UnterminatedTemplateLiteral:
+            return nullptr;
+        default:
+            break;
+        }
+
+        previous_token = token;
+        previous_token_type = effective_type;
+        previous_token_was_period = type == TokenType::Period || type == TokenType::QuestionMarkPeriod;
+        previous_token_was_property_name = is_property_name;
+        previous_token_closed_statement_header = closes_statement_header;
+        previous_token_closed_block = closes_block;
+    }
+
+    // We're now at the closing curly bracket, which parse_function_node() consumes as usual.
+    m_state.lexer = move(lexer);
+    m_state.current_token = token;
+
+    auto function_body = create_ast_node<FunctionBody>({ m_source_code, body_start, position() });
+    if (m_state.strict_mode)
+        function_body->set_strict_mode();
+
+    VERIFY(m_state.current_scope_pusher->type() == ScopePusher::ScopeType::Function);
+    m_state.current_scope_pusher->set_scope_node(function_body);
+    m_state.current_scope_pusher->set_function_parameters(parameters);
+    for (auto const& name_token : name_tokens) {
+        auto name_position = Position { name_token.line_number(), name_token.line_column(), name_token.offset() };
+        (void)create_identifier_and_register_in_current_scope({ m_source_code, name_position, name_position }, name_token.DeprecatedFlyString_value());
+    }
+    if (contains_eval)
+        m_state.current_scope_pusher->set_contains_direct_call_to_eval();
+    parsing_insights.contains_direct_call_to_eval = contains_eval;
+
+    function_body->set_lazy_function_source(make<LazyFunctionSource>(LazyFunctionSource {
+        .source_code = m_source_code,
+        .function_start = function_start,
+        .function_end_offset = token.offset(),
+        .program_type = m_program_type,
+        .strict_mode = m_state.strict_mode,
+    }));
+
+    return function_body;
+}
+
 template<typename FunctionNodeType>
 NonnullRefPtr<FunctionNodeType> Parser::parse_function_node(u16 parse_options, Optional<Position> const& function_start)
 {
@@ -2966,6 +3639,11 @@ NonnullRefPtr<FunctionNodeType> Parser::parse_function_node(u16 parse_options, O
 
         consume(TokenType::CurlyOpen);
 
+        if (can_skip_function_body(parse_options)) {
+            if (auto body = skip_function_body(rule_start.position(), parameters, parsing_insights))
+                return body.release_nonnull();
+        }
+
         auto body = parse_function_body(parameters, function_kind, parsing_insights);
         return body;
     }();
@@ -2982,11 +3660,13 @@ NonnullRefPtr<FunctionNodeType> Parser::parse_function_node(u16 parse_options, O
     auto function_end_offset = position().offset - m_state.current_token.trivia().length();
     auto source_text = ByteString { m_state.lexer.source().substring_view(function_start_offset, function_end_offset - function_start_offset) };
     parsing_insights.might_need_arguments_object = m_state.function_might_need_arguments_object;
-    return create_ast_node<FunctionNodeType>(
+    auto function = create_ast_node<FunctionNodeType>(
         { m_source_code, rule_start.position(), position() },
         name, move(source_text), move(body), move(parameters), function_length,
         function_kind, has_strict_directive, parsing_insights,
         move(local_variables_names));
+    add_top_level_code_node(*function);
+    return function;
 }
 
 Vector<FunctionParameter> Parser::parse_formal_parameters(int& function_length, u16 parse_options)
@@ -3697,6 +4377,7 @@ NonnullRefPtr<SwitchStatement const> Parser::parse_switch_statement()
     Vector<NonnullRefPtr<SwitchCase>> cases;
 
     auto switch_statement = create_ast_node<SwitchStatement>({ m_source_code, rule_start.position(), position() }, move(determinant));
+    add_top_level_code_node(*switch_statement);
 
     ScopePusher switch_scope = ScopePusher::block_scope(*this, switch_statement);
 
@@ -3726,6 +4407,7 @@ NonnullRefPtr<WithStatement const> Parser::parse_with_statement()
     consume(TokenType::ParenClose);
 
     auto with_scope_node = create_ast_node<BlockStatement>({ m_source_code, rule_start.position(), position() });
+    add_top_level_code_node(*with_scope_node);
     ScopePusher with_scope = ScopePusher::with_scope(*this, with_scope_node);
 
     auto body = parse_statement();
@@ -3827,6 +4509,7 @@ NonnullRefPtr<IfStatement const> Parser::parse_if_statement()
         // compatibility semantics specified in B.3.2.
         VERIFY(match(TokenType::Function));
         auto block = create_ast_node<BlockStatement>({ m_source_code, rule_start.position(), position() });
+        add_top_level_code_node(*block);
         ScopePusher block_scope = ScopePusher::block_scope(*this, *block);
         auto declaration = parse_declaration();
         VERIFY(m_state.current_scope_pusher);
@@ -3870,6 +4553,7 @@ NonnullRefPtr<Statement const> Parser::parse_for_statement()
     auto is_await_loop = IsForAwaitLoop::No;
 
     auto loop_scope_node = create_ast_node<BlockStatement>({ m_source_code, rule_start.position(), position() });
+    add_top_level_code_node(*loop_scope_node);
     ScopePusher for_loop_scope = ScopePusher::for_loop_scope(*this, *loop_scope_node);
 
     auto match_of = [&](Token const& token) {
@@ -44,6 +44,11 @@ struct FunctionNodeParseOptions {
 
 class ScopePusher;
 
+// When enabled (the default), the bodies of plain function declarations and expressions are only skimmed over when the
+// code around them is parsed, and are parsed properly the first time the function is called. Bodies the skim can't
+// vouch for are parsed right away, so early errors are still reported up front.
+extern bool g_lazy_function_parsing;
+
 class Parser {
 public:
     struct EvalInitialState {
@@ -55,6 +60,9 @@ public:
 
     explicit Parser(Lexer lexer, Program::Type program_type = Program::Type::Script, Optional<EvalInitialState> initial_state_for_eval = {});
 
+    // Sets up a parser for the function that was skipped over, use parse_function_node<FunctionExpression>() to parse it.
+    explicit Parser(LazyFunctionSource const&);
+
     NonnullRefPtr<Program> parse_program(bool starts_in_strict_mode = false);
 
     template<typename FunctionNodeType>
@@ -269,7 +277,10 @@ private:
     bool match_invalid_escaped_keyword() const;
 
     bool parse_directive(ScopeNode& body);
+    bool can_skip_function_body(u16 parse_options) const;
+    RefPtr<FunctionBody const> skip_function_body(Position const& function_start, Vector<FunctionParameter> const& parameters, FunctionParsingInsights&);
     void parse_statement_list(ScopeNode& output_node, AllowLabelledFunction allow_labelled_functions = AllowLabelledFunction::No);
+    void add_top_level_code_node(ASTNode const&);
 
     DeprecatedFlyString consume_string_value();
     ModuleRequest parse_module_request();
@@ -343,5 +354,8 @@ private:
     Vector<ParserState> m_saved_state;
     HashMap<size_t, TokenMemoization> m_token_memoizations;
     Program::Type m_program_type;
+
+    // Only the bytecode cache needs to know which nodes are in which function's code.
+    bool m_collects_top_level_code_nodes { false };
 };
 }
@@ -16,6 +16,8 @@ namespace JS {
 class Accessor final : public Cell {
     JS_CELL(Accessor, Cell);
     JS_DECLARE_ALLOCATOR(Accessor);
+    JS_WRITE_BARRIERED_CELL(Accessor);
+    JS_CONCURRENTLY_SWEPT_CELL(Accessor);
 
 public:
     static NonnullGCPtr<Accessor> create(VM& vm, FunctionObject* getter, FunctionObject* setter)
@@ -22,6 +22,7 @@ namespace JS {
 class Array : public Object {
     JS_OBJECT(Array, Object);
     JS_DECLARE_ALLOCATOR(Array);
+    JS_WRITE_BARRIERED_CELL(Array);
 
 public:
     static ThrowCompletionOr<NonnullGCPtr<Array>> create(Realm&, u64 length, Object* prototype = nullptr);
@@ -145,6 +145,86 @@ static ThrowCompletionOr<Object*> array_species_create(VM& vm, Object& original_
     return TRY(construct(vm, constructor.as_function(), Value(length))).ptr();
 }
 
+// OPTIMIZATION: Plain arrays with simple storage can have their elements read and written directly, as long as we stop
+//               at the first hole (which may be filled in from the prototype chain).
+static SimpleIndexedPropertyStorage* simple_array_storage(Object& object)
+{
+    if (!is<Array>(object) || object.may_interfere_with_indexed_property_access())
+        return nullptr;
+    auto* storage = object.indexed_properties().storage();
+    if (!storage || !storage->is_simple_storage())
+        return nullptr;
+    return static_cast<SimpleIndexedPropertyStorage*>(storage);
+}
+
+static bool can_append_to_array_directly(VM& vm, Object& object)
+{
+    if (!is<Array>(object) || object.may_interfere_with_indexed_property_access())
+        return false;
+    if (!static_cast<Array&>(object).length_is_writable())
+        return false;
+
+    auto& intrinsics = vm.current_realm()->intrinsics();
+    auto array_prototype = intrinsics.array_prototype();
+    auto object_prototype = intrinsics.object_prototype();
+    if (object.shape().prototype() != array_prototype.ptr() || array_prototype->shape().prototype() != object_prototype.ptr())
+        return false;
+    return array_prototype->indexed_properties().is_empty() && object_prototype->indexed_properties().is_empty();
+}
+
+enum class SearchSemantics {
+    IsStrictlyEqual,
+    SameValueZero,
+};
+
+// Searches the elements from k up to length for search_element, without any observable side effects. Stops at the
+// first hole, leaving k pointing at it, so that the caller can continue with the generic algorithm from there.
+static Optional<size_t> search_simple_array(SimpleIndexedPropertyStorage const& storage, size_t& k, size_t length, Value search_element, SearchSemantics semantics)
+{
+    auto end = min(length, storage.array_like_size());
+    bool search_element_is_number = search_element.is_number();
+    double number = search_element_is_number ? search_element.as_double() : 0;
+
+    switch (storage.element_kind()) {
+    case SimpleIndexedPropertyStorage::ElementKind::PackedInt32: {
+        auto elements = storage.int32_elements();
+        if (!search_element_is_number) {
+            k = end;
+            return {};
+        }
+        for (; k < end; ++k) {
+            if (elements[k] == number)
+                return k;
+        }
+        return {};
+    }
+    case SimpleIndexedPropertyStorage::ElementKind::Double: {
+        auto elements = storage.double_elements();
+        bool nan_matches = search_element_is_number && isnan(number) && semantics == SearchSemantics::SameValueZero;
+        for (; k < end; ++k) {
+            auto element = elements[k];
+            if (SimpleIndexedPropertyStorage::is_hole(element))
+                return {};
+            if (search_element_is_number && (element == number || (nan_matches && isnan(element))))
+                return k;
+        }
+        return {};
+    }
+    case SimpleIndexedPropertyStorage::ElementKind::Generic: {
+        auto const& elements = storage.elements();
+        for (; k < end; ++k) {
+            auto element = elements[k];
+            if (element.is_empty())
+                return {};
+            if (semantics == SearchSemantics::SameValueZero ? same_value_zero(element, search_element) : is_strictly_equal(search_element, element))
+                return k;
+        }
+        return {};
+    }
+    }
+    VERIFY_NOT_REACHED();
+}
+
 // 23.1.3.1 Array.prototype.at ( index ), https://tc39.es/ecma262/#sec-array.prototype.at
 JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::at)
 {
@@ -379,6 +459,13 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::fill)
     else
         to = min(relative_end, length);
 
+    // OPTIMIZATION: Overwriting existing elements of a plain array can't run any user code.
+    if (auto* storage = simple_array_storage(this_object); storage && to <= storage->array_like_size() && from < to && storage->is_packed_in_range(from, to)) {
+        storage->fill(from, to, vm.argument(0));
+        write_barrier(*this_object, vm.argument(0));
+        return this_object;
+    }
+
     for (u64 i = from; i < to; i++)
         TRY(this_object->set(i, vm.argument(0), Object::ShouldThrowExceptions::Yes));
 
@@ -742,7 +829,14 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::includes)
             from_index = from_argument;
     }
     auto value_to_find = vm.argument(0);
-    for (u64 i = from_index; i < length; ++i) {
+
+    size_t start_index = from_index;
+    if (auto const* storage = simple_array_storage(this_object)) {
+        if (search_simple_array(*storage, start_index, length, value_to_find, SearchSemantics::SameValueZero).has_value())
+            return Value(true);
+    }
+
+    for (u64 i = start_index; i < length; ++i) {
         auto element = TRY(this_object->get(i));
         if (same_value_zero(element, value_to_find))
             return Value(true);
@@ -795,6 +889,11 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::index_of)
         k = max(length + n, 0);
     }
 
+    if (auto const* storage = simple_array_storage(object)) {
+        if (auto index = search_simple_array(*storage, k, length, search_element, SearchSemantics::IsStrictlyEqual); index.has_value())
+            return Value(*index);
+    }
+
     // 10. Repeat, while k < len,
     for (; k < length; ++k) {
         auto property_key = PropertyKey { k };
@@ -1005,6 +1104,17 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::push)
     auto new_length = length + argument_count;
     if (new_length > MAX_ARRAY_LIKE_INDEX)
         return vm.throw_completion<TypeError>(ErrorType::ArrayMaxSize);
+
+    // OPTIMIZATION: Appending to a plain array whose prototype chain has no indexed properties (and so no setters
+    //               that [[Set]] could find) is just adding data properties.
+    if (new_length < NumericLimits<u32>::max() && can_append_to_array_directly(vm, this_object) && TRY(this_object->is_extensible())) {
+        for (size_t i = 0; i < argument_count; ++i) {
+            this_object->indexed_properties().put(length + i, vm.argument(i));
+            write_barrier(*this_object, vm.argument(i));
+        }
+        return Value(new_length);
+    }
+
     for (size_t i = 0; i < argument_count; ++i)
         TRY(this_object->set(length + i, vm.argument(i), Object::ShouldThrowExceptions::Yes));
     auto new_length_value = Value(new_length);
@@ -18,6 +18,8 @@ namespace JS {
 class BigInt final : public Cell {
     JS_CELL(BigInt, Cell);
     JS_DECLARE_ALLOCATOR(BigInt);
+    JS_WRITE_BARRIERED_CELL(BigInt);
+    JS_CONCURRENTLY_SWEPT_CELL(BigInt);
 
 public:
     [[nodiscard]] static NonnullGCPtr<BigInt> create(VM&, Crypto::SignedBigInteger);
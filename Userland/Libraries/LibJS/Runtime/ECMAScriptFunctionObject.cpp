@@ -13,6 +13,7 @@
 #include <LibJS/Bytecode/BasicBlock.h>
 #include <LibJS/Bytecode/Generator.h>
 #include <LibJS/Bytecode/Interpreter.h>
+#include <LibJS/Parser.h>
 #include <LibJS/Runtime/AbstractOperations.h>
 #include <LibJS/Runtime/Array.h>
 #include <LibJS/Runtime/AsyncFunctionDriverWrapper.h>
@@ -102,6 +103,18 @@ ECMAScriptFunctionObject::ECMAScriptFunctionObject(DeprecatedFlyString name, Byt
         return true;
     });
 
+    // NOTE: If the parser skipped over the function body, everything that depends on it has to wait until the function
+    //       is first called.
+    if (is<FunctionBody>(*m_ecmascript_code) && static_cast<FunctionBody const&>(*m_ecmascript_code).lazy_function_source()) {
+        m_was_skipped_by_parser = true;
+        return;
+    }
+
+    prepare_function_declaration_instantiation(parsing_insights);
+}
+
+void ECMAScriptFunctionObject::prepare_function_declaration_instantiation(FunctionParsingInsights const& parsing_insights)
+{
     // NOTE: The following steps are from FunctionDeclarationInstantiation that could be executed once
     //       and then reused in all subsequent function instantiations.
 
@@ -385,13 +398,8 @@ ThrowCompletionOr<Value> ECMAScriptFunctionObject::internal_call(Value this_argu
     auto callee_context = ExecutionContext::create();
 
     // Non-standard
-    callee_context->arguments.ensure_capacity(max(arguments_list.size(), m_formal_parameters.size()));
-    callee_context->arguments.append(arguments_list.data(), arguments_list.size());
+    callee_context->set_arguments(arguments_list, m_formal_parameters.size());
     callee_context->passed_argument_count = arguments_list.size();
-    if (arguments_list.size() < m_formal_parameters.size()) {
-        for (size_t i = arguments_list.size(); i < m_formal_parameters.size(); ++i)
-            callee_context->arguments.append(js_undefined());
-    }
 
     // 2. Let calleeContext be PrepareForOrdinaryCall(F, undefined).
     // NOTE: We throw if the end of the native stack is reached, so unlike in the spec this _does_ need an exception check.
@@ -459,13 +467,8 @@ ThrowCompletionOr<NonnullGCPtr<Object>> ECMAScriptFunctionObject::internal_const
     auto callee_context = ExecutionContext::create();
 
     // Non-standard
-    callee_context->arguments.ensure_capacity(max(arguments_list.size(), m_formal_parameters.size()));
-    callee_context->arguments.append(arguments_list.data(), arguments_list.size());
+    callee_context->set_arguments(arguments_list, m_formal_parameters.size());
     callee_context->passed_argument_count = arguments_list.size();
-    if (arguments_list.size() < m_formal_parameters.size()) {
-        for (size_t i = arguments_list.size(); i < m_formal_parameters.size(); ++i)
-            callee_context->arguments.append(js_undefined());
-    }
 
     // 4. Let calleeContext be PrepareForOrdinaryCall(F, newTarget).
     // NOTE: We throw if the end of the native stack is reached, so unlike in the spec this _does_ need an exception check.
@@ -567,11 +570,50 @@ void ECMAScriptFunctionObject::make_method(Object& home_object)
     // 2. Return unused.
 }
 
+ThrowCompletionOr<void> ECMAScriptFunctionObject::parse_lazily_skipped_function()
+{
+    auto& vm = this->vm();
+    auto const& lazy_function_source = *static_cast<FunctionBody const&>(*m_ecmascript_code).lazy_function_source();
+
+    if (!lazy_function_source.parsed_function) {
+        Parser parser(lazy_function_source);
+        auto function = parser.parse_function_node<FunctionExpression>();
+        if (parser.has_errors())
+            return vm.throw_completion<SyntaxError>(parser.errors()[0].to_string());
+
+        // NOTE: The function must end where the parser thought it did when skipping over it, or the code around it
+        //       wasn't parsed correctly either.
+        auto expected_length = lazy_function_source.function_end_offset + 1 - lazy_function_source.function_start.offset;
+        if (function->source_text().length() != expected_length)
+            return vm.throw_completion<SyntaxError>(ErrorType::LazilyParsedFunctionMismatch, m_name);
+
+        lazy_function_source.parsed_function = move(function);
+    }
+
+    auto const& function = *lazy_function_source.parsed_function;
+    VERIFY(function.kind() == m_kind);
+    VERIFY(function.is_strict_mode() == m_strict);
+
+    m_ecmascript_code = function.body();
+    m_formal_parameters = function.parameters();
+    m_local_variables_names = function.local_variables_names();
+    m_might_need_arguments_object = function.might_need_arguments_object();
+    m_contains_direct_call_to_eval = function.contains_direct_call_to_eval();
+    m_was_skipped_by_parser = false;
+
+    prepare_function_declaration_instantiation(function.parsing_insights());
+    return {};
+}
+
 // 10.2.1.1 PrepareForOrdinaryCall ( F, newTarget ), https://tc39.es/ecma262/#sec-prepareforordinarycall
 ThrowCompletionOr<void> ECMAScriptFunctionObject::prepare_for_ordinary_call(ExecutionContext& callee_context, Object* new_target)
 {
     auto& vm = this->vm();
 
+    // Non-standard
+    if (m_was_skipped_by_parser) [[unlikely]]
+        TRY(parse_lazily_skipped_function());
+
     // Non-standard
     callee_context.is_strict_mode = m_strict;
 
@@ -832,7 +874,7 @@ Completion ECMAScriptFunctionObject::ordinary_call_evaluate_body()
         m_bytecode_executable = m_ecmascript_code->bytecode_executable();
     }
 
-    vm.running_execution_context().registers_and_constants_and_locals.resize(m_local_variables_names.size() + m_bytecode_executable->number_of_registers + m_bytecode_executable->constants.size());
+    vm.running_execution_context().ensure_registers_and_constants_and_locals_count(m_local_variables_names.size() + m_bytecode_executable->number_of_registers + m_bytecode_executable->constants.size());
 
     auto result_and_frame = vm.bytecode_interpreter().run_executable(*m_bytecode_executable, {});
 
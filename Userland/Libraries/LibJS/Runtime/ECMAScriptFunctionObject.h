@@ -26,6 +26,7 @@ void async_function_start(VM&, PromiseCapability const&, T const& async_function
 class ECMAScriptFunctionObject final : public FunctionObject {
     JS_OBJECT(ECMAScriptFunctionObject, FunctionObject);
     JS_DECLARE_ALLOCATOR(ECMAScriptFunctionObject);
+    JS_WRITE_BARRIERED_CELL(ECMAScriptFunctionObject);
 
 public:
     enum class ConstructorKind : u8 {
@@ -81,7 +82,11 @@ public:
     void add_field(ClassFieldDefinition field) { m_fields.append(move(field)); }
 
     Vector<PrivateElement> const& private_methods() const { return m_private_methods; }
-    void add_private_method(PrivateElement method) { m_private_methods.append(move(method)); }
+    void add_private_method(PrivateElement method)
+    {
+        write_barrier(*this, method.value);
+        m_private_methods.append(move(method));
+    }
 
     // This is for IsSimpleParameterList (static semantics)
     bool has_simple_parameter_list() const { return m_has_simple_parameter_list; }
@@ -93,9 +98,15 @@ public:
 
     FunctionKind kind() const { return m_kind; }
 
+    ScriptOrModule const& script_or_module() const { return m_script_or_module; }
+
     // This is used by LibWeb to disassociate event handler attribute callback functions from the nearest script on the call stack.
     // https://html.spec.whatwg.org/multipage/webappapis.html#getting-the-current-value-of-the-event-handler Step 3.11
-    void set_script_or_module(ScriptOrModule script_or_module) { m_script_or_module = move(script_or_module); }
+    void set_script_or_module(ScriptOrModule script_or_module)
+    {
+        m_script_or_module = move(script_or_module);
+        write_barrier_for_all_edges(*this);
+    }
 
     Variant<PropertyKey, PrivateName, Empty> const& class_field_initializer_name() const { return m_class_field_initializer_name; }
 
@@ -114,6 +125,9 @@ private:
     virtual bool is_ecmascript_function_object() const override { return true; }
     virtual void visit_edges(Visitor&) override;
 
+    void prepare_function_declaration_instantiation(FunctionParsingInsights const&);
+    ThrowCompletionOr<void> parse_lazily_skipped_function();
+
     ThrowCompletionOr<void> prepare_for_ordinary_call(ExecutionContext& callee_context, Object* new_target);
     void ordinary_call_bind_this(ExecutionContext&, Value this_argument);
 
@@ -127,7 +141,7 @@ private:
     // Internal Slots of ECMAScript Function Objects, https://tc39.es/ecma262/#table-internal-slots-of-ecmascript-function-objects
     GCPtr<Environment> m_environment;                                        // [[Environment]]
     GCPtr<PrivateEnvironment> m_private_environment;                         // [[PrivateEnvironment]]
-    Vector<FunctionParameter> const m_formal_parameters;                     // [[FormalParameters]]
+    Vector<FunctionParameter> m_formal_parameters;                           // [[FormalParameters]]
     NonnullRefPtr<Statement const> m_ecmascript_code;                        // [[ECMAScriptCode]]
     GCPtr<Realm> m_realm;                                                    // [[Realm]]
     ScriptOrModule m_script_or_module;                                       // [[ScriptOrModule]]
@@ -145,6 +159,7 @@ private:
     bool m_contains_direct_call_to_eval : 1 { true };
     bool m_is_arrow_function : 1 { false };
     bool m_has_simple_parameter_list : 1 { false };
+    bool m_was_skipped_by_parser : 1 { false };
     FunctionKind m_kind : 3 { FunctionKind::Normal };
 
     struct VariableNameToInitialize {
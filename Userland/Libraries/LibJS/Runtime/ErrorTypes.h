@@ -86,6 +86,7 @@
     M(JsonBigInt, "Cannot serialize BigInt value to JSON")                                                                              \
     M(JsonCircular, "Cannot stringify circular object")                                                                                 \
     M(JsonMalformed, "Malformed JSON string")                                                                                           \
+    M(LazilyParsedFunctionMismatch, "Function '{}' does not end where it did when it was skipped over by the parser")                   \
     M(MissingRequiredProperty, "Required property {} is missing or undefined")                                                          \
     M(ModuleNoEnvironment, "Cannot find module environment for imported binding")                                                       \
     M(ModuleNotFound, "Cannot find/open module: '{}'")                                                                                  \
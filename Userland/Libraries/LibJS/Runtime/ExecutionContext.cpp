@@ -10,6 +10,7 @@
 #include <LibJS/Heap/Heap.h>
 #include <LibJS/Runtime/ExecutionContext.h>
 #include <LibJS/Runtime/FunctionObject.h>
+#include <sys/mman.h>
 
 namespace JS {
 
@@ -33,6 +34,76 @@ private:
 
 static NeverDestroyed<ExecutionContextAllocator> s_execution_context_allocator;
 
+// The arguments and registers of running execution contexts are carved out of one contiguous region of address space
+// that is reserved up front and committed by the kernel as it's touched, so that calling a function doesn't allocate.
+// Execution contexts for calls are created and destroyed in LIFO order, so slices are handed out and given back like
+// frames of a stack.
+class ValueStack {
+public:
+    ValueStack()
+    {
+        auto* base = mmap(nullptr, capacity * sizeof(Value), PROT_READ | PROT_WRITE, MAP_ANONYMOUS | MAP_PRIVATE | MAP_NORESERVE, -1, 0);
+        VERIFY(base != MAP_FAILED);
+        m_base = static_cast<Value*>(base);
+        m_top = m_base;
+    }
+
+    bool contains(Value const* value) const { return value >= m_base && value < m_base + capacity; }
+
+    Optional<Span<Value>> allocate(size_t count)
+    {
+        if (count > static_cast<size_t>(m_base + capacity - m_top))
+            return {};
+        Span<Value> values { m_top, count };
+        m_top += count;
+        values.fill({});
+        return values;
+    }
+
+    void deallocate(Span<Value> values)
+    {
+        if (values.data() + values.size() != m_top) {
+            // NOTE: A context outside of the ongoing calls (e.g. one owned by a script or module) may be destroyed
+            //       while slices above its own are still in use. Its slice is reclaimed once those are gone.
+            m_deferred_deallocations.append(values);
+            return;
+        }
+        m_top = values.data();
+        while (!m_deferred_deallocations.is_empty()) {
+            auto index = m_deferred_deallocations.find_first_index_if([&](auto& deferred) { return deferred.data() + deferred.size() == m_top; });
+            if (!index.has_value())
+                break;
+            m_top = m_deferred_deallocations.take(*index).data();
+        }
+    }
+
+private:
+    // 64 MiB of address space on 64-bit platforms, only the used part of which is ever backed by memory.
+    static constexpr size_t capacity = 8 * MiB;
+
+    Value* m_base { nullptr };
+    Value* m_top { nullptr };
+    Vector<Span<Value>> m_deferred_deallocations;
+};
+
+static NeverDestroyed<ValueStack> s_value_stack;
+
+static Span<Value> allocate_values(Vector<Value>& fallback_storage, size_t count)
+{
+    if (count == 0)
+        return {};
+    if (auto values = s_value_stack->allocate(count); values.has_value())
+        return values.release_value();
+    fallback_storage.resize(count);
+    return fallback_storage.span();
+}
+
+static void deallocate_values(Span<Value> values)
+{
+    if (!values.is_empty() && s_value_stack->contains(values.data()))
+        s_value_stack->deallocate(values);
+}
+
 NonnullOwnPtr<ExecutionContext> ExecutionContext::create()
 {
     return s_execution_context_allocator->allocate();
@@ -49,6 +120,31 @@ ExecutionContext::ExecutionContext()
 
 ExecutionContext::~ExecutionContext()
 {
+    deallocate_values(registers_and_constants_and_locals);
+    deallocate_values(arguments);
+}
+
+void ExecutionContext::set_arguments(ReadonlySpan<Value> passed_arguments, size_t minimum_count)
+{
+    VERIFY(arguments.is_empty());
+    arguments = allocate_values(m_owned_arguments, max(passed_arguments.size(), minimum_count));
+    passed_arguments.copy_to(arguments);
+    arguments.slice(passed_arguments.size()).fill(js_undefined());
+}
+
+void ExecutionContext::ensure_registers_and_constants_and_locals_count(size_t count)
+{
+    if (registers_and_constants_and_locals.size() >= count)
+        return;
+    if (!registers_and_constants_and_locals.is_empty() && !s_value_stack->contains(registers_and_constants_and_locals.data())) {
+        m_owned_registers_and_constants_and_locals.resize(count);
+        registers_and_constants_and_locals = m_owned_registers_and_constants_and_locals.span();
+        return;
+    }
+    auto old_values = registers_and_constants_and_locals;
+    registers_and_constants_and_locals = allocate_values(m_owned_registers_and_constants_and_locals, count);
+    old_values.copy_to(registers_and_constants_and_locals);
+    deallocate_values(old_values);
 }
 
 NonnullOwnPtr<ExecutionContext> ExecutionContext::copy() const
@@ -65,9 +161,11 @@ NonnullOwnPtr<ExecutionContext> ExecutionContext::copy() const
     copy->this_value = this_value;
     copy->is_strict_mode = is_strict_mode;
     copy->executable = executable;
-    copy->arguments = arguments;
+    copy->m_owned_arguments.append(arguments.data(), arguments.size());
+    copy->arguments = copy->m_owned_arguments.span();
     copy->passed_argument_count = passed_argument_count;
-    copy->registers_and_constants_and_locals = registers_and_constants_and_locals;
+    copy->m_owned_registers_and_constants_and_locals.append(registers_and_constants_and_locals.data(), registers_and_constants_and_locals.size());
+    copy->registers_and_constants_and_locals = copy->m_owned_registers_and_constants_and_locals.span();
     copy->unwind_contexts = unwind_contexts;
     copy->saved_lexical_environments = saved_lexical_environments;
     copy->previously_scheduled_jumps = previously_scheduled_jumps;
@@ -9,6 +9,7 @@
 #pragma once
 
 #include <AK/DeprecatedFlyString.h>
+#include <AK/Noncopyable.h>
 #include <AK/WeakPtr.h>
 #include <LibJS/Bytecode/BasicBlock.h>
 #include <LibJS/Forward.h>
@@ -23,6 +24,10 @@ using ScriptOrModule = Variant<Empty, NonnullGCPtr<Script>, NonnullGCPtr<Module>
 
 // 9.4 Execution Contexts, https://tc39.es/ecma262/#sec-execution-contexts
 struct ExecutionContext {
+    AK_MAKE_NONCOPYABLE(ExecutionContext);
+    AK_MAKE_NONMOVABLE(ExecutionContext);
+
+public:
     static NonnullOwnPtr<ExecutionContext> create();
     [[nodiscard]] NonnullOwnPtr<ExecutionContext> copy() const;
 
@@ -70,14 +75,27 @@ public:
         return registers_and_constants_and_locals[index];
     }
 
+    // Copies the passed arguments into this context, padded with undefined up to `minimum_count`.
+    void set_arguments(ReadonlySpan<Value> passed_arguments, size_t minimum_count = 0);
+
+    // Grows registers_and_constants_and_locals to at least `count` values, preserving their contents.
+    void ensure_registers_and_constants_and_locals_count(size_t count);
+
     u32 passed_argument_count { 0 };
     bool is_strict_mode { false };
 
-    Vector<Value> arguments;
-    Vector<Value> registers_and_constants_and_locals;
+    // NOTE: These are slices of the value stack while the context is part of an ongoing call, and only point at
+    //       storage owned by the context itself for copies (i.e. suspended generators and async functions), or when
+    //       the value stack is exhausted.
+    Span<Value> arguments;
+    Span<Value> registers_and_constants_and_locals;
     Vector<Bytecode::UnwindInfo> unwind_contexts;
     Vector<Optional<size_t>> previously_scheduled_jumps;
     Vector<GCPtr<Environment>> saved_lexical_environments;
+
+private:
+    Vector<Value> m_owned_arguments;
+    Vector<Value> m_owned_registers_and_constants_and_locals;
 };
 
 struct StackTraceElement {
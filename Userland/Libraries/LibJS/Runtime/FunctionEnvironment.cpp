@@ -90,6 +90,7 @@ ThrowCompletionOr<Value> FunctionEnvironment::bind_this_value(VM& vm, Value this
 
     // 3. Set envRec.[[ThisValue]] to V.
     m_this_value = this_value;
+    write_barrier(*this, this_value);
 
     // 4. Set envRec.[[ThisBindingStatus]] to initialized.
     m_this_binding_status = ThisBindingStatus::Initialized;
@@ -14,6 +14,7 @@ namespace JS {
 class FunctionEnvironment final : public DeclarativeEnvironment {
     JS_ENVIRONMENT(FunctionEnvironment, DeclarativeEnvironment);
     JS_DECLARE_ALLOCATOR(FunctionEnvironment);
+    JS_WRITE_BARRIERED_CELL(FunctionEnvironment);
 
 public:
     enum class ThisBindingStatus : u8 {
@@ -36,6 +37,7 @@ public:
     {
         VERIFY(!new_target.is_empty());
         m_new_target = new_target;
+        write_barrier(*this, new_target);
     }
 
     // Abstract operations
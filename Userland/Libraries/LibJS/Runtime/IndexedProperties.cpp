@@ -13,11 +13,62 @@ namespace JS {
 constexpr size_t const SPARSE_ARRAY_HOLE_THRESHOLD = 200;
 constexpr size_t const LENGTH_SETTER_GENERIC_STORAGE_THRESHOLD = 4 * MiB;
 
+static constexpr double double_hole = bit_cast<double>(SimpleIndexedPropertyStorage::double_hole_bits);
+
+static double to_double_element(Value value)
+{
+    if (value.is_empty())
+        return double_hole;
+    return value.as_double();
+}
+
+static Value from_double_element(double element)
+{
+    if (SimpleIndexedPropertyStorage::is_hole(element))
+        return {};
+    return Value(element);
+}
+
+static void resize_with_holes(Vector<double>& elements, size_t new_size)
+{
+    if (new_size <= elements.size()) {
+        elements.shrink(new_size, true);
+        return;
+    }
+    elements.ensure_capacity(new_size);
+    while (elements.size() < new_size)
+        elements.unchecked_append(double_hole);
+}
+
 SimpleIndexedPropertyStorage::SimpleIndexedPropertyStorage(Vector<Value>&& initial_values)
     : IndexedPropertyStorage(IsSimpleStorage::Yes)
     , m_array_size(initial_values.size())
-    , m_packed_elements(move(initial_values))
 {
+    bool all_int32 = true;
+    bool all_numbers_or_holes = true;
+    for (auto value : initial_values) {
+        if (!value.is_int32())
+            all_int32 = false;
+        if (!value.is_number() && !value.is_empty()) {
+            all_numbers_or_holes = false;
+            break;
+        }
+    }
+
+    if (all_int32) {
+        m_element_kind = ElementKind::PackedInt32;
+        m_int32_elements.ensure_capacity(initial_values.size());
+        for (auto value : initial_values)
+            m_int32_elements.unchecked_append(value.as_i32());
+    } else if (all_numbers_or_holes) {
+        m_element_kind = ElementKind::Double;
+        m_double_elements.ensure_capacity(initial_values.size());
+        for (auto value : initial_values)
+            m_double_elements.unchecked_append(to_double_element(value));
+    } else {
+        m_element_kind = ElementKind::Generic;
+        m_packed_elements = move(initial_values);
+    }
 }
 
 bool SimpleIndexedPropertyStorage::has_index(u32 index) const
@@ -30,65 +81,225 @@ Optional<ValueAndAttributes> SimpleIndexedPropertyStorage::get(u32 index) const
     return inline_get(index);
 }
 
+void SimpleIndexedPropertyStorage::transition_to(ElementKind new_kind)
+{
+    VERIFY(to_underlying(new_kind) > to_underlying(m_element_kind));
+
+    if (m_element_kind == ElementKind::PackedInt32 && new_kind == ElementKind::Double) {
+        m_double_elements.ensure_capacity(m_int32_elements.size());
+        for (auto element : m_int32_elements)
+            m_double_elements.unchecked_append(element);
+        m_int32_elements.clear();
+    } else if (m_element_kind == ElementKind::PackedInt32) {
+        m_packed_elements.ensure_capacity(m_int32_elements.size());
+        for (auto element : m_int32_elements)
+            m_packed_elements.unchecked_append(Value(element));
+        m_int32_elements.clear();
+    } else {
+        m_packed_elements.ensure_capacity(m_double_elements.size());
+        for (auto element : m_double_elements)
+            m_packed_elements.unchecked_append(from_double_element(element));
+        m_double_elements.clear();
+    }
+
+    m_element_kind = new_kind;
+}
+
+void SimpleIndexedPropertyStorage::ensure_element_kind_can_hold(Value value)
+{
+    switch (m_element_kind) {
+    case ElementKind::PackedInt32:
+        if (value.is_int32())
+            return;
+        transition_to(value.is_number() || value.is_empty() ? ElementKind::Double : ElementKind::Generic);
+        return;
+    case ElementKind::Double:
+        if (!value.is_number() && !value.is_empty())
+            transition_to(ElementKind::Generic);
+        return;
+    case ElementKind::Generic:
+        return;
+    }
+    VERIFY_NOT_REACHED();
+}
+
 void SimpleIndexedPropertyStorage::grow_storage_if_needed()
 {
-    if (m_array_size <= m_packed_elements.size())
+    // Packed Int32 storage never has holes, so it only ever grows by appending.
+    VERIFY(m_element_kind != ElementKind::PackedInt32);
+
+    auto current_size = m_element_kind == ElementKind::Double ? m_double_elements.size() : m_packed_elements.size();
+    auto current_capacity = m_element_kind == ElementKind::Double ? m_double_elements.capacity() : m_packed_elements.capacity();
+    if (m_array_size <= current_size)
         return;
 
-    if (m_array_size <= m_packed_elements.capacity()) {
-        m_packed_elements.resize_and_keep_capacity(m_array_size);
-    } else {
-        // When the array is actually full grow storage by 25% at a time.
-        m_packed_elements.resize_and_keep_capacity(m_array_size + (m_array_size / 4));
-    }
+    // When the array is actually full grow storage by 25% at a time.
+    auto new_size = m_array_size <= current_capacity ? m_array_size : m_array_size + (m_array_size / 4);
+    if (m_element_kind == ElementKind::Double)
+        resize_with_holes(m_double_elements, new_size);
+    else
+        m_packed_elements.resize_and_keep_capacity(new_size);
 }
 
 void SimpleIndexedPropertyStorage::put(u32 index, Value value, PropertyAttributes attributes)
 {
     VERIFY(attributes == default_attributes);
 
+    ensure_element_kind_can_hold(value);
+
+    if (m_element_kind == ElementKind::PackedInt32) {
+        if (index < m_array_size) {
+            m_int32_elements[index] = value.as_i32();
+            return;
+        }
+        if (index == m_array_size) {
+            m_int32_elements.append(value.as_i32());
+            ++m_array_size;
+            return;
+        }
+        // Writing past the end leaves holes behind.
+        transition_to(ElementKind::Double);
+    }
+
     if (index >= m_array_size) {
         m_array_size = index + 1;
         grow_storage_if_needed();
     }
-    m_packed_elements[index] = value;
+
+    if (m_element_kind == ElementKind::Double)
+        m_double_elements[index] = to_double_element(value);
+    else
+        m_packed_elements[index] = value;
 }
 
 void SimpleIndexedPropertyStorage::remove(u32 index)
 {
     VERIFY(index < m_array_size);
-    m_packed_elements[index] = {};
+    if (m_element_kind == ElementKind::PackedInt32)
+        transition_to(ElementKind::Double);
+
+    if (m_element_kind == ElementKind::Double)
+        m_double_elements[index] = double_hole;
+    else
+        m_packed_elements[index] = {};
 }
 
 ValueAndAttributes SimpleIndexedPropertyStorage::take_first()
 {
     m_array_size--;
-    return { m_packed_elements.take_first(), default_attributes };
+    switch (m_element_kind) {
+    case ElementKind::PackedInt32:
+        return { Value(m_int32_elements.take_first()), default_attributes };
+    case ElementKind::Double:
+        return { from_double_element(m_double_elements.take_first()), default_attributes };
+    case ElementKind::Generic:
+        return { m_packed_elements.take_first(), default_attributes };
+    }
+    VERIFY_NOT_REACHED();
 }
 
 ValueAndAttributes SimpleIndexedPropertyStorage::take_last()
 {
     m_array_size--;
-    auto last_element = m_packed_elements[m_array_size];
-    m_packed_elements[m_array_size] = {};
-    return { last_element, default_attributes };
+    switch (m_element_kind) {
+    case ElementKind::PackedInt32:
+        return { Value(m_int32_elements.take_last()), default_attributes };
+    case ElementKind::Double: {
+        auto last_element = m_double_elements[m_array_size];
+        m_double_elements[m_array_size] = double_hole;
+        return { from_double_element(last_element), default_attributes };
+    }
+    case ElementKind::Generic: {
+        auto last_element = m_packed_elements[m_array_size];
+        m_packed_elements[m_array_size] = {};
+        return { last_element, default_attributes };
+    }
+    }
+    VERIFY_NOT_REACHED();
+}
+
+size_t SimpleIndexedPropertyStorage::size() const
+{
+    switch (m_element_kind) {
+    case ElementKind::PackedInt32:
+        return m_int32_elements.size();
+    case ElementKind::Double:
+        return m_double_elements.size();
+    case ElementKind::Generic:
+        return m_packed_elements.size();
+    }
+    VERIFY_NOT_REACHED();
 }
 
 bool SimpleIndexedPropertyStorage::set_array_like_size(size_t new_size)
 {
+    // Growing the array makes holes, which packed Int32 storage can't represent.
+    if (m_element_kind == ElementKind::PackedInt32 && new_size > m_array_size)
+        transition_to(ElementKind::Double);
+
     m_array_size = new_size;
-    m_packed_elements.resize_and_keep_capacity(new_size);
+    switch (m_element_kind) {
+    case ElementKind::PackedInt32:
+        m_int32_elements.shrink(new_size, true);
+        break;
+    case ElementKind::Double:
+        resize_with_holes(m_double_elements, new_size);
+        break;
+    case ElementKind::Generic:
+        m_packed_elements.resize_and_keep_capacity(new_size);
+        break;
+    }
     return true;
 }
 
+bool SimpleIndexedPropertyStorage::is_packed_in_range(size_t from, size_t to) const
+{
+    VERIFY(from <= to && to <= m_array_size);
+    switch (m_element_kind) {
+    case ElementKind::PackedInt32:
+        return true;
+    case ElementKind::Double:
+        for (size_t i = from; i < to; ++i) {
+            if (is_hole(m_double_elements.data()[i]))
+                return false;
+        }
+        return true;
+    case ElementKind::Generic:
+        for (size_t i = from; i < to; ++i) {
+            if (m_packed_elements.data()[i].is_empty())
+                return false;
+        }
+        return true;
+    }
+    VERIFY_NOT_REACHED();
+}
+
+void SimpleIndexedPropertyStorage::fill(size_t from, size_t to, Value value)
+{
+    VERIFY(from <= to && to <= m_array_size);
+    VERIFY(!value.is_empty());
+    ensure_element_kind_can_hold(value);
+    switch (m_element_kind) {
+    case ElementKind::PackedInt32:
+        m_int32_elements.span().slice(from, to - from).fill(value.as_i32());
+        return;
+    case ElementKind::Double:
+        m_double_elements.span().slice(from, to - from).fill(value.as_double());
+        return;
+    case ElementKind::Generic:
+        m_packed_elements.span().slice(from, to - from).fill(value);
+        return;
+    }
+    VERIFY_NOT_REACHED();
+}
+
 GenericIndexedPropertyStorage::GenericIndexedPropertyStorage(SimpleIndexedPropertyStorage&& storage)
     : IndexedPropertyStorage(IsSimpleStorage::No)
 {
     m_array_size = storage.array_like_size();
-    for (size_t i = 0; i < storage.m_packed_elements.size(); ++i) {
-        auto value = storage.m_packed_elements[i];
-        if (!value.is_empty())
-            m_sparse_elements.set(i, { value, default_attributes });
+    for (size_t i = 0; i < m_array_size; ++i) {
+        if (auto element = storage.inline_get(i); element.has_value())
+            m_sparse_elements.set(i, element.release_value());
     }
 }
 
@@ -265,10 +476,12 @@ size_t IndexedProperties::real_size() const
     if (!m_storage)
         return 0;
     if (m_storage->is_simple_storage()) {
-        auto& packed_elements = static_cast<SimpleIndexedPropertyStorage const&>(*m_storage).elements();
+        auto const& storage = static_cast<SimpleIndexedPropertyStorage const&>(*m_storage);
+        if (storage.element_kind() == SimpleIndexedPropertyStorage::ElementKind::PackedInt32)
+            return storage.array_like_size();
         size_t size = 0;
-        for (auto& element : packed_elements) {
-            if (!element.is_empty())
+        for (size_t i = 0; i < storage.array_like_size(); ++i) {
+            if (storage.inline_has_index(i))
                 ++size;
         }
         return size;
@@ -282,11 +495,10 @@ Vector<u32> IndexedProperties::indices() const
         return {};
     if (m_storage->is_simple_storage()) {
         auto const& storage = static_cast<SimpleIndexedPropertyStorage const&>(*m_storage);
-        auto const& elements = storage.elements();
         Vector<u32> indices;
         indices.ensure_capacity(storage.array_like_size());
-        for (size_t i = 0; i < elements.size(); ++i) {
-            if (!elements.at(i).is_empty())
+        for (size_t i = 0; i < storage.array_like_size(); ++i) {
+            if (storage.inline_has_index(i))
                 indices.unchecked_append(i);
         }
         return indices;
@@ -297,6 +509,23 @@ Vector<u32> IndexedProperties::indices() const
     return indices;
 }
 
+void IndexedProperties::visit_edges(Cell::Visitor& visitor)
+{
+    if (!m_storage)
+        return;
+    if (m_storage->is_simple_storage()) {
+        auto const& storage = static_cast<SimpleIndexedPropertyStorage const&>(*m_storage);
+        // Numeric element kinds never hold cells.
+        if (storage.element_kind() == SimpleIndexedPropertyStorage::ElementKind::Generic) {
+            for (auto value : storage.elements())
+                visitor.visit(value);
+        }
+        return;
+    }
+    for (auto& element : static_cast<GenericIndexedPropertyStorage const&>(*m_storage).sparse_elements())
+        visitor.visit(element.value.value);
+}
+
 void IndexedProperties::switch_to_generic_storage()
 {
     if (!m_storage) {
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <AK/BitCast.h>
 #include <AK/NonnullOwnPtr.h>
 #include <LibJS/Runtime/Shape.h>
 #include <LibJS/Runtime/Value.h>
@@ -56,6 +57,17 @@ private:
 
 class SimpleIndexedPropertyStorage final : public IndexedPropertyStorage {
 public:
+    // Elements start out as packed Int32s, and move to more general representations (never back) as other kinds of
+    // values are stored or holes are made.
+    enum class ElementKind : u8 {
+        // Every element is an Int32, and there are no holes.
+        PackedInt32,
+        // Every element is a number or a hole, stored as an unboxed double.
+        Double,
+        // Anything goes, stored as Values.
+        Generic,
+    };
+
     SimpleIndexedPropertyStorage()
         : IndexedPropertyStorage(IsSimpleStorage::Yes) {};
     explicit SimpleIndexedPropertyStorage(Vector<Value>&& initial_values);
@@ -68,30 +80,91 @@ public:
     virtual ValueAndAttributes take_first() override;
     virtual ValueAndAttributes take_last() override;
 
-    virtual size_t size() const override { return m_packed_elements.size(); }
+    virtual size_t size() const override;
     virtual size_t array_like_size() const override { return m_array_size; }
     virtual bool set_array_like_size(size_t new_size) override;
 
-    Vector<Value> const& elements() const { return m_packed_elements; }
+    ElementKind element_kind() const { return m_element_kind; }
+
+    // Each of these is only valid for the corresponding element kind. They may be longer than the array, in which case
+    // the extra elements are holes.
+    ReadonlySpan<i32> int32_elements() const
+    {
+        VERIFY(m_element_kind == ElementKind::PackedInt32);
+        return m_int32_elements;
+    }
+    ReadonlySpan<double> double_elements() const
+    {
+        VERIFY(m_element_kind == ElementKind::Double);
+        return m_double_elements;
+    }
+    Vector<Value> const& elements() const
+    {
+        VERIFY(m_element_kind == ElementKind::Generic);
+        return m_packed_elements;
+    }
+
+    // Holes in double storage are a NaN that no Value ever holds, as Value canonicalizes all NaNs.
+    static constexpr u64 double_hole_bits = 0x7ff4'0000'0000'0000;
+    static bool is_hole(double value) { return bit_cast<u64>(value) == double_hole_bits; }
 
     [[nodiscard]] bool inline_has_index(u32 index) const
     {
-        return index < m_array_size && !m_packed_elements.data()[index].is_empty();
+        if (index >= m_array_size)
+            return false;
+        switch (m_element_kind) {
+        case ElementKind::PackedInt32:
+            return true;
+        case ElementKind::Double:
+            return !is_hole(m_double_elements.data()[index]);
+        case ElementKind::Generic:
+            return !m_packed_elements.data()[index].is_empty();
+        }
+        VERIFY_NOT_REACHED();
     }
 
     [[nodiscard]] Optional<ValueAndAttributes> inline_get(u32 index) const
     {
-        if (!inline_has_index(index))
+        if (index >= m_array_size)
             return {};
-        return ValueAndAttributes { m_packed_elements.data()[index], default_attributes };
+        switch (m_element_kind) {
+        case ElementKind::PackedInt32:
+            return ValueAndAttributes { Value(m_int32_elements.data()[index]), default_attributes };
+        case ElementKind::Double: {
+            auto value = m_double_elements.data()[index];
+            if (is_hole(value))
+                return {};
+            return ValueAndAttributes { Value(value), default_attributes };
+        }
+        case ElementKind::Generic: {
+            auto value = m_packed_elements.data()[index];
+            if (value.is_empty())
+                return {};
+            return ValueAndAttributes { value, default_attributes };
+        }
+        }
+        VERIFY_NOT_REACHED();
     }
 
+    // Returns true if there are no holes in [from, to), which must be within the array.
+    [[nodiscard]] bool is_packed_in_range(size_t from, size_t to) const;
+
+    // Overwrites every element in [from, to), which must be within the array.
+    void fill(size_t from, size_t to, Value);
+
 private:
     friend GenericIndexedPropertyStorage;
 
+    void ensure_element_kind_can_hold(Value);
+    void transition_to(ElementKind);
     void grow_storage_if_needed();
 
     size_t m_array_size { 0 };
+    ElementKind m_element_kind { ElementKind::PackedInt32 };
+
+    // Only the vector for the current element kind is in use, the others are empty.
+    Vector<i32> m_int32_elements;
+    Vector<double> m_double_elements;
     Vector<Value> m_packed_elements;
 };
 
@@ -170,19 +243,7 @@ public:
 
     Vector<u32> indices() const;
 
-    template<typename Callback>
-    void for_each_value(Callback callback)
-    {
-        if (!m_storage)
-            return;
-        if (m_storage->is_simple_storage()) {
-            for (auto& value : static_cast<SimpleIndexedPropertyStorage&>(*m_storage).elements())
-                callback(value);
-        } else {
-            for (auto& element : static_cast<GenericIndexedPropertyStorage const&>(*m_storage).sparse_elements())
-                callback(element.value.value);
-        }
-    }
+    void visit_edges(Cell::Visitor&);
 
 private:
     void switch_to_generic_storage();
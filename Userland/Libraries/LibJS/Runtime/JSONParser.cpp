@@ -0,0 +1,399 @@
+/*
+ * Copyright (c) 2026, agent <agent@local>
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/CharacterTypes.h>
+#include <AK/FloatingPointStringConversions.h>
+#include <AK/SIMD.h>
+#include <AK/SIMDExtras.h>
+#include <AK/Utf16View.h>
+#include <LibJS/Heap/MarkedVector.h>
+#include <LibJS/Runtime/Array.h>
+#include <LibJS/Runtime/Error.h>
+#include <LibJS/Runtime/GlobalObject.h>
+#include <LibJS/Runtime/JSONParser.h>
+#include <LibJS/Runtime/Object.h>
+#include <LibJS/Runtime/PrimitiveString.h>
+#include <LibJS/Runtime/Shape.h>
+#include <LibJS/Runtime/VM.h>
+
+namespace JS {
+
+static constexpr bool is_json_whitespace(char ch)
+{
+    return ch == '\t' || ch == '\n' || ch == '\r' || ch == ' ';
+}
+
+// Quotation marks, reverse solidi and control characters are the only things that can't appear in a string as they are.
+static constexpr bool is_special_string_character(u8 ch)
+{
+    return ch == '"' || ch == '\\' || ch < 0x20;
+}
+
+// Returns the number of bytes at the start of `input` that can be copied into a string as they are.
+static size_t count_literal_string_characters(StringView input)
+{
+    auto const* characters = reinterpret_cast<u8 const*>(input.characters_without_null_termination());
+    auto length = input.length();
+    size_t count = 0;
+
+    // OPTIMIZATION: Most strings have long runs without anything that needs escaping, so we look for the end of them 16
+    //               bytes at a time.
+    using AK::SIMD::u8x16;
+    for (; count + sizeof(u8x16) <= length; count += sizeof(u8x16)) {
+        auto chunk = AK::SIMD::load_unaligned<u8x16>(characters + count);
+        auto special = (chunk == '"') | (chunk == '\\') | (chunk < 0x20);
+        auto mask = bit_cast<AK::SIMD::u64x2>(special);
+        if (mask[0] | mask[1])
+            break;
+    }
+
+    while (count < length && !is_special_string_character(characters[count]))
+        ++count;
+    return count;
+}
+
+ThrowCompletionOr<Value> JSONParser::parse(VM& vm, StringView input)
+{
+    JSONParser parser(vm, input);
+    auto value = TRY(parser.parse_value());
+    parser.skip_whitespace();
+    if (!parser.is_eof())
+        return parser.syntax_error();
+    return value;
+}
+
+JSONParser::JSONParser(VM& vm, StringView input)
+    : m_vm(vm)
+    , m_realm(*vm.current_realm())
+    , m_input(input)
+{
+}
+
+Completion JSONParser::syntax_error() const
+{
+    return m_vm.throw_completion<SyntaxError>(ErrorType::JsonMalformed);
+}
+
+void JSONParser::skip_whitespace()
+{
+    while (m_position < m_input.length() && is_json_whitespace(m_input[m_position]))
+        ++m_position;
+}
+
+bool JSONParser::consume_specific(char expected)
+{
+    if (is_eof() || peek() != expected)
+        return false;
+    ++m_position;
+    return true;
+}
+
+ThrowCompletionOr<Value> JSONParser::parse_value()
+{
+    skip_whitespace();
+    switch (peek()) {
+    case '{':
+        return parse_object();
+    case '[':
+        return parse_array();
+    case '"':
+        return parse_string();
+    case '-':
+    case '0':
+    case '1':
+    case '2':
+    case '3':
+    case '4':
+    case '5':
+    case '6':
+    case '7':
+    case '8':
+    case '9':
+        return parse_number();
+    case 't':
+        return parse_literal("true"sv, Value(true));
+    case 'f':
+        return parse_literal("false"sv, Value(false));
+    case 'n':
+        return parse_literal("null"sv, js_null());
+    default:
+        return syntax_error();
+    }
+}
+
+ThrowCompletionOr<Value> JSONParser::parse_object()
+{
+    if (m_vm.did_reach_stack_space_limit())
+        return m_vm.throw_completion<InternalError>(ErrorType::CallStackSizeExceeded);
+
+    VERIFY(peek() == '{');
+    ++m_position;
+
+    Vector<DeprecatedFlyString, 16> keys;
+    MarkedVector<Value, 16> values(m_vm.heap());
+
+    skip_whitespace();
+    if (!consume_specific('}')) {
+        for (;;) {
+            skip_whitespace();
+            if (peek() != '"')
+                return syntax_error();
+            keys.append(DeprecatedFlyString(TRY(consume_string())));
+
+            skip_whitespace();
+            if (!consume_specific(':'))
+                return syntax_error();
+            values.append(TRY(parse_value()));
+
+            skip_whitespace();
+            if (consume_specific('}'))
+                break;
+            if (!consume_specific(','))
+                return syntax_error();
+        }
+    }
+
+    return create_object(keys, values);
+}
+
+NonnullGCPtr<Object> JSONParser::create_object(ReadonlySpan<DeprecatedFlyString> keys, ReadonlySpan<Value> values)
+{
+    VERIFY(keys.size() == values.size());
+
+    for (auto const& cached_shape : m_cached_shapes) {
+        if (cached_shape.keys.span() != keys)
+            continue;
+        auto object = Object::create_with_premade_shape(*cached_shape.shape);
+        for (size_t i = 0; i < values.size(); ++i)
+            object->put_direct(i, values[i]);
+        return object;
+    }
+
+    auto object = Object::create(m_realm, m_realm.intrinsics().object_prototype());
+    for (size_t i = 0; i < keys.size(); ++i)
+        object->define_direct_property(keys[i], values[i], default_attributes);
+
+    // Only shapes that have every key as a named property, in order, can be reused. This rules out objects with
+    // duplicate or numeric keys, as well as objects that were turned into dictionaries.
+    auto& shape = object->shape();
+    if (!keys.is_empty() && !shape.is_dictionary() && shape.property_count() == keys.size() && object->indexed_properties().is_empty()) {
+        if (m_cached_shapes.size() == max_cached_shapes)
+            m_cached_shapes.take_last();
+        Vector<DeprecatedFlyString> cached_keys;
+        cached_keys.append(keys.data(), keys.size());
+        m_cached_shapes.prepend({ move(cached_keys), &shape });
+    }
+
+    return object;
+}
+
+ThrowCompletionOr<Value> JSONParser::parse_array()
+{
+    if (m_vm.did_reach_stack_space_limit())
+        return m_vm.throw_completion<InternalError>(ErrorType::CallStackSizeExceeded);
+
+    VERIFY(peek() == '[');
+    ++m_position;
+
+    MarkedVector<Value> elements(m_vm.heap());
+
+    skip_whitespace();
+    if (!consume_specific(']')) {
+        for (;;) {
+            elements.append(TRY(parse_value()));
+
+            skip_whitespace();
+            if (consume_specific(']'))
+                break;
+            if (!consume_specific(','))
+                return syntax_error();
+        }
+    }
+
+    auto array = MUST(Array::create(m_realm, 0));
+    // NOTE: Nothing can allocate between moving the elements out of the marked vector and handing them to the array.
+    array->set_indexed_property_elements(move(static_cast<Vector<Value>&>(elements)));
+    return array;
+}
+
+ThrowCompletionOr<Value> JSONParser::parse_string()
+{
+    auto string = TRY(consume_string());
+    return PrimitiveString::create(m_vm, ByteString(string));
+}
+
+ThrowCompletionOr<StringView> JSONParser::consume_string()
+{
+    VERIFY(peek() == '"');
+    ++m_position;
+
+    auto start = m_position;
+    bool has_escapes = false;
+
+    for (;;) {
+        auto literal_characters = count_literal_string_characters(m_input.substring_view(m_position));
+        if (has_escapes)
+            m_string_builder.append(m_input.substring_view(m_position, literal_characters));
+        m_position += literal_characters;
+
+        if (is_eof())
+            return syntax_error();
+
+        auto ch = m_input[m_position++];
+        if (ch == '"') {
+            // OPTIMIZATION: Strings without escapes don't need to be copied before we know what to do with them.
+            if (!has_escapes)
+                return m_input.substring_view(start, m_position - start - 1);
+            return m_string_builder.string_view();
+        }
+
+        // All code points may appear literally except for the quotation mark, the reverse solidus, and the control
+        // characters U+0000 to U+001F.
+        if (ch != '\\')
+            return syntax_error();
+
+        if (!has_escapes) {
+            has_escapes = true;
+            m_string_builder.clear();
+            m_string_builder.append(m_input.substring_view(start, m_position - start - 1));
+        }
+
+        if (is_eof())
+            return syntax_error();
+
+        switch (m_input[m_position++]) {
+        case '"':
+            m_string_builder.append('"');
+            break;
+        case '\\':
+            m_string_builder.append('\\');
+            break;
+        case '/':
+            m_string_builder.append('/');
+            break;
+        case 'b':
+            m_string_builder.append('\b');
+            break;
+        case 'f':
+            m_string_builder.append('\f');
+            break;
+        case 'n':
+            m_string_builder.append('\n');
+            break;
+        case 'r':
+            m_string_builder.append('\r');
+            break;
+        case 't':
+            m_string_builder.append('\t');
+            break;
+        case 'u':
+            m_string_builder.append_code_point(TRY(consume_unicode_escape()));
+            break;
+        default:
+            return syntax_error();
+        }
+    }
+}
+
+// NOTE: Like AK::JsonParser, we combine escaped surrogate pairs and pass lone surrogates through as they are.
+ThrowCompletionOr<u32> JSONParser::consume_unicode_escape()
+{
+    auto consume_code_unit = [&]() -> Optional<u16> {
+        if (m_position + 4 > m_input.length())
+            return {};
+        u16 code_unit = 0;
+        for (size_t i = 0; i < 4; ++i) {
+            auto ch = m_input[m_position + i];
+            if (!is_ascii_hex_digit(ch))
+                return {};
+            code_unit = (code_unit << 4) | parse_ascii_hex_digit(ch);
+        }
+        m_position += 4;
+        return code_unit;
+    };
+
+    auto high_surrogate = consume_code_unit();
+    if (!high_surrogate.has_value())
+        return syntax_error();
+    if (!Utf16View::is_high_surrogate(*high_surrogate) || peek() != '\\' || peek(1) != 'u')
+        return *high_surrogate;
+
+    auto position_before_low_surrogate = m_position;
+    m_position += 2;
+    if (auto low_surrogate = consume_code_unit(); low_surrogate.has_value() && Utf16View::is_low_surrogate(*low_surrogate))
+        return Utf16View::decode_surrogate_pair(*high_surrogate, *low_surrogate);
+
+    m_position = position_before_low_surrogate;
+    return *high_surrogate;
+}
+
+ThrowCompletionOr<Value> JSONParser::parse_number()
+{
+    auto start = m_position;
+    bool negative = consume_specific('-');
+
+    auto consume_digits = [&] {
+        size_t count = 0;
+        while (is_ascii_digit(peek())) {
+            ++m_position;
+            ++count;
+        }
+        return count;
+    };
+
+    // Leading zeros are not allowed.
+    size_t integer_digits = 0;
+    if (consume_specific('0'))
+        integer_digits = 1;
+    else
+        integer_digits = consume_digits();
+    if (integer_digits == 0)
+        return syntax_error();
+
+    bool is_integer = true;
+    if (consume_specific('.')) {
+        is_integer = false;
+        if (consume_digits() == 0)
+            return syntax_error();
+    }
+    if (peek() == 'e' || peek() == 'E') {
+        is_integer = false;
+        ++m_position;
+        if (!consume_specific('+'))
+            consume_specific('-');
+        if (consume_digits() == 0)
+            return syntax_error();
+    }
+
+    auto number_text = m_input.substring_view(start, m_position - start);
+
+    // OPTIMIZATION: Integers that fit in an i32 are by far the most common kind of number, and don't need the full
+    //               floating point parser.
+    if (is_integer && integer_digits <= 9) {
+        i32 value = 0;
+        for (auto ch : number_text.substring_view(negative ? 1 : 0))
+            value = value * 10 + parse_ascii_digit(ch);
+        if (negative)
+            return value == 0 ? Value(-0.0) : Value(-value);
+        return Value(value);
+    }
+
+    auto const* begin = number_text.characters_without_null_termination();
+    auto result = parse_first_floating_point<double>(begin, begin + number_text.length());
+    if (!result.parsed_value() || result.end_ptr != begin + number_text.length())
+        return syntax_error();
+    return Value(result.value);
+}
+
+ThrowCompletionOr<Value> JSONParser::parse_literal(StringView literal, Value value)
+{
+    if (!m_input.substring_view(m_position).starts_with(literal))
+        return syntax_error();
+    m_position += literal.length();
+    return value;
+}
+
+}
@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2026, agent <agent@local>
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/DeprecatedFlyString.h>
+#include <AK/StringBuilder.h>
+#include <AK/StringView.h>
+#include <AK/Vector.h>
+#include <LibJS/Forward.h>
+#include <LibJS/Runtime/Completion.h>
+
+namespace JS {
+
+// Parses JSON text straight into JS values, without building an intermediate AK::JsonValue tree first.
+class JSONParser {
+public:
+    static ThrowCompletionOr<Value> parse(VM&, StringView);
+
+private:
+    JSONParser(VM&, StringView);
+
+    ThrowCompletionOr<Value> parse_value();
+    ThrowCompletionOr<Value> parse_object();
+    ThrowCompletionOr<Value> parse_array();
+    ThrowCompletionOr<Value> parse_string();
+    ThrowCompletionOr<Value> parse_number();
+    ThrowCompletionOr<Value> parse_literal(StringView, Value);
+
+    // The returned view points either into the input or into m_string_builder, and is only valid until the next string
+    // is consumed.
+    ThrowCompletionOr<StringView> consume_string();
+    ThrowCompletionOr<u32> consume_unicode_escape();
+
+    NonnullGCPtr<Object> create_object(ReadonlySpan<DeprecatedFlyString> keys, ReadonlySpan<Value> values);
+
+    void skip_whitespace();
+    bool is_eof() const { return m_position >= m_input.length(); }
+    char peek(size_t offset = 0) const { return m_position + offset < m_input.length() ? m_input[m_position + offset] : '\0'; }
+    bool consume_specific(char);
+
+    Completion syntax_error() const;
+
+    VM& m_vm;
+    Realm& m_realm;
+    StringView m_input;
+    size_t m_position { 0 };
+    StringBuilder m_string_builder;
+
+    // JSON documents tend to contain many objects with the same set of keys. We remember the shapes of the most recently
+    // created objects, so that objects with a key set we've seen before can be created with the final shape up front,
+    // instead of going through one transition per key.
+    // NOTE: Each shape is kept alive by the object it was taken from, which is reachable until parsing is done.
+    struct CachedShape {
+        Vector<DeprecatedFlyString> keys;
+        Shape* shape { nullptr };
+    };
+    static constexpr size_t max_cached_shapes = 8;
+    Vector<CachedShape, max_cached_shapes> m_cached_shapes;
+};
+
+}
@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/IntegralMath.h>
 #include <LibJS/Runtime/Map.h>
 
 namespace JS {
@@ -20,74 +21,132 @@ Map::Map(Object& prototype)
 {
 }
 
+static constexpr size_t minimum_slot_count = 8;
+
+// Keeping the hash table at most half full keeps probe sequences short, and guarantees there's always an empty slot.
+static size_t slot_count_for(size_t entry_count)
+{
+    return max(minimum_slot_count, static_cast<size_t>(1) << AK::ceil_log2(entry_count * 2 + 1));
+}
+
+Optional<size_t> Map::find_entry_index(Value const& key, u32 hash) const
+{
+    if (m_slots.is_empty())
+        return {};
+
+    auto mask = m_slots.size() - 1;
+    for (auto slot_index = hash & mask;; slot_index = (slot_index + 1) & mask) {
+        auto const& slot = m_slots[slot_index];
+        if (slot.entry_index == Slot::empty_index)
+            return {};
+        if (slot.hash != hash)
+            continue;
+        // NOTE: Slots of removed entries stay in place, so that the probe sequences running through them stay intact.
+        auto const& entry = m_entries[slot.entry_index];
+        if (!entry.is_removed() && ValueTraits::equals(entry.key, key))
+            return slot.entry_index;
+    }
+}
+
+void Map::rebuild(size_t slot_count)
+{
+    if (m_removed_entry_count > 0) {
+        m_entries.remove_all_matching([](auto const& entry) { return entry.is_removed(); });
+        m_removed_entry_count = 0;
+        ++m_layout_version;
+    }
+
+    m_slots.clear_with_capacity();
+    m_slots.resize(slot_count);
+
+    auto mask = slot_count - 1;
+    for (size_t entry_index = 0; entry_index < m_entries.size(); ++entry_index) {
+        auto hash = ValueTraits::hash(m_entries[entry_index].key);
+        auto slot_index = hash & mask;
+        while (m_slots[slot_index].entry_index != Slot::empty_index)
+            slot_index = (slot_index + 1) & mask;
+        m_slots[slot_index] = { static_cast<u32>(entry_index), hash };
+    }
+}
+
 // 24.1.3.1 Map.prototype.clear ( ), https://tc39.es/ecma262/#sec-map.prototype.clear
 void Map::map_clear()
 {
-    m_keys.clear();
     m_entries.clear();
+    m_slots.clear();
+    m_removed_entry_count = 0;
+    ++m_layout_version;
 }
 
 // 24.1.3.3 Map.prototype.delete ( key ), https://tc39.es/ecma262/#sec-map.prototype.delete
 bool Map::map_remove(Value const& key)
 {
-    Optional<size_t> index;
-
-    for (auto it = m_keys.begin(); !it.is_end(); ++it) {
-        if (ValueTraits::equals(*it, key)) {
-            index = it.key();
-            break;
-        }
-    }
-
+    auto index = find_entry_index(key, ValueTraits::hash(key));
     if (!index.has_value())
         return false;
 
-    m_keys.remove(*index);
-    m_entries.remove(key);
+    // NOTE: The insertion id stays, as iterators rely on the ids being in order.
+    auto& entry = m_entries[*index];
+    entry.key = {};
+    entry.value = {};
+    ++m_removed_entry_count;
+
+    // Once most entries are removed ones, we compact the array and shrink the hash table to match.
+    if (m_removed_entry_count > minimum_slot_count && m_removed_entry_count * 2 > m_entries.size())
+        rebuild(slot_count_for(m_entries.size() - m_removed_entry_count));
     return true;
 }
 
 // 24.1.3.6 Map.prototype.get ( key ), https://tc39.es/ecma262/#sec-map.prototype.get
 Optional<Value> Map::map_get(Value const& key) const
 {
-    if (auto it = m_entries.find(key); it != m_entries.end())
-        return it->value;
+    if (auto index = find_entry_index(key, ValueTraits::hash(key)); index.has_value())
+        return m_entries[*index].value;
     return {};
 }
 
 // 24.1.3.7 Map.prototype.has ( key ), https://tc39.es/ecma262/#sec-map.prototype.has
 bool Map::map_has(Value const& key) const
 {
-    return m_entries.contains(key);
+    return find_entry_index(key, ValueTraits::hash(key)).has_value();
 }
 
 // 24.1.3.9 Map.prototype.set ( key, value ), https://tc39.es/ecma262/#sec-map.prototype.set
 void Map::map_set(Value const& key, Value value)
 {
-    auto it = m_entries.find(key);
-    if (it != m_entries.end()) {
-        it->value = value;
-    } else {
-        auto index = m_next_insertion_id++;
-        m_keys.insert(index, key);
-        m_entries.set(key, value);
+    auto hash = ValueTraits::hash(key);
+    if (auto index = find_entry_index(key, hash); index.has_value()) {
+        m_entries[*index].value = value;
+        return;
     }
+
+    if ((m_entries.size() + 1) * 2 > m_slots.size()) {
+        // If enough entries have been removed, compacting makes room without having to grow the table.
+        rebuild(slot_count_for(m_entries.size() - m_removed_entry_count + 1));
+    }
+
+    auto mask = m_slots.size() - 1;
+    auto slot_index = hash & mask;
+    while (m_slots[slot_index].entry_index != Slot::empty_index)
+        slot_index = (slot_index + 1) & mask;
+    m_slots[slot_index] = { static_cast<u32>(m_entries.size()), hash };
+    m_entries.append({ key, value, m_next_insertion_id++ });
 }
 
 size_t Map::map_size() const
 {
-    return m_keys.size();
+    return m_entries.size() - m_removed_entry_count;
 }
 
 void Map::visit_edges(Cell::Visitor& visitor)
 {
     Base::visit_edges(visitor);
-    for (auto& value : m_entries) {
-        visitor.visit(value.key);
-        visitor.visit(value.value);
+    for (auto const& entry : m_entries) {
+        if (entry.is_removed())
+            continue;
+        visitor.visit(entry.key);
+        visitor.visit(entry.value);
     }
-    // NOTE: The entries in m_keys are already visited by the walk over m_entries above.
-    visitor.ignore(m_keys);
 }
 
 }
@@ -6,8 +6,7 @@
 
 #pragma once
 
-#include <AK/HashMap.h>
-#include <AK/RedBlackTree.h>
+#include <AK/Vector.h>
 #include <LibJS/Runtime/GlobalObject.h>
 #include <LibJS/Runtime/Object.h>
 #include <LibJS/Runtime/Value.h>
@@ -31,36 +30,41 @@ public:
     void map_set(Value const&, Value);
     size_t map_size() const;
 
+    struct Entry {
+        Value key;
+        Value value;
+    };
+
     struct EndIterator {
     };
 
+    // Iterators follow the spec's model of walking the list of entries by index, so they see entries that are added
+    // while iterating, and skip ones that are removed.
     template<bool IsConst>
     struct IteratorImpl {
         bool is_end() const
         {
-            return m_map->m_keys.begin_from(m_index).is_end()
-                && m_map->m_keys.find_smallest_not_below_iterator(m_index).is_end();
+            ensure_index();
+            return m_index >= m_map->m_entries.size();
         }
 
         IteratorImpl& operator++()
         {
+            ensure_index();
             ++m_index;
+            m_insertion_id = m_index < m_map->m_entries.size() ? m_map->m_entries[m_index].insertion_id : m_map->m_next_insertion_id;
             return *this;
         }
 
-        decltype(auto) operator*()
+        // NOTE: This returns a copy, as the entry may move if the map is modified while the caller holds on to it.
+        Entry operator*() const
         {
-            ensure_next_element();
-            return *m_map->m_entries.find(*m_map->m_keys.begin_from(m_index));
-        }
-
-        decltype(auto) operator*() const
-        {
-            ensure_next_element();
-            return *m_map->m_entries.find(*m_map->m_keys.begin_from(m_index));
+            ensure_index();
+            auto const& entry = m_map->m_entries[m_index];
+            return { entry.key, entry.value };
         }
 
-        bool operator==(IteratorImpl const& other) const { return m_index == other.m_index && &m_map == &other.m_map; }
+        bool operator==(IteratorImpl const& other) const { return m_index == other.m_index && m_map == other.m_map; }
         bool operator==(EndIterator const&) const { return is_end(); }
 
     private:
@@ -69,34 +73,52 @@ public:
         requires(IsConst)
             : m_map(map)
         {
-            ensure_index();
+            initialize();
         }
 
         IteratorImpl(Map& map)
         requires(!IsConst)
             : m_map(map)
         {
-            ensure_index();
+            initialize();
         }
 
-        void ensure_index() const
+        void initialize()
         {
-            if (m_map->m_keys.is_empty())
-                m_index = m_map->m_next_insertion_id;
-            else
-                m_index = m_map->m_keys.begin().key();
+            m_layout_version = m_map->m_layout_version;
+            m_insertion_id = m_map->m_entries.is_empty() ? m_map->m_next_insertion_id : m_map->m_entries.first().insertion_id;
+            ensure_index();
         }
 
-        void ensure_next_element() const
+        void ensure_index() const
         {
-            if (auto it = m_map->m_keys.find_smallest_not_below_iterator(m_index); it.is_end())
-                m_index = m_map->m_next_insertion_id;
-            else
-                m_index = it.key();
+            auto const& entries = m_map->m_entries;
+
+            // If the entries were compacted or cleared, our index is stale, so we find our place again by looking for the
+            // first entry that wasn't inserted before the one we were at.
+            if (m_layout_version != m_map->m_layout_version) {
+                m_layout_version = m_map->m_layout_version;
+                size_t low = 0;
+                size_t high = entries.size();
+                while (low < high) {
+                    auto middle = low + (high - low) / 2;
+                    if (entries[middle].insertion_id < m_insertion_id)
+                        low = middle + 1;
+                    else
+                        high = middle;
+                }
+                m_index = low;
+            }
+
+            while (m_index < entries.size() && entries[m_index].is_removed())
+                ++m_index;
+            m_insertion_id = m_index < entries.size() ? entries[m_index].insertion_id : m_map->m_next_insertion_id;
         }
 
         Conditional<IsConst, NonnullGCPtr<Map const>, NonnullGCPtr<Map>> m_map;
         mutable size_t m_index { 0 };
+        mutable size_t m_insertion_id { 0 };
+        mutable u32 m_layout_version { 0 };
     };
 
     using Iterator = IteratorImpl<false>;
@@ -110,9 +132,33 @@ private:
     explicit Map(Object& prototype);
     virtual void visit_edges(Visitor& visitor) override;
 
+    // Entries are kept in insertion order in a dense array, with a hash table of indices into it on the side. Removed
+    // entries are left in place until there are enough of them to make compacting the array worthwhile.
+    struct StoredEntry {
+        Value key;
+        Value value;
+        size_t insertion_id { 0 };
+
+        bool is_removed() const { return key.is_empty(); }
+    };
+
+    struct Slot {
+        static constexpr u32 empty_index = NumericLimits<u32>::max();
+
+        u32 entry_index { empty_index };
+        u32 hash { 0 };
+    };
+
+    Optional<size_t> find_entry_index(Value const& key, u32 hash) const;
+    void rebuild(size_t slot_count);
+
+    Vector<StoredEntry> m_entries;
+    Vector<Slot> m_slots;
+    size_t m_removed_entry_count { 0 };
     size_t m_next_insertion_id { 0 };
-    RedBlackTree<size_t, Value> m_keys;
-    HashMap<Value, Value, ValueTraits> m_entries;
+
+    // Changes whenever entries move around, which tells iterators that they need to find their place again.
+    u32 m_layout_version { 0 };
 };
 
 }
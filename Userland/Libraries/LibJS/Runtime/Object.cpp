@@ -552,6 +552,7 @@ ThrowCompletionOr<void> Object::private_field_add(PrivateName const& name, Value
 
     // 4. Append PrivateElement { [[Key]]: P, [[Kind]]: field, [[Value]]: value } to O.[[PrivateElements]].
     m_private_elements->empend(name, PrivateElement::Kind::Field, value);
+    write_barrier(*this, value);
 
     // 5. Return unused.
     return {};
@@ -579,6 +580,7 @@ ThrowCompletionOr<void> Object::private_method_or_accessor_add(PrivateElement el
         m_private_elements = make<Vector<PrivateElement>>();
 
     // 5. Append method to O.[[PrivateElements]].
+    write_barrier(*this, element.value);
     m_private_elements->append(move(element));
 
     // 6. Return unused.
@@ -635,6 +637,7 @@ ThrowCompletionOr<void> Object::private_set(PrivateName const& name, Value value
     if (entry->kind == PrivateElement::Kind::Field) {
         // a. Set entry.[[Value]] to value.
         entry->value = value;
+        write_barrier(*this, value);
         return {};
     }
     // 4. Else if entry.[[Kind]] is method, then
@@ -1168,8 +1171,10 @@ Optional<ValueAndAttributes> Object::storage_get(PropertyKey const& property_key
             return {};
 
         if (m_has_intrinsic_accessors) {
-            if (auto accessor = find_intrinsic_accessor(this, property_key); accessor.has_value())
+            if (auto accessor = find_intrinsic_accessor(this, property_key); accessor.has_value()) {
                 const_cast<Object&>(*this).m_storage[metadata->offset] = (*accessor)(shape().realm());
+                write_barrier(*this, m_storage[metadata->offset]);
+            }
         }
 
         value = m_storage[metadata->offset];
@@ -1197,6 +1202,7 @@ void Object::storage_set(PropertyKey const& property_key, ValueAndAttributes con
     if (property_key.is_number()) {
         auto index = property_key.as_number();
         m_indexed_properties.put(index, value, attributes);
+        write_barrier(*this, value);
         return;
     }
 
@@ -1218,6 +1224,7 @@ void Object::storage_set(PropertyKey const& property_key, ValueAndAttributes con
         else
             set_shape(*m_shape->create_put_transition(property_key_string_or_symbol, attributes));
         m_storage.append(value);
+        write_barrier(*this, value);
         return;
     }
 
@@ -1229,6 +1236,7 @@ void Object::storage_set(PropertyKey const& property_key, ValueAndAttributes con
     }
 
     m_storage[metadata->offset] = value;
+    write_barrier(*this, value);
 }
 
 void Object::storage_delete(PropertyKey const& property_key)
@@ -1423,9 +1431,7 @@ void Object::visit_edges(Cell::Visitor& visitor)
     visitor.visit(m_shape);
     visitor.visit(m_storage);
 
-    m_indexed_properties.for_each_value([&visitor](auto& value) {
-        visitor.visit(value);
-    });
+    m_indexed_properties.visit_edges(visitor);
 
     if (m_private_elements) {
         for (auto& private_element : *m_private_elements)
@@ -56,6 +56,7 @@ struct CacheablePropertyMetadata {
 class Object : public Cell {
     JS_CELL(Object, Cell);
     JS_DECLARE_ALLOCATOR(Object);
+    JS_WRITE_BARRIERED_CELL(Object);
 
 public:
     static NonnullGCPtr<Object> create_prototype(Realm&, Object* prototype);
@@ -209,11 +210,19 @@ public:
     virtual void visit_edges(Cell::Visitor&) override;
 
     Value get_direct(size_t index) const { return m_storage[index]; }
-    void put_direct(size_t index, Value value) { m_storage[index] = value; }
+    void put_direct(size_t index, Value value)
+    {
+        m_storage[index] = value;
+        write_barrier(*this, value);
+    }
 
     IndexedProperties const& indexed_properties() const { return m_indexed_properties; }
     IndexedProperties& indexed_properties() { return m_indexed_properties; }
-    void set_indexed_property_elements(Vector<Value>&& values) { m_indexed_properties = IndexedProperties(move(values)); }
+    void set_indexed_property_elements(Vector<Value>&& values)
+    {
+        m_indexed_properties = IndexedProperties(move(values));
+        write_barrier_for_all_edges(*this);
+    }
 
     Shape& shape() { return *m_shape; }
     Shape const& shape() const { return *m_shape; }
@@ -14,6 +14,7 @@
 #include <LibJS/Runtime/GlobalObject.h>
 #include <LibJS/Runtime/PrimitiveString.h>
 #include <LibJS/Runtime/PropertyKey.h>
+#include <LibJS/Runtime/StringPrototype.h>
 #include <LibJS/Runtime/VM.h>
 #include <LibJS/Runtime/Value.h>
 
@@ -23,6 +24,9 @@ JS_DEFINE_ALLOCATOR(PrimitiveString);
 
 PrimitiveString::PrimitiveString(PrimitiveString& lhs, PrimitiveString& rhs)
     : m_is_rope(true)
+    , m_rope_depth(min(max(lhs.m_rope_depth, rhs.m_rope_depth), NumericLimits<u8>::max() - 1) + 1)
+    , m_has_length_in_utf16_code_units(true)
+    , m_length_in_utf16_code_units(lhs.length_in_utf16_code_units() + rhs.length_in_utf16_code_units())
     , m_lhs(&lhs)
     , m_rhs(&rhs)
 {
@@ -136,24 +140,178 @@ Utf16View PrimitiveString::utf16_string_view() const
     return m_utf16_string->view();
 }
 
+size_t PrimitiveString::length_in_utf16_code_units() const
+{
+    // NOTE: Ropes get their length when they are created, so we only ever have to compute it for resolved strings.
+    if (!m_has_length_in_utf16_code_units) {
+        auto length_of_utf8 = [&](StringView string) {
+            // Ill-formed UTF-8 is converted to UTF-16 one code point at a time, so only count well-formed strings directly.
+            if (Utf8View { string }.validate(Utf8View::AllowSurrogates::No))
+                return AK::utf16_code_unit_length_from_utf8(string);
+            return utf16_string().length_in_code_units();
+        };
+
+        if (has_utf16_string())
+            m_length_in_utf16_code_units = m_utf16_string->length_in_code_units();
+        else if (has_utf8_string())
+            m_length_in_utf16_code_units = length_of_utf8(m_utf8_string->bytes_as_string_view());
+        else if (has_byte_string())
+            m_length_in_utf16_code_units = length_of_utf8(*m_byte_string);
+        else
+            VERIFY_NOT_REACHED();
+        m_has_length_in_utf16_code_units = true;
+    }
+
+    return m_length_in_utf16_code_units;
+}
+
+u16 PrimitiveString::utf16_code_unit_at(size_t index) const
+{
+    VERIFY(index < length_in_utf16_code_units());
+
+    if (!is_walkable_rope()) {
+        resolve_rope_if_needed(EncodingPreference::UTF16);
+
+        // OPTIMIZATION: If every code point is a single code unit, UTF-8 strings are all ASCII and can be indexed directly.
+        if (!has_utf16_string() && has_utf8_string() && m_utf8_string->bytes().size() == length_in_utf16_code_units())
+            return m_utf8_string->bytes()[index];
+        return utf16_string_view().code_unit_at(index);
+    }
+
+    auto const* current = this;
+    while (current->m_is_rope) {
+        auto lhs_length = current->m_lhs->length_in_utf16_code_units();
+        if (index < lhs_length) {
+            current = current->m_lhs.ptr();
+        } else {
+            index -= lhs_length;
+            current = current->m_rhs.ptr();
+        }
+    }
+    return current->utf16_code_unit_at(index);
+}
+
+Utf16String PrimitiveString::utf16_substring(size_t code_unit_offset, size_t code_unit_length) const
+{
+    VERIFY(code_unit_offset + code_unit_length <= length_in_utf16_code_units());
+
+    if (m_is_rope && !is_walkable_rope())
+        resolve_rope_if_needed(EncodingPreference::UTF16);
+
+    Utf16Data code_units;
+    code_units.ensure_capacity(code_unit_length);
+    append_utf16_code_units(code_units, code_unit_offset, code_unit_length);
+    return Utf16String::create(move(code_units));
+}
+
+void PrimitiveString::append_utf16_code_units(Utf16Data& code_units, size_t code_unit_offset, size_t code_unit_length) const
+{
+    if (code_unit_length == 0)
+        return;
+
+    if (!m_is_rope) {
+        if (!has_utf16_string() && has_utf8_string() && m_utf8_string->bytes().size() == length_in_utf16_code_units()) {
+            for (auto byte : m_utf8_string->bytes().slice(code_unit_offset, code_unit_length))
+                code_units.unchecked_append(byte);
+            return;
+        }
+        for (auto code_unit : utf16_string().string().span().slice(code_unit_offset, code_unit_length))
+            code_units.unchecked_append(code_unit);
+        return;
+    }
+
+    // NOTE: Recursion is fine here, since we only walk ropes that are at most max_walkable_rope_depth deep.
+    auto lhs_length = m_lhs->length_in_utf16_code_units();
+    if (code_unit_offset < lhs_length) {
+        auto length_in_lhs = min(code_unit_length, lhs_length - code_unit_offset);
+        m_lhs->append_utf16_code_units(code_units, code_unit_offset, length_in_lhs);
+        code_unit_length -= length_in_lhs;
+        code_unit_offset = lhs_length;
+    }
+    m_rhs->append_utf16_code_units(code_units, code_unit_offset - lhs_length, code_unit_length);
+}
+
+Optional<size_t> PrimitiveString::index_of(Utf16View const& search_value, size_t from_index) const
+{
+    if (!is_walkable_rope())
+        return string_index_of(utf16_string_view(), search_value, from_index);
+
+    auto length = length_in_utf16_code_units();
+    auto search_length = search_value.length_in_code_units();
+    if (search_length == 0)
+        return from_index <= length ? from_index : Optional<size_t> {};
+    if (search_length > length)
+        return {};
+
+    // The parts of the rope are searched one by one. Matches that start in one part and end in a later one are looked
+    // for in the last search_length - 1 code units seen so far, followed by the start of the next part.
+    Utf16Data previous_code_units;
+    size_t previous_code_units_offset = 0;
+    size_t part_offset = 0;
+
+    // NOTE: We traverse the rope tree without using recursion, like resolve_rope_if_needed() does.
+    Vector<PrimitiveString const*, 16> stack;
+    stack.append(m_rhs);
+    stack.append(m_lhs);
+    while (!stack.is_empty()) {
+        auto const* part = stack.take_last();
+        if (part->m_is_rope) {
+            stack.append(part->m_rhs);
+            stack.append(part->m_lhs);
+            continue;
+        }
+
+        auto part_length = part->length_in_utf16_code_units();
+        auto part_end = part_offset + part_length;
+        if (part_end <= from_index) {
+            // Nothing in this part can be in a match, so there's nothing to remember from it either.
+            previous_code_units.clear();
+            part_offset = part_end;
+            continue;
+        }
+
+        auto part_view = part->utf16_string_view();
+        if (!previous_code_units.is_empty()) {
+            Utf16Data window = previous_code_units;
+            window.append(part_view.data(), min(search_length - 1, part_length));
+            auto window_from_index = from_index - min(from_index, previous_code_units_offset);
+            if (auto index = string_index_of(Utf16View { window }, search_value, window_from_index); index.has_value() && *index < previous_code_units.size())
+                return previous_code_units_offset + *index;
+        }
+
+        auto part_from_index = from_index - min(from_index, part_offset);
+        if (part_from_index <= part_length) {
+            if (auto index = string_index_of(part_view, search_value, part_from_index); index.has_value())
+                return part_offset + *index;
+        }
+
+        auto kept_length = min(search_length - 1, previous_code_units.size() + part_length);
+        auto kept_from_part = min(kept_length, part_length);
+        previous_code_units.remove(0, previous_code_units.size() - (kept_length - kept_from_part));
+        previous_code_units.append(part_view.data() + part_length - kept_from_part, kept_from_part);
+        previous_code_units_offset = part_end - kept_length;
+        part_offset = part_end;
+    }
+
+    return {};
+}
+
 ThrowCompletionOr<Optional<Value>> PrimitiveString::get(VM& vm, PropertyKey const& property_key) const
 {
     if (property_key.is_symbol())
         return Optional<Value> {};
     if (property_key.is_string()) {
         if (property_key.as_string() == vm.names.length.as_string()) {
-            auto length = utf16_string().length_in_code_units();
+            auto length = length_in_utf16_code_units();
             return Value(static_cast<double>(length));
         }
     }
     auto index = canonical_numeric_index_string(property_key, CanonicalIndexMode::IgnoreNumericRoundtrip);
     if (!index.is_index())
         return Optional<Value> {};
-    auto str = utf16_string_view();
-    auto length = str.length_in_code_units();
-    if (length <= index.as_index())
+    if (length_in_utf16_code_units() <= index.as_index())
         return Optional<Value> {};
-    return create(vm, Utf16String::create(str.substring_view(index.as_index(), 1)));
+    return create(vm, utf16_substring(index.as_index(), 1));
 }
 
 NonnullGCPtr<PrimitiveString> PrimitiveString::create(VM& vm, Utf16String string)
@@ -243,6 +401,30 @@ NonnullGCPtr<PrimitiveString> PrimitiveString::create(VM& vm, PrimitiveString& l
     if (rhs_empty)
         return lhs;
 
+    // Concatenating onto the same end of a string over and over, as `s += x` does, would make a rope as deep as it has
+    // parts. So like a carry in a binary counter, when lhs is the deeper one, its right part is concatenated with rhs
+    // first for as long as that part isn't deeper than rhs, and likewise for the left part of a deeper rhs. This keeps
+    // ropes built from either end about logarithmically deep, with one new rope per concatenation when amortized. The
+    // ropes we were given are left as they are. Ropes built from both ends at once still get deeper, until they are
+    // too deep to be walked and get resolved.
+    PrimitiveString* left = &lhs;
+    PrimitiveString* right = &rhs;
+    if (left->m_rope_depth >= right->m_rope_depth) {
+        while (left->m_is_rope && left->m_rhs->m_rope_depth <= right->m_rope_depth) {
+            right = create_rope(vm, *left->m_rhs, *right).ptr();
+            left = left->m_lhs.ptr();
+        }
+    } else {
+        while (right->m_is_rope && right->m_lhs->m_rope_depth <= left->m_rope_depth) {
+            left = create_rope(vm, *left, *right->m_lhs).ptr();
+            right = right->m_rhs.ptr();
+        }
+    }
+    return create_rope(vm, *left, *right);
+}
+
+NonnullGCPtr<PrimitiveString> PrimitiveString::create_rope(VM& vm, PrimitiveString& lhs, PrimitiveString& rhs)
+{
     return vm.heap().allocate_without_realm<PrimitiveString>(lhs, rhs);
 }
 
@@ -284,6 +466,7 @@ void PrimitiveString::resolve_rope_if_needed(EncodingPreference preference) cons
 
         m_utf16_string = Utf16String::create(move(code_units));
         m_is_rope = false;
+        m_rope_depth = 0;
         m_lhs = nullptr;
         m_rhs = nullptr;
         return;
@@ -353,6 +536,7 @@ void PrimitiveString::resolve_rope_if_needed(EncodingPreference preference) cons
     // NOTE: We've already produced valid UTF-8 above, so there's no need for additional validation.
     m_utf8_string = builder.to_string_without_validation();
     m_is_rope = false;
+    m_rope_depth = 0;
     m_lhs = nullptr;
     m_rhs = nullptr;
 }
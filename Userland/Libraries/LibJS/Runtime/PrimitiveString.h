@@ -23,6 +23,7 @@ namespace JS {
 class PrimitiveString final : public Cell {
     JS_CELL(PrimitiveString, Cell);
     JS_DECLARE_ALLOCATOR(PrimitiveString);
+    JS_WRITE_BARRIERED_CELL(PrimitiveString);
 
 public:
     [[nodiscard]] static NonnullGCPtr<PrimitiveString> create(VM&, Utf16String);
@@ -51,6 +52,12 @@ public:
     [[nodiscard]] Utf16View utf16_string_view() const;
     bool has_utf16_string() const { return m_utf16_string.has_value(); }
 
+    // These don't resolve ropes, unless they are too deep to be walked quickly.
+    [[nodiscard]] size_t length_in_utf16_code_units() const;
+    [[nodiscard]] u16 utf16_code_unit_at(size_t index) const;
+    [[nodiscard]] Utf16String utf16_substring(size_t code_unit_offset, size_t code_unit_length) const;
+    [[nodiscard]] Optional<size_t> index_of(Utf16View const& search_value, size_t from_index) const;
+
     ThrowCompletionOr<Optional<Value>> get(VM&, PropertyKey const&) const;
 
 private:
@@ -67,7 +74,20 @@ private:
     };
     void resolve_rope_if_needed(EncodingPreference) const;
 
+    // Ropes deeper than this are resolved rather than walked when looking at parts of them. Concatenation keeps ropes
+    // built from one end about logarithmically deep, so those only get this deep with more parts than fit in memory.
+    static constexpr size_t max_walkable_rope_depth = 64;
+    bool is_walkable_rope() const { return m_is_rope && m_rope_depth <= max_walkable_rope_depth; }
+
+    static NonnullGCPtr<PrimitiveString> create_rope(VM&, PrimitiveString&, PrimitiveString&);
+
+    void append_utf16_code_units(Utf16Data&, size_t code_unit_offset, size_t code_unit_length) const;
+
     mutable bool m_is_rope { false };
+    // NOTE: This saturates, which is fine as it's way past max_walkable_rope_depth.
+    mutable u8 m_rope_depth { 0 };
+    mutable bool m_has_length_in_utf16_code_units { false };
+    mutable size_t m_length_in_utf16_code_units { 0 };
 
     mutable GCPtr<PrimitiveString> m_lhs;
     mutable GCPtr<PrimitiveString> m_rhs;
@@ -16,6 +16,7 @@ namespace JS {
 class PromiseCapability final : public Cell {
     JS_CELL(PromiseCapability, Cell);
     JS_DECLARE_ALLOCATOR(PromiseCapability);
+    JS_CONCURRENTLY_SWEPT_CELL(PromiseCapability);
 
 public:
     static NonnullGCPtr<PromiseCapability> create(VM& vm, NonnullGCPtr<Object> promise, NonnullGCPtr<FunctionObject> resolve, NonnullGCPtr<FunctionObject> reject);
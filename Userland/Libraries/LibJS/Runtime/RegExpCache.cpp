@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2026, agent <agent@local>
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibJS/Runtime/RegExpCache.h>
+
+namespace JS {
+
+RegExpCache& RegExpCache::the()
+{
+    static RegExpCache s_the;
+    return s_the;
+}
+
+RegExpCache::~RegExpCache()
+{
+    m_lru_list.clear();
+}
+
+Regex<ECMA262> RegExpCache::compile(ByteString pattern, regex::RegexOptions<ECMAScriptFlags> flags)
+{
+    if (auto regex = lookup(pattern, flags); regex.has_value())
+        return regex.release_value();
+
+    Regex<ECMA262> regex(move(pattern), flags);
+    insert(regex, flags);
+    return regex;
+}
+
+Regex<ECMA262> RegExpCache::compile(regex::Parser::Result const& parse_result, ByteString pattern, regex::RegexOptions<ECMAScriptFlags> flags)
+{
+    if (auto regex = lookup(pattern, flags); regex.has_value())
+        return regex.release_value();
+
+    Regex<ECMA262> regex(parse_result, move(pattern), flags);
+    insert(regex, flags);
+    return regex;
+}
+
+Optional<Regex<ECMA262>> RegExpCache::lookup(ByteString const& pattern, regex::RegexOptions<ECMAScriptFlags> flags)
+{
+    auto it = m_entries.find(RegExpCacheKey { pattern, to_underlying(flags.value()) });
+    if (it == m_entries.end())
+        return {};
+
+    auto& entry = *it->value;
+    m_lru_list.prepend(entry);
+
+    // NOTE: The parse result has been through the optimizer already, so this doesn't run the optimization passes again.
+    return Regex<ECMA262>(entry.parser_result, pattern, flags);
+}
+
+void RegExpCache::insert(Regex<ECMA262> const& regex, regex::RegexOptions<ECMAScriptFlags> flags)
+{
+    if (regex.parser_result.error != regex::Error::NoError)
+        return;
+    if (regex.pattern_value.length() > max_cached_pattern_length)
+        return;
+
+    if (m_entries.size() >= max_entry_count) {
+        auto* least_recently_used = m_lru_list.take_last();
+        m_entries.remove(least_recently_used->key);
+    }
+
+    RegExpCacheKey key { regex.pattern_value, to_underlying(flags.value()) };
+    auto entry = make<Entry>(key, regex.parser_result);
+    m_lru_list.prepend(*entry);
+    m_entries.set(move(key), move(entry));
+}
+
+}
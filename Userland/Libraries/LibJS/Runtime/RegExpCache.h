@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2026, agent <agent@local>
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/ByteString.h>
+#include <AK/HashMap.h>
+#include <AK/IntrusiveList.h>
+#include <AK/NonnullOwnPtr.h>
+#include <LibRegex/Regex.h>
+
+namespace JS {
+
+struct RegExpCacheKey {
+    ByteString pattern;
+    u32 flags { 0 };
+
+    bool operator==(RegExpCacheKey const&) const = default;
+};
+
+}
+
+template<>
+struct AK::Traits<JS::RegExpCacheKey> : public DefaultTraits<JS::RegExpCacheKey> {
+    static unsigned hash(JS::RegExpCacheKey const& key) { return pair_int_hash(key.pattern.hash(), int_hash(key.flags)); }
+};
+
+namespace JS {
+
+// Keeps the optimized bytecode of recently compiled regular expressions, keyed by pattern and flags, so that creating
+// the same RegExp again (from any realm) doesn't have to go through the regex parser and optimizer.
+// Every Regex handed out gets its own copy of the bytecode, so no matching state is ever shared between them.
+class RegExpCache {
+    AK_MAKE_NONCOPYABLE(RegExpCache);
+    AK_MAKE_NONMOVABLE(RegExpCache);
+
+public:
+    static RegExpCache& the();
+
+    ~RegExpCache();
+
+    // NOTE: `pattern` is the pattern after parse_regex_pattern(), not the original source text.
+    Regex<ECMA262> compile(ByteString pattern, regex::RegexOptions<ECMAScriptFlags> flags);
+
+    // Same as above, for callers that already have an (unoptimized) parse result for the pattern.
+    Regex<ECMA262> compile(regex::Parser::Result const&, ByteString pattern, regex::RegexOptions<ECMAScriptFlags> flags);
+
+private:
+    static constexpr size_t max_entry_count = 256;
+    static constexpr size_t max_cached_pattern_length = 16 * KiB;
+
+    struct Entry {
+        RegExpCacheKey key;
+        regex::Parser::Result parser_result;
+        IntrusiveListNode<Entry> list_node;
+
+        using List = IntrusiveList<&Entry::list_node>;
+    };
+
+    RegExpCache() = default;
+
+    Optional<Regex<ECMA262>> lookup(ByteString const& pattern, regex::RegexOptions<ECMAScriptFlags> flags);
+    void insert(Regex<ECMA262> const&, regex::RegexOptions<ECMAScriptFlags> flags);
+
+    HashMap<RegExpCacheKey, NonnullOwnPtr<Entry>> m_entries;
+
+    // Most recently used entries first.
+    Entry::List m_lru_list;
+};
+
+}
@@ -0,0 +1,207 @@
+/*
+ * Copyright (c) 2026, agent <agent@local>
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/JsonArray.h>
+#include <AK/JsonObject.h>
+#include <AK/StringBuilder.h>
+#include <LibJS/Bytecode/Executable.h>
+#include <LibJS/Bytecode/Interpreter.h>
+#include <LibJS/Runtime/PrimitiveString.h>
+#include <LibJS/Runtime/SamplingProfiler.h>
+#include <LibJS/Runtime/VM.h>
+#include <unistd.h>
+
+namespace JS {
+
+Atomic<u32> g_sampling_profiler_count { 0 };
+
+NonnullOwnPtr<SamplingProfiler> SamplingProfiler::create(VM& vm, AK::Duration interval)
+{
+    return adopt_own(*new SamplingProfiler(vm, interval));
+}
+
+SamplingProfiler::SamplingProfiler(VM& vm, AK::Duration interval)
+    : m_vm(vm)
+    , m_interval(interval)
+    , m_start_time(MonotonicTime::now())
+{
+    // The root node stands for "no JavaScript running", and has no frame of its own.
+    m_frames.append({});
+    m_nodes.append({});
+
+    m_timer_thread = Threading::Thread::construct([this] {
+        while (!m_timer_should_stop.load(AK::MemoryOrder::memory_order_relaxed)) {
+            ::usleep(m_interval.to_microseconds());
+            m_sample_requested.store(true, AK::MemoryOrder::memory_order_relaxed);
+        }
+        return static_cast<intptr_t>(0);
+    },
+        "JS profiler"sv);
+    m_timer_thread->start();
+
+    g_sampling_profiler_count.fetch_add(1, AK::MemoryOrder::memory_order_relaxed);
+}
+
+SamplingProfiler::~SamplingProfiler()
+{
+    g_sampling_profiler_count.fetch_sub(1, AK::MemoryOrder::memory_order_relaxed);
+
+    m_timer_should_stop.store(true, AK::MemoryOrder::memory_order_relaxed);
+    (void)m_timer_thread->join();
+}
+
+size_t SamplingProfiler::intern_frame(SamplingProfilerFrame frame)
+{
+    if (auto index = m_frame_indices.get(frame); index.has_value())
+        return *index;
+
+    auto index = m_frames.size();
+    m_frames.append(frame);
+    m_frame_indices.set(move(frame), index);
+    return index;
+}
+
+void SamplingProfiler::take_sample()
+{
+    m_sample_requested.store(false, AK::MemoryOrder::memory_order_relaxed);
+
+    auto const& stack = m_vm.execution_context_stack();
+    auto node_index = root_node_index;
+
+    for (size_t i = 0; i < stack.size(); ++i) {
+        auto const& context = *stack[i];
+
+        // NOTE: Only contexts that have called into another one have their program counter saved, the innermost
+        //       one is being run by the interpreter right now.
+        auto program_counter = i == stack.size() - 1 ? m_vm.bytecode_interpreter().program_counter() : context.program_counter;
+
+        SamplingProfilerFrame frame;
+        if (context.function_name)
+            frame.function_name = context.function_name->byte_string();
+        if (context.executable && program_counter.has_value()) {
+            auto source_range = context.executable->source_range_at(*program_counter);
+            frame.source_code = move(source_range.source_code);
+            frame.source_offset = source_range.start_offset;
+        }
+
+        auto frame_index = intern_frame(move(frame));
+        if (auto child = m_nodes[node_index].children.get(frame_index); child.has_value()) {
+            node_index = *child;
+            continue;
+        }
+
+        auto child_index = m_nodes.size();
+        m_nodes.append({ .frame_index = frame_index, .parent = node_index });
+        m_nodes[node_index].children.set(frame_index, child_index);
+        node_index = child_index;
+    }
+
+    ++m_nodes[node_index].self_sample_count;
+    m_samples.append({ .node_index = node_index, .time = MonotonicTime::now() });
+}
+
+ByteString SamplingProfiler::describe_frame(size_t frame_index) const
+{
+    auto const& frame = m_frames[frame_index];
+    auto function_name = frame.function_name.is_empty() ? "(anonymous)"sv : frame.function_name.view();
+    if (!frame.source_code)
+        return function_name;
+
+    auto source_range = frame.source_code->range_from_offsets(frame.source_offset, frame.source_offset);
+    return ByteString::formatted("{} ({}:{}:{})", function_name, source_range.filename(), source_range.start.line, source_range.start.column);
+}
+
+ByteString SamplingProfiler::to_folded_stacks() const
+{
+    StringBuilder builder;
+    Vector<ByteString> stack;
+
+    for (size_t node_index = 0; node_index < m_nodes.size(); ++node_index) {
+        auto const& node = m_nodes[node_index];
+        if (node.self_sample_count == 0 || node_index == root_node_index)
+            continue;
+
+        stack.clear_with_capacity();
+        for (Optional<size_t> index = node_index; index.has_value() && *index != root_node_index; index = m_nodes[*index].parent) {
+            // NOTE: Semicolons separate frames in this format, so they can't appear in frame names.
+            stack.append(describe_frame(m_nodes[*index].frame_index).replace(";"sv, ":"sv, ReplaceMode::All));
+        }
+
+        for (size_t i = stack.size(); i > 0; --i) {
+            builder.append(stack[i - 1]);
+            builder.append(i == 1 ? ' ' : ';');
+        }
+        builder.appendff("{}\n", node.self_sample_count);
+    }
+
+    return builder.to_byte_string();
+}
+
+ByteString SamplingProfiler::to_cpuprofile() const
+{
+    HashMap<SourceCode const*, size_t> script_ids;
+
+    JsonArray nodes;
+    for (size_t node_index = 0; node_index < m_nodes.size(); ++node_index) {
+        auto const& node = m_nodes[node_index];
+        auto const& frame = m_frames[node.frame_index];
+
+        JsonObject call_frame;
+        if (node_index == root_node_index) {
+            call_frame.set("functionName", "(root)");
+        } else {
+            call_frame.set("functionName", frame.function_name.is_empty() ? "(anonymous)"sv : frame.function_name.view());
+        }
+
+        if (frame.source_code) {
+            auto script_id = script_ids.ensure(frame.source_code.ptr(), [&] { return script_ids.size() + 1; });
+            auto source_range = frame.source_code->range_from_offsets(frame.source_offset, frame.source_offset);
+
+            // NOTE: Lines and columns are zero-based in this format.
+            call_frame.set("scriptId", ByteString::number(script_id));
+            call_frame.set("url", source_range.filename());
+            call_frame.set("lineNumber", source_range.start.line - 1);
+            call_frame.set("columnNumber", source_range.start.column - 1);
+        } else {
+            call_frame.set("scriptId", "0");
+            call_frame.set("url", "");
+            call_frame.set("lineNumber", -1);
+            call_frame.set("columnNumber", -1);
+        }
+
+        JsonArray children;
+        for (auto child_index : node.children)
+            children.must_append(child_index.value + 1);
+
+        JsonObject json_node;
+        json_node.set("id", node_index + 1);
+        json_node.set("callFrame", move(call_frame));
+        json_node.set("hitCount", node.self_sample_count);
+        json_node.set("children", move(children));
+        nodes.must_append(move(json_node));
+    }
+
+    JsonArray samples;
+    JsonArray time_deltas;
+    auto previous_time = m_start_time;
+    for (auto const& sample : m_samples) {
+        samples.must_append(sample.node_index + 1);
+        time_deltas.must_append((sample.time - previous_time).to_microseconds());
+        previous_time = sample.time;
+    }
+
+    auto end_time = m_samples.is_empty() ? m_start_time : m_samples.last().time;
+
+    JsonObject profile;
+    profile.set("nodes", move(nodes));
+    profile.set("startTime", m_start_time.nanoseconds() / 1000);
+    profile.set("endTime", end_time.nanoseconds() / 1000);
+    profile.set("samples", move(samples));
+    profile.set("timeDeltas", move(time_deltas));
+    return profile.to_byte_string();
+}
+
+}
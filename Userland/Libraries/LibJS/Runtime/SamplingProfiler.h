@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2026, agent <agent@local>
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Atomic.h>
+#include <AK/ByteString.h>
+#include <AK/HashMap.h>
+#include <AK/RefPtr.h>
+#include <AK/Time.h>
+#include <AK/Vector.h>
+#include <LibJS/Forward.h>
+#include <LibJS/SourceCode.h>
+#include <LibThreading/Thread.h>
+
+namespace JS {
+
+struct SamplingProfilerFrame {
+    ByteString function_name;
+    RefPtr<SourceCode const> source_code;
+    u32 source_offset { 0 };
+
+    bool operator==(SamplingProfilerFrame const&) const = default;
+};
+
+}
+
+template<>
+struct AK::Traits<JS::SamplingProfilerFrame> : public DefaultTraits<JS::SamplingProfilerFrame> {
+    static unsigned hash(JS::SamplingProfilerFrame const& frame)
+    {
+        return pair_int_hash(frame.function_name.hash(), pair_int_hash(ptr_hash(frame.source_code.ptr()), frame.source_offset));
+    }
+};
+
+namespace JS {
+
+// The number of sampling profilers that currently exist in this process. The interpreter checks this before looking
+// for its VM's profiler, so that code that isn't being profiled only pays for loading it.
+extern Atomic<u32> g_sampling_profiler_count;
+
+// Records where JavaScript code spends its time by periodically looking at the execution context stack.
+//
+// A timer thread requests a sample every `interval`, and the bytecode interpreter takes it at the next backward jump
+// or function entry. Walking the stack from the timer itself wouldn't be safe, since the stack is only consistent
+// between instructions. Each frame is attributed to the source position of the bytecode it was executing.
+class SamplingProfiler {
+    AK_MAKE_NONCOPYABLE(SamplingProfiler);
+    AK_MAKE_NONMOVABLE(SamplingProfiler);
+
+public:
+    static NonnullOwnPtr<SamplingProfiler> create(VM&, AK::Duration interval);
+    ~SamplingProfiler();
+
+    [[nodiscard]] bool should_take_sample() const { return m_sample_requested.load(AK::MemoryOrder::memory_order_relaxed); }
+    void take_sample();
+
+    size_t sample_count() const { return m_samples.size(); }
+
+    // One line per distinct stack, with frames separated by semicolons, followed by the number of samples taken in it.
+    // This is what flame graph tools (e.g. inferno or flamegraph.pl) take as input.
+    ByteString to_folded_stacks() const;
+
+    // A profile in the format of the Chrome DevTools protocol, which is what .cpuprofile files contain.
+    ByteString to_cpuprofile() const;
+
+private:
+    SamplingProfiler(VM&, AK::Duration interval);
+
+    struct Node {
+        size_t frame_index { 0 };
+        Optional<size_t> parent;
+        size_t self_sample_count { 0 };
+        HashMap<size_t, size_t> children;
+    };
+
+    struct Sample {
+        size_t node_index { 0 };
+        MonotonicTime time;
+    };
+
+    static constexpr size_t root_node_index = 0;
+
+    size_t intern_frame(SamplingProfilerFrame);
+    ByteString describe_frame(size_t frame_index) const;
+
+    VM& m_vm;
+    AK::Duration m_interval;
+    MonotonicTime m_start_time;
+
+    Vector<SamplingProfilerFrame> m_frames;
+    HashMap<SamplingProfilerFrame, size_t> m_frame_indices;
+    Vector<Node> m_nodes;
+    Vector<Sample> m_samples;
+
+    Atomic<bool> m_sample_requested { false };
+    Atomic<bool> m_timer_should_stop { false };
+    RefPtr<Threading::Thread> m_timer_thread;
+};
+
+}
@@ -209,7 +209,7 @@ JS_DEFINE_NATIVE_FUNCTION(SetPrototype::for_each)
     // 5. Let numEntries be the number of elements in entries.
     // 6. Let index be 0.
     // 7. Repeat, while index < numEntries,
-    for (auto& entry : *set) {
+    for (auto const& entry : *set) {
         // a. Let e be entries[index].
         // b. Set index to index + 1.
         // c. If e is not empty, then
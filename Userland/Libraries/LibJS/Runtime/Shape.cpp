@@ -15,6 +15,62 @@ JS_DEFINE_ALLOCATOR(PrototypeChainValidity);
 
 static HashTable<JS::GCPtr<Shape>> s_all_prototype_shapes;
 
+NonnullRefPtr<PropertyTable> PropertyTable::clone(size_t entry_count) const
+{
+    VERIFY(entry_count <= m_entries.size());
+    auto table = create();
+    table->m_entries.ensure_capacity(entry_count);
+    table->m_indices.ensure_capacity(entry_count);
+    for (size_t i = 0; i < entry_count; ++i) {
+        table->m_entries.unchecked_append(m_entries[i]);
+        table->m_indices.set(m_entries[i].key, i);
+    }
+    return table;
+}
+
+void PropertyTable::append(StringOrSymbol const& key, PropertyMetadata metadata)
+{
+    m_indices.set(key, m_entries.size());
+    m_entries.append({ key, metadata });
+}
+
+void PropertyTable::remove(size_t index)
+{
+    auto removed_offset = m_entries[index].value.offset;
+    m_indices.remove(m_entries[index].key);
+    m_entries.remove(index);
+
+    for (size_t i = 0; i < m_entries.size(); ++i) {
+        auto& entry = m_entries[i];
+        VERIFY(entry.value.offset != removed_offset);
+        if (entry.value.offset > removed_offset)
+            --entry.value.offset;
+        if (i >= index)
+            m_indices.set(entry.key, i);
+    }
+}
+
+// NOTE: This doesn't account for the hash tables' bucket metadata, so it's a slight underestimate.
+template<typename HashMapType>
+static size_t hash_map_memory_usage(HashMapType const& map)
+{
+    return sizeof(map) + map.capacity() * (sizeof(typename HashMapType::KeyType) + sizeof(typename HashMapType::ValueType));
+}
+
+size_t PropertyTable::memory_usage() const
+{
+    return sizeof(PropertyTable) + m_entries.capacity() * sizeof(Entry) + hash_map_memory_usage(m_indices);
+}
+
+Vector<StringOrSymbol> PropertyTableView::keys() const
+{
+    Vector<StringOrSymbol> keys;
+    keys.ensure_capacity(m_size);
+    for (auto const& entry : *this)
+        keys.unchecked_append(entry.key);
+    return keys;
+}
+
 Shape::~Shape()
 {
     if (m_is_prototype_shape)
@@ -29,9 +85,8 @@ NonnullGCPtr<Shape> Shape::create_cacheable_dictionary_transition()
     new_shape->m_prototype = m_prototype;
     invalidate_prototype_if_needed_for_new_prototype(new_shape);
     ensure_property_table();
-    new_shape->ensure_property_table();
-    (*new_shape->m_property_table) = *m_property_table;
-    new_shape->m_property_count = new_shape->m_property_table->size();
+    new_shape->m_property_table = m_property_table;
+    new_shape->m_property_count = m_property_count;
     return new_shape;
 }
 
@@ -43,9 +98,8 @@ NonnullGCPtr<Shape> Shape::create_uncacheable_dictionary_transition()
     new_shape->m_prototype = m_prototype;
     invalidate_prototype_if_needed_for_new_prototype(new_shape);
     ensure_property_table();
-    new_shape->ensure_property_table();
-    (*new_shape->m_property_table) = *m_property_table;
-    new_shape->m_property_count = new_shape->m_property_table->size();
+    new_shape->m_property_table = m_property_table;
+    new_shape->m_property_count = m_property_count;
     return new_shape;
 }
 
@@ -53,6 +107,14 @@ GCPtr<Shape> Shape::get_or_prune_cached_forward_transition(TransitionKey const&
 {
     if (m_is_prototype_shape)
         return nullptr;
+    if (m_single_forward_transition_key.property_key.is_valid() && m_single_forward_transition_key == key) {
+        if (!m_single_forward_transition) {
+            // The cached forward transition has gone stale (from garbage collection). Prune it.
+            m_single_forward_transition_key = {};
+            return nullptr;
+        }
+        return m_single_forward_transition.ptr();
+    }
     if (!m_forward_transitions)
         return nullptr;
     auto it = m_forward_transitions->find(key);
@@ -66,6 +128,22 @@ GCPtr<Shape> Shape::get_or_prune_cached_forward_transition(TransitionKey const&
     return it->value.ptr();
 }
 
+void Shape::set_cached_forward_transition(TransitionKey const& key, Shape& shape)
+{
+    // The keys of forward transitions are visited, so storing a symbol into one needs a write barrier.
+    if (key.property_key.is_symbol())
+        write_barrier(*this, *key.property_key.as_symbol());
+
+    if (!m_single_forward_transition_key.property_key.is_valid() || !m_single_forward_transition) {
+        m_single_forward_transition_key = key;
+        m_single_forward_transition = shape;
+        return;
+    }
+    if (!m_forward_transitions)
+        m_forward_transitions = make<HashMap<TransitionKey, WeakPtr<Shape>>>();
+    m_forward_transitions->set(key, &shape);
+}
+
 GCPtr<Shape> Shape::get_or_prune_cached_delete_transition(StringOrSymbol const& key)
 {
     if (m_is_prototype_shape)
@@ -107,11 +185,8 @@ NonnullGCPtr<Shape> Shape::create_put_transition(StringOrSymbol const& property_
         return *existing_shape;
     auto new_shape = heap().allocate_without_realm<Shape>(*this, property_key, attributes, TransitionType::Put);
     invalidate_prototype_if_needed_for_new_prototype(new_shape);
-    if (!m_is_prototype_shape) {
-        if (!m_forward_transitions)
-            m_forward_transitions = make<HashMap<TransitionKey, WeakPtr<Shape>>>();
-        m_forward_transitions->set(key, new_shape.ptr());
-    }
+    if (!m_is_prototype_shape)
+        set_cached_forward_transition(key, *new_shape);
     return new_shape;
 }
 
@@ -122,11 +197,8 @@ NonnullGCPtr<Shape> Shape::create_configure_transition(StringOrSymbol const& pro
         return *existing_shape;
     auto new_shape = heap().allocate_without_realm<Shape>(*this, property_key, attributes, TransitionType::Configure);
     invalidate_prototype_if_needed_for_new_prototype(new_shape);
-    if (!m_is_prototype_shape) {
-        if (!m_forward_transitions)
-            m_forward_transitions = make<HashMap<TransitionKey, WeakPtr<Shape>>>();
-        m_forward_transitions->set(key, new_shape.ptr());
-    }
+    if (!m_is_prototype_shape)
+        set_cached_forward_transition(key, *new_shape);
     return new_shape;
 }
 
@@ -191,11 +263,13 @@ void Shape::visit_edges(Cell::Visitor& visitor)
     m_property_key.visit_edges(visitor);
 
     // NOTE: We don't need to mark the keys in the property table, since they are guaranteed
-    //       to also be marked by the chain of shapes leading up to this one.
+    //       to also be marked by the chain of shapes leading up to this one. A shared table may also hold
+    //       entries of shapes that have since died, but symbols in those are only ever compared by address.
 
     visitor.ignore(m_prototype_transitions);
 
     // FIXME: The forward transition keys should be weak, but we have to mark them for now in case they go stale.
+    m_single_forward_transition_key.property_key.visit_edges(visitor);
     if (m_forward_transitions) {
         for (auto& it : *m_forward_transitions)
             it.key.property_key.visit_edges(visitor);
@@ -214,60 +288,91 @@ Optional<PropertyMetadata> Shape::lookup(StringOrSymbol const& property_key) con
 {
     if (m_property_count == 0)
         return {};
-    auto property = property_table().get(property_key);
-    if (!property.has_value())
+    ensure_property_table();
+    auto index = m_property_table->index_of(property_key);
+    if (!index.has_value() || *index >= m_property_count)
         return {};
-    return property;
+    return m_property_table->at(*index).value;
 }
 
-FLATTEN OrderedHashMap<StringOrSymbol, PropertyMetadata> const& Shape::property_table() const
+FLATTEN PropertyTableView Shape::property_table() const
 {
     ensure_property_table();
-    return *m_property_table;
+    return { *m_property_table, m_property_count };
 }
 
 void Shape::ensure_property_table() const
 {
     if (m_property_table)
         return;
-    m_property_table = make<OrderedHashMap<StringOrSymbol, PropertyMetadata>>();
 
+    RefPtr<PropertyTable> table;
     u32 next_offset = 0;
 
     Vector<Shape const&, 64> transition_chain;
     transition_chain.append(*this);
     for (auto shape = m_previous; shape; shape = shape->m_previous) {
         if (shape->m_property_table) {
-            *m_property_table = *shape->m_property_table;
+            table = shape->m_property_table;
             next_offset = shape->m_property_count;
             break;
         }
         transition_chain.append(*shape);
     }
 
+    // NOTE: Until we make a copy, the table may be seen by other shapes, so we may only append to it.
+    bool table_is_ours = false;
+    if (!table) {
+        table = PropertyTable::create();
+        table_is_ours = true;
+    }
+
+    auto make_table_ours = [&] {
+        if (table_is_ours)
+            return;
+        table = table->clone(next_offset);
+        table_is_ours = true;
+    };
+
     for (auto const& shape : transition_chain.in_reverse()) {
         if (!shape.m_property_key.is_valid()) {
             // Ignore prototype transitions as they don't affect the key map.
             continue;
         }
         if (shape.m_transition_type == TransitionType::Put) {
-            m_property_table->set(shape.m_property_key, { next_offset++, shape.m_attributes });
+            if (next_offset < table->size()) {
+                // Another shape that shares the table got here first. If it added the same property, we can keep sharing.
+                auto const& entry = table->at(next_offset);
+                if (entry.key == shape.m_property_key && entry.value.offset == next_offset && entry.value.attributes == shape.m_attributes) {
+                    ++next_offset;
+                    continue;
+                }
+                make_table_ours();
+            }
+            table->append(shape.m_property_key, { next_offset++, shape.m_attributes });
         } else if (shape.m_transition_type == TransitionType::Configure) {
-            auto it = m_property_table->find(shape.m_property_key);
-            VERIFY(it != m_property_table->end());
-            it->value.attributes = shape.m_attributes;
+            make_table_ours();
+            auto index = table->index_of(shape.m_property_key);
+            VERIFY(index.has_value());
+            table->set_attributes(*index, shape.m_attributes);
         } else if (shape.m_transition_type == TransitionType::Delete) {
-            auto remove_it = m_property_table->find(shape.m_property_key);
-            VERIFY(remove_it != m_property_table->end());
-            auto removed_offset = remove_it->value.offset;
-            m_property_table->remove(remove_it);
-            for (auto& it : *m_property_table) {
-                if (it.value.offset > removed_offset)
-                    --it.value.offset;
-            }
+            make_table_ours();
+            auto index = table->index_of(shape.m_property_key);
+            VERIFY(index.has_value());
+            table->remove(*index);
             --next_offset;
         }
     }
+
+    VERIFY(next_offset == m_property_count);
+    m_property_table = move(table);
+}
+
+void Shape::ensure_unshared_property_table()
+{
+    ensure_property_table();
+    if (m_property_table->ref_count() > 1 || m_property_table->size() != m_property_count)
+        m_property_table = m_property_table->clone(m_property_count);
 }
 
 NonnullGCPtr<Shape> Shape::create_delete_transition(StringOrSymbol const& property_key)
@@ -279,17 +384,22 @@ NonnullGCPtr<Shape> Shape::create_delete_transition(StringOrSymbol const& proper
     if (!m_delete_transitions)
         m_delete_transitions = make<HashMap<StringOrSymbol, WeakPtr<Shape>>>();
     m_delete_transitions->set(property_key, new_shape.ptr());
+    if (property_key.is_symbol())
+        write_barrier(*this, *property_key.as_symbol());
     return new_shape;
 }
 
 void Shape::add_property_without_transition(StringOrSymbol const& property_key, PropertyAttributes attributes)
 {
     VERIFY(property_key.is_valid());
-    ensure_property_table();
-    if (m_property_table->set(property_key, { m_property_count, attributes }) == AK::HashSetResult::InsertedNewEntry) {
-        VERIFY(m_property_count < NumericLimits<u32>::max());
-        ++m_property_count;
+    ensure_unshared_property_table();
+    if (auto index = m_property_table->index_of(property_key); index.has_value()) {
+        m_property_table->set_metadata(*index, { m_property_count, attributes });
+        return;
     }
+    VERIFY(m_property_count < NumericLimits<u32>::max());
+    m_property_table->append(property_key, { m_property_count, attributes });
+    ++m_property_count;
 }
 
 FLATTEN void Shape::add_property_without_transition(PropertyKey const& property_key, PropertyAttributes attributes)
@@ -301,24 +411,22 @@ FLATTEN void Shape::add_property_without_transition(PropertyKey const& property_
 void Shape::set_property_attributes_without_transition(StringOrSymbol const& property_key, PropertyAttributes attributes)
 {
     VERIFY(is_dictionary());
-    VERIFY(m_property_table);
-    auto it = m_property_table->find(property_key);
-    VERIFY(it != m_property_table->end());
-    it->value.attributes = attributes;
-    m_property_table->set(property_key, it->value);
+    ensure_unshared_property_table();
+    auto index = m_property_table->index_of(property_key);
+    VERIFY(index.has_value());
+    m_property_table->set_attributes(*index, attributes);
 }
 
 void Shape::remove_property_without_transition(StringOrSymbol const& property_key, u32 offset)
 {
     VERIFY(is_uncacheable_dictionary());
-    VERIFY(m_property_table);
-    if (m_property_table->remove(property_key))
-        --m_property_count;
-    for (auto& it : *m_property_table) {
-        VERIFY(it.value.offset != offset);
-        if (it.value.offset > offset)
-            --it.value.offset;
-    }
+    ensure_unshared_property_table();
+    auto index = m_property_table->index_of(property_key);
+    if (!index.has_value())
+        return;
+    VERIFY(m_property_table->at(*index).value.offset == offset);
+    m_property_table->remove(*index);
+    --m_property_count;
 }
 
 NonnullGCPtr<Shape> Shape::create_for_prototype(NonnullGCPtr<Realm> realm, GCPtr<Object> prototype)
@@ -340,13 +448,32 @@ NonnullGCPtr<Shape> Shape::clone_for_prototype()
     new_shape->m_is_prototype_shape = true;
     new_shape->m_prototype = m_prototype;
     ensure_property_table();
-    new_shape->ensure_property_table();
-    (*new_shape->m_property_table) = *m_property_table;
-    new_shape->m_property_count = new_shape->m_property_table->size();
+    new_shape->m_property_table = m_property_table;
+    new_shape->m_property_count = m_property_count;
     new_shape->m_prototype_chain_validity = heap().allocate_without_realm<PrototypeChainValidity>();
     return new_shape;
 }
 
+void Shape::add_to_statistics(ShapeStatistics& statistics, HashTable<PropertyTable const*>& seen_property_tables) const
+{
+    ++statistics.shape_count;
+    if (m_dictionary)
+        ++statistics.dictionary_shape_count;
+    statistics.shape_bytes += sizeof(Shape);
+
+    if (m_property_table && seen_property_tables.set(m_property_table.ptr()) == AK::HashSetResult::InsertedNewEntry) {
+        ++statistics.property_table_count;
+        statistics.property_table_bytes += m_property_table->memory_usage();
+    }
+
+    if (m_forward_transitions)
+        statistics.transition_cache_bytes += hash_map_memory_usage(*m_forward_transitions);
+    if (m_prototype_transitions)
+        statistics.transition_cache_bytes += hash_map_memory_usage(*m_prototype_transitions);
+    if (m_delete_transitions)
+        statistics.transition_cache_bytes += hash_map_memory_usage(*m_delete_transitions);
+}
+
 void Shape::set_prototype_without_transition(Object* new_prototype)
 {
     VERIFY(new_prototype);
@@ -8,6 +8,8 @@
 
 #include <AK/HashMap.h>
 #include <AK/OwnPtr.h>
+#include <AK/RefCounted.h>
+#include <AK/RefPtr.h>
 #include <AK/StringView.h>
 #include <AK/WeakPtr.h>
 #include <AK/Weakable.h>
@@ -24,6 +26,15 @@ struct PropertyMetadata {
     PropertyAttributes attributes { 0 };
 };
 
+struct ShapeStatistics {
+    size_t shape_count { 0 };
+    size_t dictionary_shape_count { 0 };
+    size_t shape_bytes { 0 };
+    size_t property_table_count { 0 };
+    size_t property_table_bytes { 0 };
+    size_t transition_cache_bytes { 0 };
+};
+
 struct TransitionKey {
     StringOrSymbol property_key;
     PropertyAttributes attributes { 0 };
@@ -34,9 +45,87 @@ struct TransitionKey {
     }
 };
 
+// The properties of one or more shapes, in the order they were added.
+// Shapes along a chain of put transitions share a single table, each of them only seeing as many entries as it has
+// properties, so adding a property doesn't copy the ones that came before it. Any other change is made on a copy
+// unless the table is used by one shape only.
+class PropertyTable : public RefCounted<PropertyTable> {
+public:
+    struct Entry {
+        StringOrSymbol key;
+        PropertyMetadata value;
+    };
+
+    static NonnullRefPtr<PropertyTable> create() { return adopt_ref(*new PropertyTable); }
+    NonnullRefPtr<PropertyTable> clone(size_t entry_count) const;
+
+    size_t size() const { return m_entries.size(); }
+    Entry const& at(size_t index) const { return m_entries[index]; }
+    Optional<size_t> index_of(StringOrSymbol const& key) const { return m_indices.get(key); }
+
+    void append(StringOrSymbol const&, PropertyMetadata);
+    void set_attributes(size_t index, PropertyAttributes attributes) { m_entries[index].value.attributes = attributes; }
+    void set_metadata(size_t index, PropertyMetadata metadata) { m_entries[index].value = metadata; }
+    void remove(size_t index);
+
+    size_t memory_usage() const;
+
+private:
+    PropertyTable() = default;
+
+    Vector<Entry> m_entries;
+    HashMap<StringOrSymbol, size_t> m_indices;
+};
+
+// The first `size` entries of a PropertyTable, i.e. the properties of one shape.
+// NOTE: Entries are looked up by index as the view is iterated, so it stays valid when other shapes append to the table.
+class PropertyTableView {
+public:
+    class Iterator {
+    public:
+        Iterator(PropertyTable const& table, size_t index)
+            : m_table(table)
+            , m_index(index)
+        {
+        }
+
+        PropertyTable::Entry const& operator*() const { return m_table.at(m_index); }
+        PropertyTable::Entry const* operator->() const { return &m_table.at(m_index); }
+        Iterator& operator++()
+        {
+            ++m_index;
+            return *this;
+        }
+        bool operator==(Iterator const& other) const { return m_index == other.m_index; }
+
+    private:
+        PropertyTable const& m_table;
+        size_t m_index { 0 };
+    };
+
+    PropertyTableView(NonnullRefPtr<PropertyTable const> table, size_t size)
+        : m_table(move(table))
+        , m_size(size)
+    {
+    }
+
+    Iterator begin() const { return { *m_table, 0 }; }
+    Iterator end() const { return { *m_table, m_size }; }
+
+    size_t size() const { return m_size; }
+    bool is_empty() const { return m_size == 0; }
+
+    Vector<StringOrSymbol> keys() const;
+
+private:
+    NonnullRefPtr<PropertyTable const> m_table;
+    size_t m_size { 0 };
+};
+
 class PrototypeChainValidity final : public Cell {
     JS_CELL(PrototypeChainValidity, Cell);
     JS_DECLARE_ALLOCATOR(PrototypeChainValidity);
+    JS_WRITE_BARRIERED_CELL(PrototypeChainValidity);
 
 public:
     [[nodiscard]] bool is_valid() const { return m_valid; }
@@ -50,6 +139,7 @@ private:
 class Shape final : public Cell {
     JS_CELL(Shape, Cell);
     JS_DECLARE_ALLOCATOR(Shape);
+    JS_WRITE_BARRIERED_CELL(Shape);
 
 public:
     virtual ~Shape() override;
@@ -95,16 +185,15 @@ public:
     Object const* prototype() const { return m_prototype; }
 
     Optional<PropertyMetadata> lookup(StringOrSymbol const&) const;
-    OrderedHashMap<StringOrSymbol, PropertyMetadata> const& property_table() const;
+    PropertyTableView property_table() const;
     u32 property_count() const { return m_property_count; }
 
-    struct Property {
-        StringOrSymbol key;
-        PropertyMetadata value;
-    };
-
     void set_prototype_without_transition(Object* new_prototype);
 
+    // Adds the memory used by this shape, including its property table (unless it is in `seen_property_tables`)
+    // and transition caches, to `statistics`.
+    void add_to_statistics(ShapeStatistics& statistics, HashTable<PropertyTable const*>& seen_property_tables) const;
+
 private:
     explicit Shape(Realm&);
     Shape(Shape& previous_shape, StringOrSymbol const& property_key, PropertyAttributes attributes, TransitionType);
@@ -117,15 +206,21 @@ private:
     virtual void visit_edges(Visitor&) override;
 
     [[nodiscard]] GCPtr<Shape> get_or_prune_cached_forward_transition(TransitionKey const&);
+    void set_cached_forward_transition(TransitionKey const&, Shape&);
     [[nodiscard]] GCPtr<Shape> get_or_prune_cached_prototype_transition(Object* prototype);
     [[nodiscard]] GCPtr<Shape> get_or_prune_cached_delete_transition(StringOrSymbol const&);
 
     void ensure_property_table() const;
+    void ensure_unshared_property_table();
 
     NonnullGCPtr<Realm> m_realm;
 
-    mutable OwnPtr<OrderedHashMap<StringOrSymbol, PropertyMetadata>> m_property_table;
+    mutable RefPtr<PropertyTable> m_property_table;
 
+    // Most shapes only ever get one forward transition, so the first one is kept inline, and the map is only
+    // allocated once there is a second one.
+    TransitionKey m_single_forward_transition_key;
+    WeakPtr<Shape> m_single_forward_transition;
     OwnPtr<HashMap<TransitionKey, WeakPtr<Shape>>> m_forward_transitions;
     OwnPtr<HashMap<GCPtr<Object>, WeakPtr<Shape>>> m_prototype_transitions;
     OwnPtr<HashMap<StringOrSymbol, WeakPtr<Shape>>> m_delete_transitions;
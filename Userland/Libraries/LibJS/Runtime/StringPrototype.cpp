@@ -48,6 +48,14 @@ static ThrowCompletionOr<Utf16String> utf16_string_from(VM& vm)
     return TRY(this_value.to_utf16_string(vm));
 }
 
+// NOTE: Unlike utf16_string_from(), this leaves rope strings unresolved, so that functions which only look at
+//       parts of the string don't have to build all of it.
+static ThrowCompletionOr<NonnullGCPtr<PrimitiveString>> primitive_string_from(VM& vm)
+{
+    auto this_value = TRY(require_object_coercible(vm, vm.this_value()));
+    return TRY(this_value.to_primitive_string(vm));
+}
+
 // 22.1.3.21.1 SplitMatch ( S, q, R ), https://tc39.es/ecma262/#sec-splitmatch
 // FIXME: This no longer exists in the spec!
 static Optional<size_t> split_match(Utf16View const& haystack, size_t start, Utf16View const& needle)
@@ -251,9 +259,9 @@ static ThrowCompletionOr<NonnullGCPtr<PrimitiveString>> this_string_value(VM& vm
 JS_DEFINE_NATIVE_FUNCTION(StringPrototype::at)
 {
     // 1. Let O be ? ToObject(this value).
-    auto string = TRY(utf16_string_from(vm));
+    auto string = TRY(primitive_string_from(vm));
     // 2. Let len be ? LengthOfArrayLike(O).
-    auto length = string.length_in_code_units();
+    auto length = string->length_in_utf16_code_units();
 
     // 3. Let relativeIndex be ? ToIntegerOrInfinity(index).
     auto relative_index = TRY(vm.argument(0).to_integer_or_infinity(vm));
@@ -277,7 +285,7 @@ JS_DEFINE_NATIVE_FUNCTION(StringPrototype::at)
         return js_undefined();
 
     // 7. Return ? Get(O, ! ToString(𝔽(k))).
-    return PrimitiveString::create(vm, Utf16String::create(string.substring_view(index.value(), 1)));
+    return PrimitiveString::create(vm, string->utf16_substring(index.value(), 1));
 }
 
 // 22.1.3.2 String.prototype.charAt ( pos ), https://tc39.es/ecma262/#sec-string.prototype.charat
@@ -285,18 +293,18 @@ JS_DEFINE_NATIVE_FUNCTION(StringPrototype::char_at)
 {
     // 1. Let O be ? RequireObjectCoercible(this value).
     // 2. Let S be ? ToString(O).
-    auto string = TRY(utf16_string_from(vm));
+    auto string = TRY(primitive_string_from(vm));
 
     // 3. Let position be ? ToIntegerOrInfinity(pos).
     auto position = TRY(vm.argument(0).to_integer_or_infinity(vm));
 
     // 4. Let size be the length of S.
     // 5. If position < 0 or position ≥ size, return the empty String.
-    if (position < 0 || position >= string.length_in_code_units())
+    if (position < 0 || position >= string->length_in_utf16_code_units())
         return PrimitiveString::create(vm, String {});
 
     // 6. Return the substring of S from position to position + 1.
-    return PrimitiveString::create(vm, Utf16String::create(string.substring_view(position, 1)));
+    return PrimitiveString::create(vm, string->utf16_substring(position, 1));
 }
 
 // 22.1.3.3 String.prototype.charCodeAt ( pos ), https://tc39.es/ecma262/#sec-string.prototype.charcodeat
@@ -304,18 +312,18 @@ JS_DEFINE_NATIVE_FUNCTION(StringPrototype::char_code_at)
 {
     // 1. Let O be ? RequireObjectCoercible(this value).
     // 2. Let S be ? ToString(O).
-    auto string = TRY(utf16_string_from(vm));
+    auto string = TRY(primitive_string_from(vm));
 
     // 3. Let position be ? ToIntegerOrInfinity(pos).
     auto position = TRY(vm.argument(0).to_integer_or_infinity(vm));
 
     // 4. Let size be the length of S.
     // 5. If position < 0 or position ≥ size, return NaN.
-    if (position < 0 || position >= string.length_in_code_units())
+    if (position < 0 || position >= string->length_in_utf16_code_units())
         return js_nan();
 
     // 6. Return the Number value for the numeric value of the code unit at index position within the String S.
-    return Value(string.code_unit_at(position));
+    return Value(string->utf16_code_unit_at(position));
 }
 
 // 22.1.3.4 String.prototype.codePointAt ( pos ), https://tc39.es/ecma262/#sec-string.prototype.codepointat
@@ -323,18 +331,21 @@ JS_DEFINE_NATIVE_FUNCTION(StringPrototype::code_point_at)
 {
     // 1. Let O be ? RequireObjectCoercible(this value).
     // 2. Let S be ? ToString(O).
-    auto string = TRY(utf16_string_from(vm));
+    auto string = TRY(primitive_string_from(vm));
 
     // 3. Let position be ? ToIntegerOrInfinity(pos).
     auto position = TRY(vm.argument(0).to_integer_or_infinity(vm));
 
     // 4. Let size be the length of S.
     // 5. If position < 0 or position ≥ size, return undefined.
-    if (position < 0 || position >= string.length_in_code_units())
+    auto size = string->length_in_utf16_code_units();
+    if (position < 0 || position >= size)
         return js_undefined();
 
     // 6. Let cp be CodePointAt(S, position).
-    auto code_point = JS::code_point_at(string.view(), position);
+    // NOTE: A code point is at most two code units long, so we only need to look at those.
+    auto code_units = string->utf16_substring(position, min<size_t>(2, size - position));
+    auto code_point = JS::code_point_at(code_units.view(), 0);
 
     // 7. Return 𝔽(cp.[[CodePoint]]).
     return Value(code_point.code_point);
@@ -427,7 +438,7 @@ JS_DEFINE_NATIVE_FUNCTION(StringPrototype::includes)
 
     // 1. Let O be ? RequireObjectCoercible(this value).
     // 2. Let S be ? ToString(O).
-    auto string = TRY(utf16_string_from(vm));
+    auto string = TRY(primitive_string_from(vm));
 
     // 3. Let isRegExp be ? IsRegExp(searchString).
     bool is_regexp = TRY(search_string_value.is_regexp(vm));
@@ -447,11 +458,11 @@ JS_DEFINE_NATIVE_FUNCTION(StringPrototype::includes)
 
         // 8. Let len be the length of S.
         // 9. Let start be the result of clamping pos between 0 and len.
-        start = clamp(pos, static_cast<double>(0), static_cast<double>(string.length_in_code_units()));
+        start = clamp(pos, static_cast<double>(0), static_cast<double>(string->length_in_utf16_code_units()));
     }
 
     // 10. Let index be StringIndexOf(S, searchStr, start).
-    auto index = string_index_of(string.view(), search_string.view(), start);
+    auto index = string->index_of(search_string.view(), start);
 
     // 11. If index ≠ -1, return true.
     // 12. Return false.
@@ -463,14 +474,11 @@ JS_DEFINE_NATIVE_FUNCTION(StringPrototype::index_of)
 {
     // 1. Let O be ? RequireObjectCoercible(this value).
     // 2. Let S be ? ToString(O).
-    auto string = TRY(utf16_string_from(vm));
+    auto string = TRY(primitive_string_from(vm));
 
     // 3. Let searchStr be ? ToString(searchString).
     auto search_string = TRY(vm.argument(0).to_utf16_string(vm));
 
-    auto utf16_string_view = string.view();
-    auto utf16_search_view = search_string.view();
-
     size_t start = 0;
     if (vm.argument_count() > 1) {
         // 4. Let pos be ? ToIntegerOrInfinity(position).
@@ -479,11 +487,11 @@ JS_DEFINE_NATIVE_FUNCTION(StringPrototype::index_of)
 
         // 6. Let len be the length of S.
         // 7. Let start be the result of clamping pos between 0 and len.
-        start = clamp(position, static_cast<double>(0), static_cast<double>(utf16_string_view.length_in_code_units()));
+        start = clamp(position, static_cast<double>(0), static_cast<double>(string->length_in_utf16_code_units()));
     }
 
     // 8. Return 𝔽(StringIndexOf(S, searchStr, start)).
-    auto index = string_index_of(utf16_string_view, utf16_search_view, start);
+    auto index = string->index_of(search_string.view(), start);
     return index.has_value() ? Value(*index) : Value(-1);
 }
 
@@ -1018,10 +1026,10 @@ JS_DEFINE_NATIVE_FUNCTION(StringPrototype::slice)
 
     // 1. Let O be ? RequireObjectCoercible(this value).
     // 2. Let S be ? ToString(O).
-    auto string = TRY(utf16_string_from(vm));
+    auto string = TRY(primitive_string_from(vm));
 
     // 3. Let len be the length of S.
-    auto string_length = static_cast<double>(string.length_in_code_units());
+    auto string_length = static_cast<double>(string->length_in_utf16_code_units());
 
     // 4. Let intStart be ? ToIntegerOrInfinity(start).
     auto int_start = TRY(start.to_integer_or_infinity(vm));
@@ -1055,8 +1063,12 @@ JS_DEFINE_NATIVE_FUNCTION(StringPrototype::slice)
     if (int_start >= int_end)
         return PrimitiveString::create(vm, String {});
 
+    // OPTIMIZATION: Slicing out the entire string gives us the same string.
+    if (int_start == 0 && int_end == string_length)
+        return string;
+
     // 13. Return the substring of S from from to to.
-    return PrimitiveString::create(vm, Utf16String::create(string.substring_view(int_start, int_end - int_start)));
+    return PrimitiveString::create(vm, string->utf16_substring(int_start, int_end - int_start));
 }
 
 // 22.1.3.23 String.prototype.split ( separator, limit ), https://tc39.es/ecma262/#sec-string.prototype.split
@@ -1221,10 +1233,10 @@ JS_DEFINE_NATIVE_FUNCTION(StringPrototype::substring)
 {
     // 1. Let O be ? RequireObjectCoercible(this value).
     // 2. Let S be ? ToString(O).
-    auto string = TRY(utf16_string_from(vm));
+    auto string = TRY(primitive_string_from(vm));
 
     // 3. Let len be the length of S.
-    auto string_length = static_cast<double>(string.length_in_code_units());
+    auto string_length = static_cast<double>(string->length_in_utf16_code_units());
 
     // 4. Let intStart be ? ToIntegerOrInfinity(start).
     auto start = TRY(vm.argument(0).to_integer_or_infinity(vm));
@@ -1246,8 +1258,12 @@ JS_DEFINE_NATIVE_FUNCTION(StringPrototype::substring)
     // 9. Let to be max(finalStart, finalEnd).
     size_t to = max(final_start, final_end);
 
+    // OPTIMIZATION: Taking the entire string gives us the same string.
+    if (from == 0 && to == string_length)
+        return string;
+
     // 10. Return the substring of S from from to to.
-    return PrimitiveString::create(vm, Utf16String::create(string.substring_view(from, to - from)));
+    return PrimitiveString::create(vm, string->utf16_substring(from, to - from));
 }
 
 enum class TargetCase {
@@ -1485,10 +1501,10 @@ JS_DEFINE_NATIVE_FUNCTION(StringPrototype::substr)
 {
     // 1. Let O be ? RequireObjectCoercible(this value).
     // 2. Let S be ? ToString(O).
-    auto string = TRY(utf16_string_from(vm));
+    auto string = TRY(primitive_string_from(vm));
 
     // 3. Let size be the length of S.
-    auto size = string.length_in_code_units();
+    auto size = string->length_in_utf16_code_units();
 
     // 4. Let intStart be ? ToIntegerOrInfinity(start).
     auto int_start = TRY(vm.argument(0).to_integer_or_infinity(vm));
@@ -1517,7 +1533,7 @@ JS_DEFINE_NATIVE_FUNCTION(StringPrototype::substr)
         return PrimitiveString::create(vm, String {});
 
     // 11. Return the substring of S from intStart to intEnd.
-    return PrimitiveString::create(vm, Utf16String::create(string.substring_view(int_start, int_end - int_start)));
+    return PrimitiveString::create(vm, string->utf16_substring(int_start, int_end - int_start));
 }
 
 // B.2.2.2.1 CreateHTML ( string, tag, attribute, value ), https://tc39.es/ecma262/#sec-createhtml
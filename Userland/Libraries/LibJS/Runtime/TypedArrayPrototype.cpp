@@ -6,6 +6,10 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/Array.h>
+#include <AK/InsertionSort.h>
+#include <AK/SIMD.h>
+#include <AK/SIMDExtras.h>
 #include <AK/TypeCasts.h>
 #include <LibJS/Runtime/AbstractOperations.h>
 #include <LibJS/Runtime/Array.h>
@@ -469,32 +473,384 @@ JS_DEFINE_NATIVE_FUNCTION(TypedArrayPrototype::every)
     return true;
 }
 
-// NOTE: This function assumes that the index is valid within the TypedArray,
-//       and that the TypedArray is not detached.
+// Returns the elements of a typed array as they are laid out in its buffer, so that bulk operations don't have to go
+// through a Value for each of them. Returns nothing if the elements can't be accessed that way, in which case the
+// caller should follow the spec steps instead.
+// NOTE: We don't look inside resizable or shared buffers, as their length (or contents) may change underneath us.
 template<typename T>
-inline void fast_typed_array_fill(TypedArrayBase& typed_array, u32 begin, u32 end, T value)
+static Optional<Span<T>> raw_typed_array_elements(TypedArrayBase& typed_array, u32 length)
 {
-    Checked<size_t> computed_begin = begin;
-    computed_begin *= sizeof(T);
-    computed_begin += typed_array.byte_offset();
+    auto& array_buffer = *typed_array.viewed_array_buffer();
+    if (array_buffer.is_detached() || !array_buffer.is_fixed_length() || array_buffer.is_shared_array_buffer())
+        return {};
 
-    Checked<size_t> computed_end = end;
-    computed_end *= sizeof(T);
-    computed_end += typed_array.byte_offset();
+    Checked<size_t> byte_end = length;
+    byte_end *= sizeof(T);
+    byte_end += typed_array.byte_offset();
+    if (byte_end.has_overflow() || byte_end.value() > array_buffer.byte_length()) [[unlikely]]
+        return {};
 
-    if (computed_begin.has_overflow() || computed_end.has_overflow()) [[unlikely]] {
-        return;
+    return Span<T> { reinterpret_cast<T*>(array_buffer.buffer().offset_pointer(typed_array.byte_offset())), length };
+}
+
+// The in-memory representation of a TypedArray element type.
+template<typename T>
+using TypedArrayStorageType = Conditional<IsSame<T, ClampedU8>, u8, T>;
+
+template<typename T>
+struct TypedArraySearchVector;
+
+template<>
+struct TypedArraySearchVector<u8> {
+    using Type = AK::SIMD::u8x16;
+};
+
+template<>
+struct TypedArraySearchVector<i8> {
+    using Type = AK::SIMD::i8x16;
+};
+
+template<>
+struct TypedArraySearchVector<u16> {
+    using Type = AK::SIMD::u16x8;
+};
+
+template<>
+struct TypedArraySearchVector<i16> {
+    using Type = AK::SIMD::i16x8;
+};
+
+template<>
+struct TypedArraySearchVector<u32> {
+    using Type = AK::SIMD::u32x4;
+};
+
+template<>
+struct TypedArraySearchVector<i32> {
+    using Type = AK::SIMD::i32x4;
+};
+
+template<>
+struct TypedArraySearchVector<float> {
+    using Type = AK::SIMD::f32x4;
+};
+
+template<>
+struct TypedArraySearchVector<double> {
+    using Type = AK::SIMD::f64x2;
+};
+
+template<typename T>
+static constexpr bool is_vector_search_supported = IsOneOf<T, u8, i8, u16, i16, u32, i32, float, double>;
+
+template<AK::SIMD::SIMDVector Mask>
+ALWAYS_INLINE static bool any_lane_set(Mask mask)
+{
+    static_assert(sizeof(Mask) == sizeof(AK::SIMD::u64x2));
+    auto bits = bit_cast<AK::SIMD::u64x2>(mask);
+    return (bits[0] | bits[1]) != 0;
+}
+
+// Converts a number that is being searched for to the element type of a typed array. Returns nothing if no element
+// of that type can be equal to it, in which case there is no need to look at the elements at all.
+template<typename T>
+static Optional<T> typed_array_search_needle(double number)
+{
+    if constexpr (IsFloatingPoint<T>) {
+        if (isnan(number) || isinf(number))
+            return static_cast<T>(number);
+        if (fabs(number) > static_cast<double>(NumericLimits<T>::max()))
+            return {};
+        auto needle = static_cast<T>(number);
+        if (static_cast<double>(needle) != number)
+            return {};
+        return needle;
+    } else {
+        // NOTE: Comparisons against NaN are false, so this also rejects NaN.
+        if (!(number >= static_cast<double>(NumericLimits<T>::min()) && number <= static_cast<double>(NumericLimits<T>::max())))
+            return {};
+        if (trunc(number) != number)
+            return {};
+        return static_cast<T>(number);
+    }
+}
+
+// Finds the first element at or after `start` that is equal to `needle`, or that is NaN if `needle` is NaN.
+template<typename T>
+static Optional<size_t> find_first_typed_array_element(ReadonlySpan<T> elements, size_t start, T needle)
+{
+    using Vector = typename TypedArraySearchVector<T>::Type;
+    static constexpr size_t lanes = AK::SIMD::vector_length<Vector>;
+
+    bool searching_for_nan = false;
+    if constexpr (IsFloatingPoint<T>)
+        searching_for_nan = isnan(needle);
+
+    auto index = start;
+    for (; index + lanes <= elements.size(); index += lanes) {
+        auto chunk = AK::SIMD::load_unaligned<Vector>(elements.data() + index);
+        if (searching_for_nan ? any_lane_set(chunk != chunk) : any_lane_set(chunk == needle))
+            break;
+    }
+
+    for (; index < elements.size(); ++index) {
+        auto element = elements[index];
+        if (searching_for_nan ? element != element : element == needle)
+            return index;
+    }
+    return {};
+}
+
+// Finds the last element before `end` that is equal to `needle`.
+template<typename T>
+static Optional<size_t> find_last_typed_array_element(ReadonlySpan<T> elements, size_t end, T needle)
+{
+    using Vector = typename TypedArraySearchVector<T>::Type;
+    static constexpr size_t lanes = AK::SIMD::vector_length<Vector>;
+
+    auto index = end;
+    for (; index >= lanes; index -= lanes) {
+        auto chunk = AK::SIMD::load_unaligned<Vector>(elements.data() + index - lanes);
+        if (any_lane_set(chunk == needle))
+            break;
+    }
+
+    while (index > 0) {
+        --index;
+        if (elements[index] == needle)
+            return index;
+    }
+    return {};
+}
+
+enum class SearchDirection {
+    Forward,
+    Backward,
+};
+
+// Looks for a number in a typed array without creating a Value for each element. For forward searches, `from` is the
+// first index to look at; for backward searches, it's one past the last one. Returns nothing if the elements can't be
+// searched this way, and -1 if the number isn't found.
+// NOTE: NaN is only found when `find_nan` is true, as SameValueZero treats it as equal to itself but IsStrictlyEqual doesn't.
+static Optional<i64> fast_typed_array_search(TypedArrayBase& typed_array, u32 length, Value search_element, u32 from, SearchDirection direction, bool find_nan)
+{
+    if (typed_array.content_type() != TypedArrayBase::ContentType::Number)
+        return {};
+
+    auto search = [&]<typename T>() -> Optional<i64> {
+        using StorageType = TypedArrayStorageType<T>;
+        if constexpr (!is_vector_search_supported<StorageType>) {
+            return {};
+        } else {
+            auto elements = raw_typed_array_elements<StorageType>(typed_array, length);
+            if (!elements.has_value())
+                return {};
+
+            // Elements are always Numbers, so nothing else is equal to any of them.
+            if (!search_element.is_number() || (search_element.is_nan() && !find_nan))
+                return -1;
+
+            auto needle = typed_array_search_needle<StorageType>(search_element.as_double());
+            if (!needle.has_value())
+                return -1;
+
+            auto index = direction == SearchDirection::Forward
+                ? find_first_typed_array_element<StorageType>(*elements, from, *needle)
+                : find_last_typed_array_element<StorageType>(*elements, from, *needle);
+            return index.has_value() ? static_cast<i64>(*index) : -1;
+        }
+    };
+
+    switch (typed_array.kind()) {
+#define __JS_ENUMERATE(ClassName, snake_name, PrototypeName, ConstructorName, Type) \
+    case TypedArrayBase::Kind::ClassName:                                           \
+        return search.template operator()<Type>();
+        JS_ENUMERATE_TYPED_ARRAYS
+#undef __JS_ENUMERATE
+    }
+    VERIFY_NOT_REACHED();
+}
+
+// Sets every element in [begin, end) to the given number, converting it to the element type only once.
+// Returns false if the elements can't be accessed directly.
+static bool fast_typed_array_fill(VM& vm, TypedArrayBase& typed_array, u32 length, u32 begin, u32 end, Value value)
+{
+    auto fill = [&]<typename T>() {
+        using StorageType = TypedArrayStorageType<T>;
+        auto elements = raw_typed_array_elements<StorageType>(typed_array, length);
+        if (!elements.has_value())
+            return false;
+
+        StorageType raw_value;
+        numeric_to_raw_bytes<T>(vm, value, true, { &raw_value, sizeof(raw_value) });
+
+        auto range = elements->slice(begin, end - begin);
+        if constexpr (sizeof(StorageType) == 1)
+            __builtin_memset(range.data(), raw_value, range.size());
+        else
+            range.fill(raw_value);
+        return true;
+    };
+
+    switch (typed_array.kind()) {
+#define __JS_ENUMERATE(ClassName, snake_name, PrototypeName, ConstructorName, Type) \
+    case TypedArrayBase::Kind::ClassName:                                           \
+        return fill.template operator()<Type>();
+        JS_ENUMERATE_TYPED_ARRAYS
+#undef __JS_ENUMERATE
+    }
+    VERIFY_NOT_REACHED();
+}
+
+// Reverses the elements of a typed array in place. Returns false if the elements can't be accessed directly.
+static bool fast_typed_array_reverse(TypedArrayBase& typed_array, u32 length)
+{
+    auto reverse = [&]<typename T>() {
+        auto elements = raw_typed_array_elements<T>(typed_array, length);
+        if (!elements.has_value())
+            return false;
+
+        // NOTE: Only the bit patterns are moved around, so the element type doesn't matter beyond its size.
+        for (size_t lower = 0, upper = length; lower + 1 < upper; ++lower, --upper)
+            swap((*elements)[lower], (*elements)[upper - 1]);
+        return true;
+    };
+
+    switch (typed_array.element_size()) {
+    case 1:
+        return reverse.template operator()<u8>();
+    case 2:
+        return reverse.template operator()<u16>();
+    case 4:
+        return reverse.template operator()<u32>();
+    case 8:
+        return reverse.template operator()<u64>();
+    default:
+        VERIFY_NOT_REACHED();
+    }
+}
+
+template<typename T>
+struct TypedArraySortKey {
+    using Type = MakeUnsigned<T>;
+};
+
+template<>
+struct TypedArraySortKey<float> {
+    using Type = u32;
+};
+
+template<>
+struct TypedArraySortKey<double> {
+    using Type = u64;
+};
+
+// Maps elements to unsigned integers of the same size that are ordered the way CompareTypedArrayElements orders the
+// elements themselves: numerically, with -0 before +0, and NaN after everything else.
+template<typename T>
+static typename TypedArraySortKey<T>::Type to_sort_key(T element)
+{
+    using Key = typename TypedArraySortKey<T>::Type;
+    static constexpr Key sign_bit = Key { 1 } << (sizeof(Key) * 8 - 1);
+
+    if constexpr (IsFloatingPoint<T>) {
+        if (isnan(element))
+            return NumericLimits<Key>::max();
+        auto bits = bit_cast<Key>(element);
+        return (bits & sign_bit) ? static_cast<Key>(~bits) : static_cast<Key>(bits | sign_bit);
+    } else if constexpr (IsSigned<T>) {
+        return static_cast<Key>(bit_cast<Key>(element) ^ sign_bit);
+    } else {
+        return element;
+    }
+}
+
+template<typename T>
+static T from_sort_key(typename TypedArraySortKey<T>::Type key)
+{
+    using Key = typename TypedArraySortKey<T>::Type;
+    static constexpr Key sign_bit = Key { 1 } << (sizeof(Key) * 8 - 1);
+
+    if constexpr (IsFloatingPoint<T>) {
+        return bit_cast<T>((key & sign_bit) ? static_cast<Key>(key & ~sign_bit) : static_cast<Key>(~key));
+    } else if constexpr (IsSigned<T>) {
+        return bit_cast<T>(static_cast<Key>(key ^ sign_bit));
+    } else {
+        return key;
     }
+}
 
-    if (computed_begin.value() >= typed_array.viewed_array_buffer()->byte_length()
-        || computed_end.value() > typed_array.viewed_array_buffer()->byte_length()) [[unlikely]] {
+// A least significant digit first radix sort, one byte at a time.
+template<typename Key>
+static void radix_sort(Span<Key> keys)
+{
+    static constexpr size_t insertion_sort_threshold = 64;
+    if (keys.size() <= insertion_sort_threshold) {
+        insertion_sort(keys);
         return;
     }
 
-    auto& array_buffer = *typed_array.viewed_array_buffer();
-    auto* slot = reinterpret_cast<T*>(array_buffer.buffer().offset_pointer(computed_begin.value()));
-    for (auto i = begin; i < end; ++i)
-        *(slot++) = value;
+    Vector<Key> scratch;
+    scratch.resize(keys.size());
+
+    auto source = keys;
+    auto destination = scratch.span();
+    for (size_t shift = 0; shift < sizeof(Key) * 8; shift += 8) {
+        AK::Array<size_t, 256> offsets {};
+        for (auto key : source)
+            ++offsets[(key >> shift) & 0xff];
+
+        // If every key has the same digit here, this pass wouldn't move anything.
+        if (offsets[(source[0] >> shift) & 0xff] == source.size())
+            continue;
+
+        size_t offset = 0;
+        for (auto& count : offsets)
+            offset += exchange(count, offset);
+
+        for (auto key : source)
+            destination[offsets[(key >> shift) & 0xff]++] = key;
+        swap(source, destination);
+    }
+
+    if (source.data() != keys.data())
+        source.copy_to(keys);
+}
+
+// Sorts the elements of `source` into `target` (which may be the same typed array) in the order that sort() without
+// a comparator puts them in. Returns false if the elements can't be accessed directly.
+static bool fast_typed_array_sort(TypedArrayBase& source, TypedArrayBase& target, u32 length)
+{
+    auto sort = [&]<typename T>() {
+        using StorageType = TypedArrayStorageType<T>;
+        using Key = typename TypedArraySortKey<StorageType>::Type;
+
+        auto source_elements = raw_typed_array_elements<StorageType>(source, length);
+        auto target_elements = raw_typed_array_elements<StorageType>(target, length);
+        if (!source_elements.has_value() || !target_elements.has_value())
+            return false;
+
+        // NOTE: Keys are the same size as the elements, so they are sorted right in the target's buffer.
+        auto keys = Span<Key> { reinterpret_cast<Key*>(target_elements->data()), length };
+        for (size_t i = 0; i < length; ++i)
+            keys[i] = to_sort_key((*source_elements)[i]);
+
+        radix_sort(keys);
+
+        for (size_t i = 0; i < length; ++i)
+            (*target_elements)[i] = from_sort_key<StorageType>(keys[i]);
+        return true;
+    };
+
+    VERIFY(source.kind() == target.kind());
+    switch (source.kind()) {
+#define __JS_ENUMERATE(ClassName, snake_name, PrototypeName, ConstructorName, Type) \
+    case TypedArrayBase::Kind::ClassName:                                           \
+        return sort.template operator()<Type>();
+        JS_ENUMERATE_TYPED_ARRAYS
+#undef __JS_ENUMERATE
+    }
+    VERIFY_NOT_REACHED();
 }
 
 // 23.2.3.9 %TypedArray%.prototype.fill ( value [ , start [ , end ] ] ), https://tc39.es/ecma262/#sec-%typedarray%.prototype.fill
@@ -565,34 +921,8 @@ JS_DEFINE_NATIVE_FUNCTION(TypedArrayPrototype::fill)
     // 17. Set final to min(final, len).
     final = min(final, length);
 
-    if (value.is_int32()) {
-        switch (typed_array->kind()) {
-        case TypedArrayBase::Kind::Uint8Array:
-            fast_typed_array_fill<u8>(*typed_array, k, final, static_cast<u8>(value.as_i32()));
-            return typed_array;
-        case TypedArrayBase::Kind::Uint16Array:
-            fast_typed_array_fill<u16>(*typed_array, k, final, static_cast<u16>(value.as_i32()));
-            return typed_array;
-        case TypedArrayBase::Kind::Uint32Array:
-            fast_typed_array_fill<u32>(*typed_array, k, final, static_cast<u32>(value.as_i32()));
-            return typed_array;
-        case TypedArrayBase::Kind::Int8Array:
-            fast_typed_array_fill<i8>(*typed_array, k, final, static_cast<i8>(value.as_i32()));
-            return typed_array;
-        case TypedArrayBase::Kind::Int16Array:
-            fast_typed_array_fill<i16>(*typed_array, k, final, static_cast<i16>(value.as_i32()));
-            return typed_array;
-        case TypedArrayBase::Kind::Int32Array:
-            fast_typed_array_fill<i32>(*typed_array, k, final, value.as_i32());
-            return typed_array;
-        case TypedArrayBase::Kind::Uint8ClampedArray:
-            fast_typed_array_fill<u8>(*typed_array, k, final, clamp(value.as_i32(), 0, 255));
-            return typed_array;
-        default:
-            // FIXME: Support more TypedArray kinds.
-            break;
-        }
-    }
+    if (k < final && fast_typed_array_fill(vm, *typed_array, length, k, final, value))
+        return typed_array;
 
     // 18. Repeat, while k < final,
     while (k < final) {
@@ -917,6 +1247,9 @@ JS_DEFINE_NATIVE_FUNCTION(TypedArrayPrototype::includes)
         k = relative_k;
     }
 
+    if (auto index = fast_typed_array_search(*typed_array, length, search_element, min(k, length), SearchDirection::Forward, true); index.has_value())
+        return Value { *index != -1 };
+
     // 11. Repeat, while k < len,
     while (k < length) {
         // a. Let elementK be ! Get(O, ! ToString(𝔽(k))).
@@ -986,6 +1319,9 @@ JS_DEFINE_NATIVE_FUNCTION(TypedArrayPrototype::index_of)
         k = relative_k;
     }
 
+    if (auto index = fast_typed_array_search(*typed_array, length, search_element, min(k, length), SearchDirection::Forward, false); index.has_value())
+        return Value { static_cast<double>(*index) };
+
     // 11. Repeat, while k < len,
     while (k < length) {
         // a. Let kPresent be ! HasProperty(O, ! ToString(𝔽(k))).
@@ -1123,6 +1459,11 @@ JS_DEFINE_NATIVE_FUNCTION(TypedArrayPrototype::last_index_of)
         k = relative_k;
     }
 
+    if (k >= 0) {
+        if (auto index = fast_typed_array_search(*typed_array, length, search_element, k + 1, SearchDirection::Backward, false); index.has_value())
+            return Value { static_cast<double>(*index) };
+    }
+
     // 9. Repeat, while k ≥ 0,
     while (k >= 0) {
         // a. Let kPresent be ! HasProperty(O, ! ToString(𝔽(k))).
@@ -1350,6 +1691,9 @@ JS_DEFINE_NATIVE_FUNCTION(TypedArrayPrototype::reverse)
     // 3. Let len be TypedArrayLength(taRecord).
     auto length = typed_array_length(typed_array_record);
 
+    if (fast_typed_array_reverse(*typed_array, length))
+        return typed_array;
+
     // 4. Let middle be floor(len / 2).
     auto middle = length / 2;
 
@@ -1722,6 +2066,12 @@ JS_DEFINE_NATIVE_FUNCTION(TypedArrayPrototype::slice)
                 return array;
             }
 
+            // NOTE: Unless A is a view of the same buffer (which a species constructor could arrange), the copy is just a memcpy.
+            if (&source_buffer != &target_buffer && !source_buffer.is_shared_array_buffer() && !target_buffer.is_shared_array_buffer()) {
+                target_buffer.buffer().overwrite(target_byte_index, source_buffer.buffer().offset_pointer(source_byte_index.value()), limit.value() - target_byte_index);
+                return array;
+            }
+
             // ix. Repeat, while targetByteIndex < limit,
             while (target_byte_index < limit) {
                 // 1. Let value be GetValueFromBuffer(srcBuffer, srcByteIndex, uint8, true, unordered).
@@ -1824,6 +2174,9 @@ JS_DEFINE_NATIVE_FUNCTION(TypedArrayPrototype::sort)
     // 4. Let len be TypedArrayLength(taRecord).
     auto length = typed_array_length(typed_array_record);
 
+    if (compare_function.is_undefined() && fast_typed_array_sort(*typed_array, *typed_array, length))
+        return typed_array;
+
     // 5. NOTE: The following closure performs a numeric comparison rather than the string comparison used in 23.1.3.30.
     // 6. Let SortCompare be a new Abstract Closure with parameters (x, y) that captures comparefn and performs the following steps when called:
     Function<ThrowCompletionOr<double>(Value, Value)> sort_compare = [&](auto x, auto y) -> ThrowCompletionOr<double> {
@@ -2062,6 +2415,9 @@ JS_DEFINE_NATIVE_FUNCTION(TypedArrayPrototype::to_sorted)
     arguments.empend(length);
     auto* array = TRY(typed_array_create_same_type(vm, *typed_array, move(arguments)));
 
+    if (compare_function.is_undefined() && fast_typed_array_sort(*typed_array, *array, length))
+        return array;
+
     // 6. NOTE: The following closure performs a numeric comparison rather than the string comparison used in 23.1.3.34.
     Function<ThrowCompletionOr<double>(Value, Value)> sort_compare = [&](auto x, auto y) -> ThrowCompletionOr<double> {
         // a. Return ? CompareTypedArrayElements(x, y, comparefn).
@@ -28,6 +28,7 @@
 #include <LibJS/Runtime/NativeFunction.h>
 #include <LibJS/Runtime/PromiseCapability.h>
 #include <LibJS/Runtime/Reference.h>
+#include <LibJS/Runtime/SamplingProfiler.h>
 #include <LibJS/Runtime/Symbol.h>
 #include <LibJS/Runtime/VM.h>
 #include <LibJS/SourceTextModule.h>
@@ -743,6 +744,16 @@ static Optional<UnrealizedSourceRange> get_source_range(ExecutionContext const*
     return context->executable->source_range_at(context->program_counter.value());
 }
 
+void VM::start_sampling_profiler(AK::Duration interval)
+{
+    m_sampling_profiler = SamplingProfiler::create(*this, interval);
+}
+
+OwnPtr<SamplingProfiler> VM::stop_sampling_profiler()
+{
+    return move(m_sampling_profiler);
+}
+
 Vector<StackTraceElement> VM::stack_trace() const
 {
     Vector<StackTraceElement> stack_trace;
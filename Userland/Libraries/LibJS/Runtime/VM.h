@@ -14,6 +14,7 @@
 #include <AK/HashMap.h>
 #include <AK/RefCounted.h>
 #include <AK/StackInfo.h>
+#include <AK/Time.h>
 #include <AK/Variant.h>
 #include <LibJS/CyclicModule.h>
 #include <LibJS/Heap/Heap.h>
@@ -278,6 +279,12 @@ public:
 
     Vector<StackTraceElement> stack_trace() const;
 
+    // Starts recording where JavaScript code spends its time, see SamplingProfiler.
+    void start_sampling_profiler(AK::Duration interval);
+    // Stops recording, and hands over the samples taken so far.
+    OwnPtr<SamplingProfiler> stop_sampling_profiler();
+    SamplingProfiler* sampling_profiler() { return m_sampling_profiler.ptr(); }
+
 private:
     using ErrorMessages = AK::Array<String, to_underlying(ErrorMessage::__Count)>;
 
@@ -337,6 +344,8 @@ private:
 
     OwnPtr<Bytecode::Interpreter> m_bytecode_interpreter;
 
+    OwnPtr<SamplingProfiler> m_sampling_profiler;
+
     bool m_dynamic_imports_allowed { false };
 };
 
@@ -18,6 +18,7 @@
 #include <AK/String.h>
 #include <AK/Types.h>
 #include <LibJS/Forward.h>
+#include <LibJS/Heap/Cell.h>
 #include <LibJS/Heap/GCPtr.h>
 #include <math.h>
 
@@ -592,6 +593,13 @@ double string_to_number(StringView);
 
 inline bool Value::operator==(Value const& value) const { return same_value(*this, value); }
 
+// Write barrier for Value stores, see write_barrier(Cell const&, Cell const&).
+ALWAYS_INLINE void write_barrier(Cell const& owner, Value value)
+{
+    if (value.is_cell())
+        write_barrier(owner, value.as_cell());
+}
+
 }
 
 namespace AK {
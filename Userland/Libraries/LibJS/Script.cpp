@@ -5,6 +5,8 @@
  */
 
 #include <LibJS/AST.h>
+#include <LibJS/Bytecode/Executable.h>
+#include <LibJS/Bytecode/ExecutableCache.h>
 #include <LibJS/Lexer.h>
 #include <LibJS/Parser.h>
 #include <LibJS/Runtime/VM.h>
@@ -25,8 +27,16 @@ Result<NonnullGCPtr<Script>, Vector<ParserError>> Script::parse(StringView sourc
     if (parser.has_errors())
         return parser.errors();
 
+    // OPTIMIZATION: If this script has been run before, its bytecode may be in the bytecode cache, in which case we don't
+    //               have to generate it again when the script is run.
+    auto bytecode_cache_key = Bytecode::ExecutableCache::key_for(*script);
+    auto cached_executable = Bytecode::ExecutableCache::load(realm.vm(), *script, bytecode_cache_key);
+
     // 3. Return Script Record { [[Realm]]: realm, [[ECMAScriptCode]]: script, [[HostDefined]]: hostDefined }.
-    return realm.heap().allocate_without_realm<Script>(realm, filename, move(script), host_defined);
+    auto script_record = realm.heap().allocate_without_realm<Script>(realm, filename, move(script), host_defined);
+    script_record->m_cached_executable = cached_executable;
+    script_record->m_bytecode_cache_key = move(bytecode_cache_key);
+    return script_record;
 }
 
 Script::Script(Realm& realm, StringView filename, NonnullRefPtr<Program> parse_node, HostDefined* host_defined)
@@ -45,6 +55,7 @@ void Script::visit_edges(Cell::Visitor& visitor)
 {
     Base::visit_edges(visitor);
     visitor.visit(m_realm);
+    visitor.visit(m_cached_executable);
     if (m_host_defined)
         m_host_defined->visit_host_defined_self(visitor);
     for (auto const& loaded_module : m_loaded_modules)
@@ -37,6 +37,12 @@ public:
     HostDefined* host_defined() const { return m_host_defined; }
     StringView filename() const { return m_filename; }
 
+    // Non-standard: Bytecode for this script that was found in the bytecode cache while parsing, if any.
+    GCPtr<Bytecode::Executable> take_cached_executable() { return exchange(m_cached_executable, nullptr); }
+
+    // Non-standard: Identifies this script's source text in the bytecode cache. Empty if the cache is disabled.
+    StringView bytecode_cache_key() const { return m_bytecode_cache_key; }
+
 private:
     Script(Realm&, StringView filename, NonnullRefPtr<Program>, HostDefined* = nullptr);
 
@@ -49,6 +55,9 @@ private:
     // Needed for potential lookups of modules.
     ByteString m_filename;
     HostDefined* m_host_defined { nullptr }; // [[HostDefined]]
+
+    GCPtr<Bytecode::Executable> m_cached_executable;
+    ByteString m_bytecode_cache_key;
 };
 
 }
@@ -0,0 +1,117 @@
+describe("element kind transitions", () => {
+    test("int32 elements widen to doubles and then to anything", () => {
+        const a = [1, 2, 3];
+        a.push(4.5);
+        expect(a).toEqual([1, 2, 3, 4.5]);
+        a[1] = -0;
+        expect(Object.is(a[1], -0)).toBeTrue();
+        a.push("five");
+        expect(a).toEqual([1, -0, 3, 4.5, "five"]);
+        a[0] = NaN;
+        expect(a[0]).toBeNaN();
+    });
+
+    test("holes are preserved across transitions", () => {
+        const a = [1, 2, 3];
+        a[5] = 6;
+        expect(a).toHaveLength(6);
+        expect(3 in a).toBeFalse();
+        expect(a[3]).toBeUndefined();
+        a[4] = "x";
+        expect(3 in a).toBeFalse();
+        expect(Object.keys(a)).toEqual(["0", "1", "2", "4", "5"]);
+    });
+
+    test("delete and length changes", () => {
+        const a = [1, 2, 3, 4];
+        delete a[1];
+        expect(1 in a).toBeFalse();
+        expect(a).toHaveLength(4);
+        a.length = 2;
+        expect(a).toHaveLength(2);
+        expect(a[0]).toBe(1);
+        a.length = 4;
+        expect(2 in a).toBeFalse();
+        expect(a[3]).toBeUndefined();
+        expect(a.shift()).toBe(1);
+        expect(a.pop()).toBeUndefined();
+        expect(a).toHaveLength(2);
+    });
+
+    test("NaN elements are distinct from holes", () => {
+        const a = [0.5, NaN];
+        a.length = 3;
+        expect(a.includes(NaN)).toBeTrue();
+        expect(a.indexOf(NaN)).toBe(-1);
+        expect(a.includes(undefined)).toBeTrue();
+        expect(a.indexOf(undefined)).toBe(-1);
+    });
+});
+
+describe("fast paths match the generic algorithms", () => {
+    test("indexOf and includes", () => {
+        const ints = [1, 2, 3];
+        expect(ints.indexOf(2)).toBe(1);
+        expect(ints.indexOf(2.0)).toBe(1);
+        expect(ints.indexOf("2")).toBe(-1);
+        expect(ints.includes(3, -1)).toBeTrue();
+        expect(ints.includes(1, 1)).toBeFalse();
+
+        const doubles = [0, 1.5, -0];
+        expect(doubles.indexOf(-0)).toBe(0);
+        expect(doubles.indexOf(1.5)).toBe(1);
+        expect(doubles.includes(0, 1)).toBeTrue();
+
+        const objects = [{}, "a", 1n];
+        expect(objects.indexOf("a")).toBe(1);
+        expect(objects.includes(1n)).toBeTrue();
+    });
+
+    test("holes are looked up on the prototype chain", () => {
+        const a = [1, 2, 3];
+        delete a[1];
+        Array.prototype[1] = "from prototype";
+        try {
+            expect(a.indexOf("from prototype")).toBe(1);
+            expect(a.includes("from prototype")).toBeTrue();
+            a.push(4);
+            expect(a).toHaveLength(4);
+        } finally {
+            delete Array.prototype[1];
+        }
+    });
+
+    test("push respects setters on the prototype chain", () => {
+        const a = [1];
+        let setterValue;
+        Object.defineProperty(Array.prototype, 1, {
+            set(value) {
+                setterValue = value;
+            },
+            configurable: true,
+        });
+        try {
+            expect(a.push(2)).toBe(2);
+            expect(setterValue).toBe(2);
+            expect(Object.hasOwn(a, 1)).toBeFalse();
+        } finally {
+            delete Array.prototype[1];
+        }
+    });
+
+    test("push on frozen and non-extensible arrays", () => {
+        expect(() => Object.freeze([1]).push(2)).toThrow(TypeError);
+        expect(() => Object.preventExtensions([1]).push(2)).toThrow(TypeError);
+    });
+
+    test("fill", () => {
+        const a = [1, 2, 3, 4];
+        expect(a.fill(0.5, 1, 3)).toEqual([1, 0.5, 0.5, 4]);
+        expect(a.fill("x", -1)).toEqual([1, 0.5, 0.5, "x"]);
+
+        const holey = [1, 2, 3];
+        delete holey[1];
+        holey.fill(7);
+        expect(holey).toEqual([7, 7, 7]);
+    });
+});
@@ -74,3 +74,94 @@ test("does not truncate large integers", () => {
     expect(JSON.parse("18446744073709551616")).toEqual(18446744073709551616);
     expect(JSON.parse("18446744073709551617")).toEqual(18446744073709551617);
 });
+
+test("more syntax errors", () => {
+    [
+        "01",
+        "-",
+        "1.",
+        ".5",
+        "1e",
+        "1e+",
+        "+1",
+        '"unterminated',
+        '"\\x"',
+        '"\\u12"',
+        '"tab\tinside"',
+        "tru",
+        "nul",
+        "[1 2]",
+        '{"a" 1}',
+        '{"a":1 "b":2}',
+        "[] []",
+    ].forEach(test => {
+        expect(() => {
+            JSON.parse(test);
+        }).toThrow(SyntaxError);
+    });
+});
+
+test("numbers", () => {
+    expect(JSON.parse("0")).toBe(0);
+    expect(JSON.parse("-123456789")).toBe(-123456789);
+    expect(JSON.parse("1234567890")).toBe(1234567890);
+    expect(JSON.parse("-2147483648")).toBe(-2147483648);
+    expect(JSON.parse("1.5e3")).toBe(1500);
+    expect(JSON.parse("1E-2")).toBe(0.01);
+    expect(JSON.parse("-0e5")).toBe(-0);
+});
+
+test("strings", () => {
+    expect(JSON.parse('"\\"\\\\\\/\\b\\f\\n\\r\\t"')).toBe('"\\/\b\f\n\r\t');
+    expect(JSON.parse('"\\u0041\\u00e9\\u20ac"')).toBe("Aé€");
+    expect(JSON.parse('"\\ud834\\udd1e"')).toBe("𝄞");
+    expect(JSON.parse('"héllo wörld, this is longer than sixteen bytes"')).toBe(
+        "héllo wörld, this is longer than sixteen bytes"
+    );
+    expect(JSON.parse('"a long string without escapes, then one at the end\\n"')).toBe(
+        "a long string without escapes, then one at the end\n"
+    );
+    expect(JSON.parse('"\\n at the start of a long string without other escapes"')).toBe(
+        "\n at the start of a long string without other escapes"
+    );
+});
+
+test("objects with the same keys", () => {
+    const result = JSON.parse(
+        '[{"a":1,"b":2},{"a":3,"b":4},{"b":5,"a":6},{"a":7,"b":8,"c":9},{"a":10,"a":11,"b":12},{"a":13,"b":14}]'
+    );
+    expect(result).toEqual([
+        { a: 1, b: 2 },
+        { a: 3, b: 4 },
+        { b: 5, a: 6 },
+        { a: 7, b: 8, c: 9 },
+        { a: 11, b: 12 },
+        { a: 13, b: 14 },
+    ]);
+    expect(Object.keys(result[1])).toEqual(["a", "b"]);
+    expect(Object.keys(result[2])).toEqual(["b", "a"]);
+    expect(Object.keys(result[4])).toEqual(["a", "b"]);
+
+    result[1].c = "added later";
+    expect(result[0].c).toBeUndefined();
+    delete result[5].a;
+    expect(result[0].a).toBe(1);
+    expect(result[5]).toEqual({ b: 14 });
+});
+
+test("objects with numeric and special keys", () => {
+    const result = JSON.parse('[{"1":"x","0":"y","z":1},{"1":"x","0":"y","z":2},{"__proto__":[]}]');
+    expect(Object.keys(result[0])).toEqual(["0", "1", "z"]);
+    expect(result[1][0]).toBe("y");
+    expect(Object.getPrototypeOf(result[2])).toBe(Object.prototype);
+    expect(Object.hasOwn(result[2], "__proto__")).toBeTrue();
+});
+
+test("deeply nested input does not crash", () => {
+    const depth = 100000;
+    try {
+        JSON.parse("[".repeat(depth) + "]".repeat(depth));
+    } catch (e) {
+        expect(e).toBeInstanceOf(InternalError);
+    }
+});
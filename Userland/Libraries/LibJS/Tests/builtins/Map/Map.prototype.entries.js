@@ -17,3 +17,66 @@ test("basic functionality", () => {
     expect(it.next()).toEqual({ value: undefined, done: true });
     expect(it.next()).toEqual({ value: undefined, done: true });
 });
+
+describe("mutation during iteration", () => {
+    test("deleted entries are skipped and added entries are visited", () => {
+        const map = new Map([
+            ["a", 0],
+            ["b", 1],
+            ["c", 2],
+        ]);
+        const it = map.entries();
+        expect(it.next()).toEqual({ value: ["a", 0], done: false });
+        map.delete("b");
+        map.set("d", 3);
+        map.set("a", 4);
+        expect(it.next()).toEqual({ value: ["c", 2], done: false });
+        expect(it.next()).toEqual({ value: ["d", 3], done: false });
+        expect(it.next()).toEqual({ value: undefined, done: true });
+    });
+
+    test("entries added after clear are visited", () => {
+        const map = new Map([
+            ["a", 0],
+            ["b", 1],
+        ]);
+        const it = map.entries();
+        expect(it.next()).toEqual({ value: ["a", 0], done: false });
+        map.clear();
+        map.set("c", 2);
+        expect(it.next()).toEqual({ value: ["c", 2], done: false });
+        expect(it.next()).toEqual({ value: undefined, done: true });
+    });
+
+    test("iterator keeps its place when removed entries are compacted away", () => {
+        const map = new Map();
+        for (let i = 0; i < 100; ++i) map.set(i, i);
+        const it = map.keys();
+        for (let i = 0; i < 50; ++i) expect(it.next().value).toBe(i);
+        for (let i = 0; i < 100; i += 2) map.delete(i);
+        for (let i = 100; i < 200; ++i) map.set(i, i);
+        for (let i = 100; i < 200; ++i) map.delete(i);
+        map.set("last", 0);
+        const rest = [...it];
+        expect(rest).toHaveLength(26);
+        expect(rest[0]).toBe(51);
+        expect(rest[24]).toBe(99);
+        expect(rest[25]).toBe("last");
+        expect(map.size).toBe(51);
+    });
+
+    test("NaN and -0 keys", () => {
+        const map = new Map([
+            [NaN, "nan"],
+            [-0, "zero"],
+        ]);
+        map.set(NaN, "NaN");
+        map.set(0, "0");
+        expect(map.size).toBe(2);
+        expect([...map]).toEqual([
+            [NaN, "NaN"],
+            [0, "0"],
+        ]);
+        expect(Object.is([...map.keys()][1], 0)).toBeTrue();
+    });
+});
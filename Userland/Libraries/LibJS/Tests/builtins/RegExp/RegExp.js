@@ -61,6 +61,19 @@ test("regexp literals are re-useable", () => {
     }
 });
 
+test("regexps created from the same pattern don't share state", () => {
+    const first = new RegExp("a(?<rest>b+)", "g");
+    const second = new RegExp("a(?<rest>b+)", "g");
+    expect(first.exec("abbab").groups.rest).toBe("bb");
+    expect(first.lastIndex).toBe(3);
+    expect(second.lastIndex).toBe(0);
+    expect(second.exec("abbab").groups.rest).toBe("bb");
+
+    const insensitive = new RegExp("a(?<rest>b+)", "gi");
+    expect(insensitive.exec("ABB").groups.rest).toBe("BB");
+    expect(new RegExp("a(?<rest>b+)", "g").exec("ABB")).toBeNull();
+});
+
 test("Incorrectly escaped code units not converted to invalid patterns", () => {
     const re = /[\⪾-\⫀]/;
     expect(re.test("⫀")).toBeTrue();
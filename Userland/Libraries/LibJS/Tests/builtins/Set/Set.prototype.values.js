@@ -29,3 +29,21 @@ describe("keys is an alias for values", () => {
         expect(it.next()).toEqual({ value: undefined, done: true });
     });
 });
+
+test("mutation during iteration", () => {
+    const set = new Set();
+    for (let i = 0; i < 20; ++i) set.add(i);
+    const seen = [];
+    for (const value of set) {
+        seen.push(value);
+        if (value < 20) {
+            set.delete(value + 1);
+            set.add(value + 20);
+        }
+    }
+    expect(seen).toHaveLength(20);
+    expect(seen[9]).toBe(18);
+    expect(seen[10]).toBe(20);
+    expect(seen[19]).toBe(38);
+    expect(set.size).toBe(20);
+});
@@ -62,3 +62,27 @@ test("basic functionality", () => {
         expect(typedArray.includes(2n, -2)).toBe(true);
     });
 });
+
+test("large arrays", () => {
+    TYPED_ARRAYS.forEach(T => {
+        const typedArray = new T(100);
+        typedArray[70] = 42;
+
+        expect(typedArray.includes(42)).toBe(true);
+        expect(typedArray.includes(42, 71)).toBe(false);
+        expect(typedArray.includes(42.5)).toBe(false);
+        expect(typedArray.includes("42")).toBe(false);
+        expect(typedArray.includes(0, 99)).toBe(true);
+    });
+});
+
+test("NaN", () => {
+    [Float32Array, Float64Array].forEach(T => {
+        const typedArray = new T(100);
+        expect(typedArray.includes(NaN)).toBe(false);
+
+        typedArray[50] = NaN;
+        expect(typedArray.includes(NaN)).toBe(true);
+        expect(typedArray.includes(NaN, 51)).toBe(false);
+    });
+});
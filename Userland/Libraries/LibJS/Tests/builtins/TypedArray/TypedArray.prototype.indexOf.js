@@ -62,3 +62,27 @@ test("basic functionality", () => {
         expect(typedArray.indexOf(2n, -2)).toBe(1);
     });
 });
+
+test("large arrays", () => {
+    TYPED_ARRAYS.forEach(T => {
+        const typedArray = new T(100);
+        typedArray[30] = 42;
+        typedArray[70] = 42;
+
+        expect(typedArray.indexOf(42)).toBe(30);
+        expect(typedArray.indexOf(42, 31)).toBe(70);
+        expect(typedArray.indexOf(42, 71)).toBe(-1);
+        expect(typedArray.indexOf(42.5)).toBe(-1);
+        expect(typedArray.lastIndexOf(42)).toBe(70);
+        expect(typedArray.lastIndexOf(42, 69)).toBe(30);
+        expect(typedArray.lastIndexOf(42, 29)).toBe(-1);
+    });
+
+    [Float32Array, Float64Array].forEach(T => {
+        const typedArray = new T(100);
+        typedArray[50] = NaN;
+        expect(typedArray.indexOf(NaN)).toBe(-1);
+        expect(typedArray.lastIndexOf(NaN)).toBe(-1);
+        expect(typedArray.indexOf(-0)).toBe(0);
+    });
+});
@@ -89,3 +89,42 @@ test("detached buffer", () => {
         expect(typedArray[2]).toBeUndefined();
     });
 });
+
+test("large arrays", () => {
+    TYPED_ARRAYS.forEach(T => {
+        const values = [];
+        for (let i = 0; i < 1000; ++i) values.push((i * 7919) % 1000);
+
+        const typedArray = new T(values);
+        const expected = Array.from(typedArray).sort((a, b) => a - b);
+
+        expect(Array.from(typedArray.sort())).toEqual(expected);
+    });
+
+    BIGINT_TYPED_ARRAYS.forEach(T => {
+        const typedArray = new T(1000);
+        for (let i = 0; i < 1000; ++i) typedArray[i] = BigInt((i * 7919) % 1000) - 500n;
+
+        typedArray.sort();
+        for (let i = 1; i < 1000; ++i) expect(typedArray[i - 1] <= typedArray[i]).toBeTrue();
+    });
+});
+
+test("NaN and negative zero", () => {
+    [Float32Array, Float64Array].forEach(T => {
+        const values = [NaN, 1, 0, -Infinity, -0, Infinity, -1, NaN];
+        for (let i = 0; i < 100; ++i) values.push(i % 2 ? -0 : 0);
+
+        const typedArray = new T(values);
+        typedArray.sort();
+
+        expect(typedArray[0]).toBe(-Infinity);
+        expect(typedArray[1]).toBe(-1);
+        for (let i = 2; i < 53; ++i) expect(typedArray[i]).toBe(-0);
+        for (let i = 53; i < 104; ++i) expect(typedArray[i]).toBe(0);
+        expect(typedArray[104]).toBe(1);
+        expect(typedArray[105]).toBe(Infinity);
+        expect(typedArray[106]).toBeNaN();
+        expect(typedArray[107]).toBeNaN();
+    });
+});
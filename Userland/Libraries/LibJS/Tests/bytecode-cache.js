@@ -0,0 +1,88 @@
+// These are mostly interesting when run twice with `test-js --bytecode-cache <directory>`, as the second run will use
+// the bytecode that the first run cached for the top-level code of this file and for each of the functions it called.
+// Tests/LibJS/test-bytecode-cache-js.cpp stores and loads entries within a single run.
+
+const constants = [-0, 0.5, 2 ** 31, "string", 12345678901234567890n, null, undefined, true];
+const pattern = /a(b+)c/gi;
+
+function declaredFunction(x) {
+    return x * 2;
+}
+
+const arrowFunction = (a, b = 1) => a + b;
+
+class Base {
+    #secret = 42;
+
+    get secret() {
+        return this.#secret;
+    }
+}
+
+class Derived extends Base {
+    static name2 = "derived";
+}
+
+let blockResult;
+{
+    let scoped = "block";
+    function blockFunction() {
+        return scoped;
+    }
+    blockResult = blockFunction();
+}
+
+let switchResult;
+switch (constants.length) {
+    case 8: {
+        let inner = "eight";
+        switchResult = inner;
+        break;
+    }
+    default:
+        switchResult = "other";
+}
+
+let caught;
+try {
+    throw new Error("thrown at top level");
+} catch (e) {
+    caught = e.message;
+} finally {
+    caught += "!";
+}
+
+const loopClosures = [];
+for (let i = 0; i < 3; ++i) loopClosures.push(() => i);
+
+test("constants", () => {
+    expect(Object.is(constants[0], -0)).toBeTrue();
+    expect(constants[1]).toBe(0.5);
+    expect(constants[2]).toBe(2147483648);
+    expect(constants[3]).toBe("string");
+    expect(constants[4]).toBe(12345678901234567890n);
+    expect(constants[5]).toBeNull();
+    expect(constants[6]).toBeUndefined();
+    expect(constants[7]).toBeTrue();
+});
+
+test("regular expressions", () => {
+    expect("xABBCx".replace(pattern, "[$1]")).toBe("x[BB]x");
+    expect(pattern.flags).toBe("gi");
+});
+
+test("functions and classes", () => {
+    expect(declaredFunction(21)).toBe(42);
+    expect(arrowFunction(1)).toBe(2);
+    expect(arrowFunction.length).toBe(1);
+    expect(new Derived().secret).toBe(42);
+    expect(Derived.name2).toBe("derived");
+    expect(Derived.name).toBe("Derived");
+});
+
+test("blocks, switches and exception handlers", () => {
+    expect(blockResult).toBe("block");
+    expect(switchResult).toBe("eight");
+    expect(caught).toBe("thrown at top level!");
+    expect(loopClosures.map(closure => closure())).toEqual([0, 1, 2]);
+});
@@ -0,0 +1,72 @@
+// The optimization passes run by default; `test-js --disable-bytecode-optimizations` runs these without them.
+
+test("values forwarded through locals are not reused after reassignment", () => {
+    let a = 1;
+    let b = a;
+    a = 2;
+    expect(b).toBe(1);
+    expect(a + b).toBe(3);
+});
+
+test("folding matches the interpreter for numeric edge cases", () => {
+    const zero = 0;
+    const negativeZero = -zero;
+    expect(Object.is(negativeZero, -0)).toBeTrue();
+    const nan = 0 / zero;
+    expect(nan === nan).toBeFalse();
+    expect(nan != nan).toBeTrue();
+    const big = 2147483647;
+    expect(big + 1).toBe(2147483648);
+    expect(big << 1).toBe(-2);
+    expect(-1 >>> 0).toBe(4294967295);
+});
+
+test("folded branches take the right side", () => {
+    const yes = 1;
+    let taken;
+    if (yes < 2) taken = "then";
+    else taken = "else";
+    expect(taken).toBe("then");
+
+    const nothing = null;
+    expect(nothing ?? "fallback").toBe("fallback");
+});
+
+test("temporaries written before a throw are visible in the handler", () => {
+    let observed;
+    try {
+        let temporary = 42;
+        observed = temporary;
+        null.property;
+        observed = 0;
+    } catch {
+        expect(observed).toBe(42);
+    }
+    expect(observed).toBe(42);
+});
+
+test("values survive yields", () => {
+    function* generator() {
+        const base = 10;
+        let value = base + 1;
+        yield value;
+        value = value + base;
+        yield value;
+    }
+    expect([...generator()]).toEqual([11, 21]);
+});
+
+test("loops through threaded jumps", () => {
+    let count = 0;
+    for (let i = 0; i < 10; ++i) {
+        if (i % 2) continue;
+        ++count;
+    }
+    expect(count).toBe(5);
+
+    let iterations = 0;
+    while (true) {
+        if (++iterations === 3) break;
+    }
+    expect(iterations).toBe(3);
+});
@@ -0,0 +1,45 @@
+test("generator arguments and locals survive later calls", () => {
+    function* generator(a, b) {
+        let sum = a + b;
+        yield sum;
+        yield a * b + sum;
+    }
+
+    function clobber(x, y, z) {
+        let w = x + y + z;
+        return w;
+    }
+
+    const iterator = generator(3, 4);
+    expect(iterator.next().value).toBe(7);
+    for (let i = 0; i < 100; ++i) clobber(i, i, i);
+    expect(iterator.next().value).toBe(19);
+});
+
+test("async function arguments survive later calls", () => {
+    let result;
+    async function asyncFunction(a, b) {
+        await null;
+        result = a + b;
+    }
+
+    function clobber(x, y) {
+        return x * y;
+    }
+
+    asyncFunction("well ", "hello");
+    for (let i = 0; i < 100; ++i) clobber(i, i);
+    runQueuedPromiseJobs();
+    expect(result).toBe("well hello");
+});
+
+test("deep recursion with many locals", () => {
+    function recurse(depth, a, b, c, d) {
+        let e = a + b,
+            f = c + d;
+        if (depth === 0) return e + f;
+        return recurse(depth - 1, a, b, c, d) + e - f;
+    }
+
+    expect(recurse(1000, 1, 2, 3, 4)).toBe(10 - 4000);
+});
@@ -16,3 +16,65 @@ test("Inline cache invalidated by deleting property from unique shape", () => {
     expect(first).toBe(2);
     expect(second).toBeUndefined();
 });
+
+test("Polymorphic and megamorphic get sites see the right property for every shape", () => {
+    function get(o) {
+        return o.x;
+    }
+
+    const objects = [];
+    for (let i = 0; i < 20; ++i) {
+        const o = {};
+        // Give every object a different shape, with "x" at a different offset.
+        for (let j = 0; j < i; ++j) o["pad" + j] = j;
+        o.x = i;
+        objects.push(o);
+    }
+
+    for (let round = 0; round < 3; ++round) {
+        for (let i = 0; i < objects.length; ++i) expect(get(objects[i])).toBe(i);
+    }
+
+    const proto = { x: "inherited" };
+    const child = Object.create(proto);
+    expect(get(child)).toBe("inherited");
+    proto.x = "changed";
+    expect(get(child)).toBe("changed");
+});
+
+test("Megamorphic put sites don't write to non-writable properties", () => {
+    function put(o, value) {
+        o.x = value;
+    }
+
+    const objects = [];
+    for (let i = 0; i < 10; ++i) {
+        const o = {};
+        for (let j = 0; j < i; ++j) o["pad" + j] = j;
+        o.x = 0;
+        objects.push(o);
+    }
+
+    for (const o of objects) put(o, 1);
+    for (const o of objects) expect(o.x).toBe(1);
+
+    const frozen = Object.freeze(objects[0]);
+    put(frozen, 2);
+    expect(frozen.x).toBe(1);
+});
+
+test("Repeated prototype chain invalidations of the same shape see the new value", () => {
+    function get(o) {
+        return o.x;
+    }
+
+    const proto = { x: 0 };
+    const child = Object.create(proto);
+    for (let i = 0; i < 10; ++i) {
+        // Each of these changes the prototype's shape and invalidates the cached prototype chain for "child".
+        proto["pad" + i] = i;
+        proto.x = i;
+        expect(get(child)).toBe(i);
+        expect(get(child)).toBe(i);
+    }
+});
@@ -0,0 +1,111 @@
+// The JIT only compiles hot code, so these are mostly interesting when run with `test-js --jit-threshold 0`.
+
+test("int32 arithmetic overflows into doubles", () => {
+    let value = 2147483640;
+    for (let i = 0; i < 20; ++i) value = value + 1;
+    expect(value).toBe(2147483660);
+
+    let negative = -2147483640;
+    for (let i = 0; i < 20; ++i) negative = negative - 1;
+    expect(negative).toBe(-2147483660);
+
+    let counter = 2147483647;
+    counter++;
+    expect(counter).toBe(2147483648);
+    let decrementing = -2147483648;
+    decrementing--;
+    expect(decrementing).toBe(-2147483649);
+});
+
+test("mixed operand types take the slow path", () => {
+    const values = [1, 1.5, "2", null, false, true, 3n, {}];
+    const sums = [];
+    for (const value of values) {
+        if (typeof value === "bigint") sums.push(value + 1n);
+        else sums.push(value + 1);
+    }
+    expect(sums).toEqual([2, 2.5, "21", 1, 1, 2, 4n, "[object Object]1"]);
+    expect(1 < 1.5).toBeTrue();
+    expect(NaN < 1).toBeFalse();
+    expect(NaN >= 1).toBeFalse();
+    expect("10" < "9").toBeTrue();
+    expect(1 == "1").toBeTrue();
+    expect(1 === "1").toBeFalse();
+    expect(0 === -0).toBeTrue();
+});
+
+test("comparisons and bitwise operations", () => {
+    let count = 0;
+    for (let i = -5; i <= 5; i++) {
+        if (i < 0) count |= 1;
+        if (i > 0) count |= 2;
+        if (i === 0) count ^= 4;
+        if (i != 3) count &= ~8;
+    }
+    expect(count).toBe(7);
+});
+
+test("exceptions thrown from compiled code reach the right handler", () => {
+    let caught = 0;
+    for (let i = 0; i < 10; ++i) {
+        try {
+            if (i % 3 === 0) null.property;
+        } catch (e) {
+            expect(e).toBeInstanceOf(TypeError);
+            ++caught;
+        } finally {
+            ++caught;
+        }
+    }
+    expect(caught).toBe(14);
+
+    const throwing = {
+        valueOf() {
+            throw new Error("valueOf");
+        },
+    };
+    expect(() => {
+        for (let i = 0; i < 3; ++i) {
+            if (i < throwing) break;
+        }
+    }).toThrowWithMessage(Error, "valueOf");
+});
+
+test("stack traces point at the compiled instruction", () => {
+    function thrower() {
+        let i = 0;
+        while (true) {
+            if (++i === 5) throw new Error("done");
+        }
+    }
+    try {
+        thrower();
+        expect().fail();
+    } catch (e) {
+        expect(e.stack).toContain("thrower");
+    }
+});
+
+test("generators resume in the middle of compiled loops", () => {
+    function* numbers(count) {
+        for (let i = 0; i < count; ++i) yield i * 2;
+    }
+    expect([...numbers(5)]).toEqual([0, 2, 4, 6, 8]);
+});
+
+test("arguments are read and written in place", () => {
+    function f(a, b) {
+        for (let i = 0; i < 3; ++i) a = a + b;
+        return a;
+    }
+    expect(f(1, 2)).toBe(7);
+    expect(f("x", "y")).toBe("xyyy");
+    expect(f(1)).toBeNaN();
+});
+
+test("recursion through compiled code", () => {
+    function fib(n) {
+        return n < 2 ? n : fib(n - 1) + fib(n - 2);
+    }
+    expect(fib(20)).toBe(6765);
+});
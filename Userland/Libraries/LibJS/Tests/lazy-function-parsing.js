@@ -0,0 +1,171 @@
+// Function bodies are skimmed over and parsed on their first call by default; `test-js --disable-lazy-parsing` runs
+// these with every function parsed right away instead.
+
+test("captured variables stay visible to skipped functions", () => {
+    function outer() {
+        let before = 1;
+        const get = function () {
+            return before + after;
+        };
+        let after = 2;
+        before = 10;
+        return get;
+    }
+    expect(outer()()).toBe(12);
+
+    function counter() {
+        let count = 0;
+        function increment() {
+            return ++count;
+        }
+        increment();
+        increment();
+        return [increment(), count];
+    }
+    expect(counter()).toEqual([3, 3]);
+});
+
+test("nested skipped functions", () => {
+    function a(x) {
+        function b(y) {
+            function c(z) {
+                return x + y + z;
+            }
+            return c;
+        }
+        return b;
+    }
+    expect(a(1)(2)(3)).toBe(6);
+
+    function factorial(n) {
+        return n <= 1 ? 1 : n * factorial(n - 1);
+    }
+    expect(factorial(10)).toBe(3628800);
+});
+
+test("closures created from the same function", () => {
+    const closures = [];
+    for (let i = 0; i < 5; ++i) {
+        closures.push(function () {
+            return i * 2;
+        });
+    }
+    expect(closures.map(closure => closure())).toEqual([0, 2, 4, 6, 8]);
+});
+
+test("properties are available before the first call", () => {
+    function f(a, b = 1, ...rest) {
+        return a;
+    }
+    expect(f).toHaveLength(1);
+    expect(f.name).toBe("f");
+    expect(f.toString()).toBe("function f(a, b = 1, ...rest) {\n        return a;\n    }");
+    expect(f(5)).toBe(5);
+});
+
+test("direct eval in a skipped function", () => {
+    function outer() {
+        let hidden = 42;
+        function inner() {
+            return eval("hidden");
+        }
+        return inner();
+    }
+    expect(outer()).toBe(42);
+});
+
+test("with statement in a skipped function", () => {
+    function outer() {
+        let value = "outer";
+        function inner(object) {
+            with (object) {
+                return value;
+            }
+        }
+        return [inner({}), inner({ value: "object" })];
+    }
+    expect(outer()).toEqual(["outer", "object"]);
+});
+
+test("regular expressions and templates that look like brackets", () => {
+    function f(s, x) {
+        if (x) /}/.test(s);
+        const braces = `${{ a: "}" }.a}{`;
+        if (/[{]/.test(s)) return /}/.source + braces;
+        return typeof /[)]/ + x / 2;
+    }
+    expect(f("{", 0)).toBe("}}{");
+    expect(f("", 4)).toBe("object2");
+
+    function g(s) {
+        {
+        }
+        /}/.test(s);
+        if (s) {
+        } /{/.test(s);
+        return s;
+    }
+    expect(g("}")).toBe("}");
+});
+
+test("early errors in skipped functions are still reported", () => {
+    expect("function f() { let a; let a; }").not.toEval();
+    expect("function f(a) { let a; }").not.toEval();
+    expect("function f() { let a; { var a; } }").not.toEval();
+    expect("function f() { a b }").not.toEval();
+    expect("function f() { x = 1 = 2; }").not.toEval();
+    expect("function f() { x +; }").not.toEval();
+    expect("function f() { break; }").not.toEval();
+    expect("function f() { while (true) continue label; }").not.toEval();
+    expect("function f() { /(/; }").not.toEval();
+    expect("function f() { /a/gg; }").not.toEval();
+    expect('function f() { "\\x4"; }').not.toEval();
+    expect('function f() { "use strict"; delete x; }').not.toEval();
+    expect('function f() { "use strict"; return 010; }').not.toEval();
+    expect('"use strict"; function f() { with ({}) {} }').not.toEval();
+    expect("function f() { for await (const x of []); }").not.toEval();
+
+    expect("function f(a) { let b; { let a, b; } label: for (;;) { if (a) break label; continue; } }").toEval();
+    expect("function f() { var a; for (let a of []); for (let a = 0; ; ) break; }").toEval();
+    expect("function f(x) { return x / 2 / /2/.source; }").toEval();
+});
+
+test("this, arguments and strict mode", () => {
+    function sloppy() {
+        return [typeof this, arguments.length];
+    }
+    expect(sloppy.call(undefined, 1, 2)).toEqual(["object", 2]);
+
+    function strict() {
+        "use strict";
+        function inner() {
+            return this;
+        }
+        return inner();
+    }
+    expect(strict()).toBeUndefined();
+});
+
+test("generators and async functions", () => {
+    function* generator(n) {
+        for (let i = 0; i < n; ++i) yield i;
+    }
+    expect([...generator(3)]).toEqual([0, 1, 2]);
+
+    let result;
+    async function asyncFunction(value) {
+        return await value;
+    }
+    asyncFunction(7).then(value => {
+        result = value;
+    });
+    runQueuedPromiseJobs();
+    expect(result).toBe(7);
+});
+
+test("errors from skipped functions", () => {
+    function thrower() {
+        throw new TypeError("from a skipped function");
+    }
+    expect(thrower).toThrowWithMessage(TypeError, "from a skipped function");
+});
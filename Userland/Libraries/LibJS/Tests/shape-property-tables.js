@@ -0,0 +1,73 @@
+test("Objects that share a chain of shapes see only their own properties", () => {
+    const short = { a: 1, b: 2 };
+    const long = { a: 1, b: 2, c: 3, d: 4 };
+    const middle = { a: 1, b: 2, c: 3 };
+
+    expect(Object.keys(short)).toEqual(["a", "b"]);
+    expect(Object.keys(middle)).toEqual(["a", "b", "c"]);
+    expect(Object.keys(long)).toEqual(["a", "b", "c", "d"]);
+    expect(short.c).toBeUndefined();
+    expect("d" in middle).toBeFalse();
+    expect(long.d).toBe(4);
+});
+
+test("Branching shape chains keep their properties apart", () => {
+    const base = () => ({ a: 1, b: 2 });
+
+    const first = base();
+    first.x = 3;
+    first.y = 4;
+
+    const second = base();
+    second.y = 5;
+    second.x = 6;
+
+    const third = base();
+    third.x = 7;
+    Object.defineProperty(third, "y", { value: 8, enumerable: false });
+
+    expect(Object.keys(first)).toEqual(["a", "b", "x", "y"]);
+    expect(Object.keys(second)).toEqual(["a", "b", "y", "x"]);
+    expect(Object.keys(third)).toEqual(["a", "b", "x"]);
+    expect(first.x).toBe(3);
+    expect(first.y).toBe(4);
+    expect(second.x).toBe(6);
+    expect(second.y).toBe(5);
+    expect(third.y).toBe(8);
+});
+
+test("Configuring and deleting properties doesn't affect other objects", () => {
+    const objects = [];
+    for (let i = 0; i < 3; ++i) objects.push({ a: i, b: i, c: i });
+
+    Object.defineProperty(objects[0], "b", { enumerable: false });
+    delete objects[1].a;
+    objects[1].d = 1;
+
+    expect(Object.keys(objects[0])).toEqual(["a", "c"]);
+    expect(Object.keys(objects[1])).toEqual(["b", "c", "d"]);
+    expect(Object.keys(objects[2])).toEqual(["a", "b", "c"]);
+    expect(objects[1].d).toBe(1);
+    expect(objects[2].d).toBeUndefined();
+});
+
+test("Dictionary objects don't affect the objects they were created from", () => {
+    const make = () => {
+        const o = {};
+        for (let i = 0; i < 100; ++i) o["p" + i] = i;
+        return o;
+    };
+
+    const first = make();
+    const second = make();
+    delete first.p50;
+    first.extra = true;
+    Object.defineProperty(first, "p10", { enumerable: false });
+
+    expect(Object.keys(first)).toHaveLength(99);
+    expect(Object.keys(second)).toHaveLength(100);
+    expect(second.p50).toBe(50);
+    expect(second.extra).toBeUndefined();
+    expect(Object.keys(second)[10]).toBe("p10");
+    expect(first.p99).toBe(99);
+});
@@ -298,3 +298,43 @@ test("string object: string property name access", () => {
     expect(lastSetThisValue).toBeNull();
     lastSetThisValue = null;
 });
+
+test("concatenated strings", () => {
+    let shallow = "ab";
+    shallow += "c\ud83d";
+    shallow += "\ude00d";
+    expect(shallow.length).toBe(6);
+    expect(shallow[1]).toBe("b");
+    expect(shallow.charCodeAt(3)).toBe(0xd83d);
+    expect(shallow.codePointAt(3)).toBe(0x1f600);
+    expect(shallow.codePointAt(4)).toBe(0xde00);
+    expect(shallow.at(-1)).toBe("d");
+    expect(shallow.slice(1, 5)).toBe("bc😀");
+    expect(shallow.substring(2)).toBe("c😀d");
+    expect(shallow.substr(3, 2)).toBe("😀");
+    expect(shallow).toBe("abc😀d");
+
+    let deep = "";
+    for (let i = 0; i < 1000; ++i) deep += String.fromCharCode(0x61 + (i % 26)) + "ö";
+    expect(deep.length).toBe(2000);
+    expect(deep.charAt(52)).toBe("a");
+    expect(deep.charCodeAt(1999)).toBe(0xf6);
+    expect(deep.slice(-4)).toBe("kölö");
+    expect(deep.indexOf("öbö")).toBe(1);
+    expect(deep.indexOf("zöa", 100)).toBe(102);
+    expect(deep.indexOf("ö", 1999)).toBe(1999);
+    expect(deep.indexOf("", 2000)).toBe(2000);
+    expect(deep.indexOf("", 2001)).toBe(2000);
+    expect(deep.indexOf("x")).toBe(-1);
+    expect(deep.includes("yöz")).toBeTrue();
+    expect(deep.includes("aa")).toBeFalse();
+    expect(deep.includes("aöbö", 1998)).toBeFalse();
+
+    let prepended = "";
+    for (let i = 0; i < 1000; ++i) prepended = String.fromCharCode(0x61 + (i % 26)) + "-" + prepended;
+    expect(prepended.length).toBe(2000);
+    expect(prepended.charAt(0)).toBe("l");
+    expect(prepended.indexOf("a-z")).toBe(22);
+    expect(prepended.lastIndexOf("a-")).toBe(1998);
+    expect(prepended.endsWith("c-b-a-")).toBeTrue();
+});
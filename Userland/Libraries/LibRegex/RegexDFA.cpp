@@ -0,0 +1,521 @@
+/*
+ * Copyright (c) 2026, agent <agent@local>
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/CharacterTypes.h>
+#include <AK/HashTable.h>
+#include <AK/QuickSort.h>
+#include <AK/Utf16View.h>
+#include <AK/Utf32View.h>
+#include <LibRegex/RegexDFA.h>
+#include <string.h>
+
+namespace regex {
+
+namespace {
+
+// The automaton reads the subject one code unit at a time, which is what the VM does when the Unicode flag is unset.
+// An empty result means the automaton can't tell what the VM would see at that position.
+
+struct ByteInput {
+    StringView view;
+
+    size_t length() const { return view.length(); }
+    Optional<u32> at(size_t index) const { return static_cast<u8>(view[index]); }
+
+    Optional<size_t> find(u32 code_unit, size_t from) const
+    {
+        if (code_unit > 0xff || from >= view.length())
+            return {};
+        auto const* start = reinterpret_cast<u8 const*>(view.characters_without_null_termination());
+        auto const* found = static_cast<u8 const*>(memchr(start + from, static_cast<int>(code_unit), view.length() - from));
+        if (!found)
+            return {};
+        return static_cast<size_t>(found - start);
+    }
+};
+
+struct Utf16Input {
+    Utf16View view;
+
+    size_t length() const { return view.length_in_code_units(); }
+
+    Optional<u32> at(size_t index) const
+    {
+        // Some compares read a whole surrogate pair even when the Unicode flag is unset.
+        u16 code_unit = view.data()[index];
+        if (is_unicode_surrogate(code_unit))
+            return {};
+        return code_unit;
+    }
+
+    Optional<size_t> find(u32 code_unit, size_t from) const
+    {
+        auto const* data = view.data();
+        for (size_t i = from; i < length(); ++i) {
+            if (data[i] == code_unit)
+                return i;
+        }
+        return {};
+    }
+};
+
+struct Utf32Input {
+    Utf32View view;
+
+    size_t length() const { return view.length(); }
+    Optional<u32> at(size_t index) const { return view.at(index); }
+
+    Optional<size_t> find(u32 code_unit, size_t from) const
+    {
+        auto const* data = view.code_points();
+        for (size_t i = from; i < length(); ++i) {
+            if (data[i] == code_unit)
+                return i;
+        }
+        return {};
+    }
+};
+
+template<typename Callback>
+static decltype(auto) with_input(RegexStringView const& view, Callback callback)
+{
+    if (view.is_string_view())
+        return callback(ByteInput { view.string_view() });
+    if (view.is_u16_view())
+        return callback(Utf16Input { view.u16_view() });
+    return callback(Utf32Input { view.u32_view() });
+}
+
+}
+
+Optional<LazyDFA::CompareInfo> LazyDFA::compare_info(ByteCode const& bytecode, size_t instruction_position)
+{
+    CompareInfo info;
+
+    auto arguments_count = bytecode.at(instruction_position + 1);
+    size_t offset = instruction_position + 3;
+    for (size_t i = 0; i < arguments_count; ++i) {
+        auto compare_type = static_cast<CharacterCompareType>(bytecode.at(offset++));
+        switch (compare_type) {
+        case CharacterCompareType::Char:
+            if (arguments_count == 1)
+                info.single_char = static_cast<u32>(bytecode.at(offset));
+            ++offset;
+            break;
+        case CharacterCompareType::CharClass:
+        case CharacterCompareType::CharRange:
+        case CharacterCompareType::Property:
+        case CharacterCompareType::GeneralCategory:
+        case CharacterCompareType::Script:
+        case CharacterCompareType::ScriptExtension:
+            ++offset;
+            break;
+        case CharacterCompareType::LookupTable: {
+            auto count = bytecode.at(offset++);
+            offset += count;
+            break;
+        }
+        case CharacterCompareType::String: {
+            // A string is matched one code unit at a time, which only works if nothing else is compared alongside it.
+            auto length = bytecode.at(offset++);
+            if (arguments_count != 1 || length >= pending_end_check)
+                return {};
+            info.is_string = true;
+            for (size_t j = 0; j < length; ++j)
+                info.string.append(static_cast<u32>(bytecode.at(offset + j)));
+            offset += length;
+            break;
+        }
+        case CharacterCompareType::Reference:
+            // Backreferences depend on what the capture groups matched.
+            return {};
+        default:
+            break;
+        }
+    }
+
+    return info;
+}
+
+bool LazyDFA::is_supported(ByteCode const& bytecode)
+{
+    MatchState state;
+    while (state.instruction_position < bytecode.size()) {
+        auto& opcode = bytecode.get_opcode(state);
+        switch (opcode.opcode_id()) {
+        case OpCodeId::Compare:
+            if (!compare_info(bytecode, state.instruction_position).has_value())
+                return false;
+            break;
+        case OpCodeId::Jump:
+        case OpCodeId::JumpNonEmpty:
+        case OpCodeId::ForkJump:
+        case OpCodeId::ForkStay:
+        case OpCodeId::ForkReplaceJump:
+        case OpCodeId::ForkReplaceStay:
+        case OpCodeId::SaveLeftCaptureGroup:
+        case OpCodeId::SaveRightCaptureGroup:
+        case OpCodeId::SaveRightNamedCaptureGroup:
+        case OpCodeId::ClearCaptureGroup:
+        case OpCodeId::CheckBegin:
+        case OpCodeId::CheckEnd:
+        case OpCodeId::CheckBoundary:
+        case OpCodeId::Checkpoint:
+        case OpCodeId::Exit:
+            break;
+        case OpCodeId::Save:
+        case OpCodeId::Restore:
+        case OpCodeId::GoBack:
+        case OpCodeId::FailForks:
+        case OpCodeId::Repeat:
+        case OpCodeId::ResetRepeat:
+            // Lookarounds, atomic groups and counted repetitions need state the automaton doesn't have.
+            return false;
+        }
+        state.instruction_position += opcode.size();
+    }
+    return true;
+}
+
+bool LazyDFA::can_be_used_with(AllOptions options)
+{
+    return !options.has_flag_set(AllFlags::Unicode)
+        && !options.has_flag_set(AllFlags::UnicodeSets)
+        && !options.has_flag_set(AllFlags::Multiline)
+        && !options.has_flag_set(AllFlags::MatchNotBeginOfLine)
+        && !options.has_flag_set(AllFlags::MatchNotEndOfLine);
+}
+
+bool LazyDFA::can_be_used_with(RegexStringView const& view)
+{
+    return !view.unicode() && (view.is_string_view() || view.is_u16_view() || view.is_u32_view());
+}
+
+LazyDFA::LazyDFA(ByteCode const& bytecode, AllOptions options)
+    : m_bytecode(bytecode)
+    , m_options(options)
+{
+    MatchState state;
+    while (state.instruction_position < bytecode.size()) {
+        auto& opcode = bytecode.get_opcode(state);
+        if (opcode.opcode_id() == OpCodeId::Compare)
+            m_compares.set(state.instruction_position, compare_info(bytecode, state.instruction_position).release_value());
+        state.instruction_position += opcode.size();
+    }
+
+    // The dead state, which never matches anything.
+    m_states.append({});
+    m_states.first().ascii_transitions.fill(dead_state);
+
+    // If every match has to start with the same code unit, the search for a match can skip straight to it.
+    if (m_options.has_flag_set(AllFlags::Insensitive))
+        return;
+
+    auto const& start = m_states[start_state(false, false)];
+    if (m_has_given_up || start.accepting || start.accepting_at_end || start.positions.is_empty())
+        return;
+
+    Optional<u32> first_code_unit;
+    for (auto position : start.positions) {
+        // A CheckEnd that can't lead to a match at the end of the input never matches.
+        if ((position & pending_end_check) == pending_end_check)
+            continue;
+        auto const& compare = m_compares.get(position >> 16).value();
+        Optional<u32> code_unit = compare.is_string ? compare.string.first() : compare.single_char;
+        if (!code_unit.has_value() || (first_code_unit.has_value() && *first_code_unit != *code_unit))
+            return;
+        first_code_unit = code_unit;
+    }
+    m_required_first_code_unit = first_code_unit;
+}
+
+void LazyDFA::add_closure(Vector<u64>& positions, size_t instruction_position, bool at_begin, bool at_end, bool& accepting) const
+{
+    HashTable<size_t> visited;
+    Vector<size_t> worklist;
+    worklist.append(instruction_position);
+
+    auto add_target = [&](size_t from, size_t size, ssize_t offset) {
+        auto target = static_cast<ssize_t>(from + size) + offset;
+        if (target >= 0)
+            worklist.append(static_cast<size_t>(target));
+    };
+
+    while (!worklist.is_empty()) {
+        auto ip = worklist.take_last();
+        if (visited.set(ip) != HashSetResult::InsertedNewEntry)
+            continue;
+
+        if (ip >= m_bytecode.size()) {
+            accepting = true;
+            continue;
+        }
+
+        MatchState state;
+        state.instruction_position = ip;
+        auto& opcode = m_bytecode.get_opcode(state);
+        auto next = ip + opcode.size();
+
+        switch (opcode.opcode_id()) {
+        case OpCodeId::Compare: {
+            auto const& compare = m_compares.get(ip).value();
+            if (compare.is_string && compare.string.is_empty())
+                worklist.append(next);
+            else if (!at_end)
+                positions.append(static_cast<u64>(ip) << 16);
+            break;
+        }
+        case OpCodeId::Jump:
+            add_target(ip, opcode.size(), static_cast<OpCode_Jump const&>(opcode).offset());
+            break;
+        case OpCodeId::JumpNonEmpty:
+            worklist.append(next);
+            add_target(ip, opcode.size(), static_cast<OpCode_JumpNonEmpty const&>(opcode).offset());
+            break;
+        case OpCodeId::ForkJump:
+        case OpCodeId::ForkReplaceJump:
+            worklist.append(next);
+            add_target(ip, opcode.size(), static_cast<OpCode_ForkJump const&>(opcode).offset());
+            break;
+        case OpCodeId::ForkStay:
+        case OpCodeId::ForkReplaceStay:
+            worklist.append(next);
+            add_target(ip, opcode.size(), static_cast<OpCode_ForkStay const&>(opcode).offset());
+            break;
+        case OpCodeId::CheckBegin:
+            if (at_begin)
+                worklist.append(next);
+            break;
+        case OpCodeId::CheckEnd:
+            if (at_end)
+                worklist.append(next);
+            else
+                positions.append((static_cast<u64>(ip) << 16) | pending_end_check);
+            break;
+        case OpCodeId::Exit:
+            accepting = true;
+            break;
+        default:
+            // Capture groups, checkpoints and word boundaries don't consume anything.
+            worklist.append(next);
+            break;
+        }
+    }
+}
+
+u32 LazyDFA::intern_state(Vector<u64> positions, bool at_begin, bool unanchored, bool accepting)
+{
+    if (positions.is_empty() && !accepting)
+        return dead_state;
+
+    quick_sort(positions);
+    size_t unique_count = 0;
+    for (size_t i = 0; i < positions.size(); ++i) {
+        if (i == 0 || positions[i] != positions[unique_count - 1])
+            positions[unique_count++] = positions[i];
+    }
+    positions.shrink(unique_count);
+
+    DFAStateKey key { move(positions), at_begin, unanchored, accepting };
+    if (auto index = m_state_indices.get(key); index.has_value())
+        return *index;
+
+    if (m_states.size() >= max_state_count) {
+        m_has_given_up = true;
+        return dead_state;
+    }
+
+    State state;
+    state.unanchored = unanchored;
+    state.accepting = accepting;
+    state.accepting_at_end = accepting;
+    state.ascii_transitions.fill(unknown_transition);
+    for (auto position : key.positions) {
+        if ((position & pending_end_check) != pending_end_check)
+            continue;
+        MatchState match_state;
+        match_state.instruction_position = position >> 16;
+        auto& opcode = m_bytecode.get_opcode(match_state);
+        Vector<u64> ignored_positions;
+        add_closure(ignored_positions, match_state.instruction_position + opcode.size(), at_begin, true, state.accepting_at_end);
+    }
+    state.positions = key.positions;
+
+    auto index = static_cast<u32>(m_states.size());
+    m_states.append(move(state));
+    m_state_indices.set(move(key), index);
+    return index;
+}
+
+u32 LazyDFA::start_state(bool at_begin, bool unanchored)
+{
+    auto& cached = m_start_states[(at_begin ? 1 : 0) | (unanchored ? 2 : 0)];
+    if (!cached.has_value()) {
+        Vector<u64> positions;
+        bool accepting = false;
+        add_closure(positions, 0, at_begin, false, accepting);
+        cached = intern_state(move(positions), at_begin, unanchored, accepting);
+    }
+    return *cached;
+}
+
+bool LazyDFA::compare_matches(u64 position, u32 code_unit) const
+{
+    auto instruction_position = static_cast<size_t>(position >> 16);
+    auto const& compare = m_compares.get(instruction_position).value();
+
+    if (compare.is_string) {
+        auto expected = compare.string[position & pending_end_check];
+        // Outside ASCII, the VM's string comparison depends on the subject's encoding and case folding rules,
+        // so let anything through and leave the decision to the VM.
+        if (expected >= 0x80 || code_unit >= 0x80)
+            return true;
+        if (m_options.has_flag_set(AllFlags::Insensitive))
+            return to_ascii_lowercase(expected) == to_ascii_lowercase(code_unit);
+        return expected == code_unit;
+    }
+
+    // Everything else only ever looks at the current character, so run the instruction on just that character.
+    MatchInput input;
+    input.view = Utf32View { &code_unit, 1 };
+    input.regex_options = m_options;
+
+    MatchState state;
+    state.instruction_position = instruction_position;
+    auto& opcode = m_bytecode.get_opcode(state);
+    auto result = opcode.execute(input, state);
+    return result == ExecutionResult::Continue && state.string_position == 1;
+}
+
+u32 LazyDFA::transition(u32 state_index, u32 code_unit)
+{
+    if (code_unit < 128) {
+        if (auto next = m_states[state_index].ascii_transitions[code_unit]; next != unknown_transition)
+            return next;
+    } else if (auto next = m_states[state_index].other_transitions.get(code_unit); next.has_value()) {
+        return *next;
+    }
+
+    auto const& state = m_states[state_index];
+    auto unanchored = state.unanchored;
+
+    Vector<u64> positions;
+    bool accepting = false;
+    for (auto position : state.positions) {
+        auto index = position & pending_end_check;
+        if (index == pending_end_check || !compare_matches(position, code_unit))
+            continue;
+
+        auto instruction_position = static_cast<size_t>(position >> 16);
+        auto const& compare = m_compares.get(instruction_position).value();
+        if (compare.is_string && index + 1 < compare.string.size()) {
+            positions.append(position + 1);
+            continue;
+        }
+
+        MatchState match_state;
+        match_state.instruction_position = instruction_position;
+        auto& opcode = m_bytecode.get_opcode(match_state);
+        add_closure(positions, instruction_position + opcode.size(), false, false, accepting);
+    }
+
+    // An unanchored search may also start a new match after this code unit.
+    if (unanchored)
+        add_closure(positions, 0, false, false, accepting);
+
+    auto next = intern_state(move(positions), false, unanchored, accepting);
+    if (m_has_given_up)
+        return dead_state;
+
+    // Note: interning may have grown m_states, so the state has to be looked up again.
+    if (code_unit < 128)
+        m_states[state_index].ascii_transitions[code_unit] = next;
+    else
+        m_states[state_index].other_transitions.set(code_unit, next);
+    return next;
+}
+
+template<typename Input>
+LazyDFA::RunResult LazyDFA::run(Input const& input, u32 state_index, size_t from, size_t& position)
+{
+    if (m_has_given_up)
+        return RunResult::GaveUp;
+
+    auto length = input.length();
+    // The unanchored start state for positions after the first one.
+    auto restart_state = m_start_states[2].value_or(dead_state);
+
+    for (position = from;; ++position) {
+        if (state_index == dead_state)
+            return RunResult::Rejected;
+
+        auto const& state = m_states[state_index];
+        if (state.accepting)
+            return RunResult::Accepted;
+        if (position >= length)
+            return state.accepting_at_end ? RunResult::Accepted : RunResult::Rejected;
+
+        // Nothing is in progress, so skip ahead to the next place a match could start.
+        if (m_required_first_code_unit.has_value() && state_index == restart_state) {
+            auto next_position = input.find(*m_required_first_code_unit, position);
+            if (!next_position.has_value())
+                return RunResult::Rejected;
+            position = *next_position;
+        }
+
+        auto code_unit = input.at(position);
+        if (!code_unit.has_value())
+            return RunResult::GaveUp;
+
+        state_index = transition(state_index, *code_unit);
+        if (m_has_given_up)
+            return RunResult::GaveUp;
+    }
+}
+
+template<typename Input>
+Optional<size_t> LazyDFA::find_possible_match_start_impl(Input const& input, size_t from)
+{
+    // Make sure the state the unanchored search keeps returning to exists, so run() can recognise it.
+    start_state(false, true);
+
+    size_t end = 0;
+    switch (run(input, start_state(from == 0, true), from, end)) {
+    case RunResult::Rejected:
+        return {};
+    case RunResult::GaveUp:
+        return from;
+    case RunResult::Accepted:
+        break;
+    }
+
+    // The earliest match to end does so at `end`, so the leftmost match starts at or before it.
+    for (auto position = from; position < end; ++position) {
+        size_t ignored = 0;
+        if (run(input, start_state(position == 0, false), position, ignored) != RunResult::Rejected)
+            return position;
+    }
+    return end;
+}
+
+Optional<size_t> LazyDFA::find_possible_match_start(RegexStringView const& view, size_t from)
+{
+    if (m_has_given_up)
+        return from;
+    return with_input(view, [&](auto const& input) { return find_possible_match_start_impl(input, from); });
+}
+
+bool LazyDFA::may_match_at(RegexStringView const& view, size_t position)
+{
+    if (m_has_given_up)
+        return true;
+    return with_input(view, [&](auto const& input) {
+        size_t ignored = 0;
+        return run(input, start_state(position == 0, false), position, ignored) != RunResult::Rejected;
+    });
+}
+
+}
@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2026, agent <agent@local>
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include "RegexByteCode.h"
+#include "RegexMatch.h"
+#include "RegexOptions.h"
+
+#include <AK/Array.h>
+#include <AK/HashMap.h>
+#include <AK/NumericLimits.h>
+#include <AK/Optional.h>
+#include <AK/Vector.h>
+
+namespace regex {
+
+struct DFAStateKey {
+    Vector<u64> positions;
+    bool at_begin { false };
+    bool unanchored { false };
+    bool accepting { false };
+
+    bool operator==(DFAStateKey const&) const = default;
+};
+
+}
+
+template<>
+struct AK::Traits<regex::DFAStateKey> : public DefaultTraits<regex::DFAStateKey> {
+    static unsigned hash(regex::DFAStateKey const& key)
+    {
+        unsigned hash = (key.at_begin ? 1 : 0) | (key.unanchored ? 2 : 0) | (key.accepting ? 4 : 0);
+        for (auto position : key.positions)
+            hash = pair_int_hash(hash, u64_hash(position));
+        return hash;
+    }
+};
+
+namespace regex {
+
+// A DFA over the character-consuming instructions of a pattern, built lazily one transition at a time.
+// The matcher uses it to find the positions a match can start at, and only runs the backtracking VM there.
+// The automaton ignores anything it can't express (word boundaries, the empty-loop checks of JumpNonEmpty),
+// so it may report a possible match where the VM finds none, but never the other way around.
+class LazyDFA {
+public:
+    static bool is_supported(ByteCode const&);
+    static bool can_be_used_with(AllOptions);
+    static bool can_be_used_with(RegexStringView const&);
+
+    LazyDFA(ByteCode const&, AllOptions);
+
+    AllOptions options() const { return m_options; }
+    bool has_given_up() const { return m_has_given_up; }
+
+    // Returns the first position at or after `from` at which a match may start, or nothing if none can.
+    Optional<size_t> find_possible_match_start(RegexStringView const&, size_t from);
+
+    // Returns false if no match can start at `position`.
+    bool may_match_at(RegexStringView const&, size_t position);
+
+private:
+    // NFA positions are encoded as (instruction position << 16) | index, where index is the number of code units
+    // of a String compare that have already been matched, or pending_end_check for a CheckEnd.
+    static constexpr u64 pending_end_check = 0xffff;
+    static constexpr u32 dead_state = 0;
+    static constexpr u32 unknown_transition = NumericLimits<u32>::max();
+    static constexpr size_t max_state_count = 1024;
+
+    struct CompareInfo {
+        bool is_string { false };
+        Vector<u32> string;
+        Optional<u32> single_char;
+    };
+
+    struct State {
+        Vector<u64> positions;
+        bool unanchored { false };
+        bool accepting { false };
+        bool accepting_at_end { false };
+        Array<u32, 128> ascii_transitions;
+        HashMap<u32, u32> other_transitions;
+    };
+
+    enum class RunResult : u8 {
+        Accepted,
+        Rejected,
+        GaveUp,
+    };
+
+    static Optional<CompareInfo> compare_info(ByteCode const&, size_t instruction_position);
+
+    template<typename Input>
+    RunResult run(Input const&, u32 state_index, size_t from, size_t& position);
+    template<typename Input>
+    Optional<size_t> find_possible_match_start_impl(Input const&, size_t from);
+
+    u32 start_state(bool at_begin, bool unanchored);
+    u32 transition(u32 state_index, u32 code_unit);
+    u32 intern_state(Vector<u64> positions, bool at_begin, bool unanchored, bool accepting);
+    void add_closure(Vector<u64>& positions, size_t instruction_position, bool at_begin, bool at_end, bool& accepting) const;
+    bool compare_matches(u64 position, u32 code_unit) const;
+
+    ByteCode const& m_bytecode;
+    AllOptions m_options;
+    HashMap<size_t, CompareInfo> m_compares;
+    Vector<State> m_states;
+    HashMap<DFAStateKey, u32> m_state_indices;
+    Array<Optional<u32>, 4> m_start_states;
+    Optional<u32> m_required_first_code_unit;
+    bool m_has_given_up { false };
+};
+
+}
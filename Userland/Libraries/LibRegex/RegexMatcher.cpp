@@ -185,6 +185,7 @@ RegexResult Matcher<Parser>::match(Vector<RegexStringView> const& views, Optiona
 
     auto single_match_only = input.regex_options.has_flag_set(AllFlags::SingleMatch);
     auto only_start_of_line = m_pattern->parser_result.optimization_data.only_start_of_line && !input.regex_options.has_flag_set(AllFlags::Multiline);
+    auto can_skip_ahead = continue_search && !only_start_of_line;
 
     for (auto const& view : views) {
         if (lines_to_skip != 0) {
@@ -232,10 +233,22 @@ RegexResult Matcher<Parser>::match(Vector<RegexStringView> const& views, Optiona
             }
         }
 
+        auto* dfa = dfa_for(input);
+
         for (; view_index <= view_length; ++view_index) {
             if (view_index == view_length && input.regex_options.has_flag_set(AllFlags::Multiline))
                 break;
 
+            // Let the DFA rule out positions before running the VM on them.
+            if (dfa && can_skip_ahead) {
+                auto next_index = dfa->find_possible_match_start(view, view_index);
+                if (!next_index.has_value())
+                    break;
+                view_index = *next_index;
+            } else if (dfa && !dfa->may_match_at(view, view_index)) {
+                break;
+            }
+
             auto& match_length_minimum = m_pattern->parser_result.match_length_minimum;
             // FIXME: More performant would be to know the remaining minimum string
             //        length needed to match from the current position onwards within
@@ -417,6 +430,24 @@ private:
     Node* m_last { nullptr };
 };
 
+template<class Parser>
+LazyDFA* Matcher<Parser>::dfa_for(MatchInput const& input) const
+{
+    auto const& parser_result = m_pattern->parser_result;
+    if (!parser_result.optimization_data.can_use_dfa || parser_result.optimization_data.pure_substring_search.has_value())
+        return nullptr;
+
+    if (!LazyDFA::can_be_used_with(input.regex_options) || !LazyDFA::can_be_used_with(input.view))
+        return nullptr;
+
+    if (!m_dfa || m_dfa->options().value() != input.regex_options.value())
+        m_dfa = make<LazyDFA>(parser_result.bytecode, input.regex_options);
+
+    if (m_dfa->has_given_up())
+        return nullptr;
+    return m_dfa.ptr();
+}
+
 template<class Parser>
 bool Matcher<Parser>::execute(MatchInput const& input, MatchState& state, size_t& operations) const
 {
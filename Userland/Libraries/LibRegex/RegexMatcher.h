@@ -7,6 +7,7 @@
 #pragma once
 
 #include "RegexByteCode.h"
+#include "RegexDFA.h"
 #include "RegexMatch.h"
 #include "RegexOptions.h"
 #include "RegexParser.h"
@@ -70,13 +71,16 @@ public:
     void reset_pattern(Badge<Regex<Parser>>, Regex<Parser> const* pattern)
     {
         m_pattern = pattern;
+        m_dfa = nullptr;
     }
 
 private:
     bool execute(MatchInput const& input, MatchState& state, size_t& operations) const;
+    LazyDFA* dfa_for(MatchInput const& input) const;
 
     Regex<Parser> const* m_pattern;
     typename ParserTraits<Parser>::OptionsType const m_regex_options;
+    mutable OwnPtr<LazyDFA> m_dfa;
 };
 
 template<class Parser>
@@ -26,6 +26,11 @@ using Detail::Block;
 template<typename Parser>
 void Regex<Parser>::run_optimization_passes()
 {
+    // Results that were optimized before (e.g. ones shared through a cache) must not be rewritten again.
+    if (parser_result.optimization_data.has_run_optimization_passes)
+        return;
+    parser_result.optimization_data.has_run_optimization_passes = true;
+
     parser_result.bytecode.flatten();
 
     auto blocks = split_basic_blocks(parser_result.bytecode);
@@ -43,6 +48,9 @@ void Regex<Parser>::run_optimization_passes()
         parser_result.optimization_data.only_start_of_line = true;
 
     parser_result.bytecode.flatten();
+
+    // Patterns without lookarounds, backreferences or counted repetitions can be prefiltered with a DFA.
+    parser_result.optimization_data.can_use_dfa = LazyDFA::is_supported(parser_result.bytecode);
 }
 
 template<typename Parser>
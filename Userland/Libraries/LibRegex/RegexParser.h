@@ -59,6 +59,8 @@ public:
         struct {
             Optional<ByteString> pure_substring_search;
             bool only_start_of_line = false;
+            bool can_use_dfa = false;
+            bool has_run_optimization_passes = false;
         } optimization_data {};
     };
 
@@ -8,6 +8,9 @@
 
 #include <LibCore/ArgsParser.h>
 #include <LibFileSystem/FileSystem.h>
+#include <LibJS/Bytecode/ExecutableCache.h>
+#include <LibJS/Bytecode/PassManager.h>
+#include <LibJS/JIT/Compiler.h>
 #include <LibTest/JavaScriptTestRunner.h>
 #include <signal.h>
 #include <stdio.h>
@@ -87,6 +90,9 @@ int main(int argc, char** argv)
     bool print_progress = false;
     bool print_json = false;
     bool per_file = false;
+    bool disable_bytecode_optimizations = false;
+    bool disable_jit = false;
+    bool disable_lazy_parsing = false;
     StringView specified_test_root;
     ByteString common_path;
     ByteString test_glob;
@@ -113,6 +119,11 @@ int main(int argc, char** argv)
     args_parser.add_option(per_file, "Show detailed per-file results as JSON (implies -j)", "per-file");
     args_parser.add_option(g_collect_on_every_allocation, "Collect garbage after every allocation", "collect-often", 'g');
     args_parser.add_option(JS::Bytecode::g_dump_bytecode, "Dump the bytecode", "dump-bytecode", 'd');
+    args_parser.add_option(disable_bytecode_optimizations, "Don't run the bytecode optimization passes", "disable-bytecode-optimizations", {});
+    args_parser.add_option(disable_jit, "Don't compile hot bytecode to native code", "disable-jit", {});
+    args_parser.add_option(JS::JIT::g_jit_threshold, "Number of calls or loop iterations after which bytecode is compiled to native code", "jit-threshold", {}, "count");
+    args_parser.add_option(disable_lazy_parsing, "Parse function bodies right away instead of when they are first called", "disable-lazy-parsing", {});
+    args_parser.add_option(JS::Bytecode::g_bytecode_cache_directory, "Keep the bytecode for scripts in the given directory, and reuse it when the same script is run again", "bytecode-cache", {}, "directory");
     args_parser.add_option(test_glob, "Only run tests matching the given glob", "filter", 'f', "glob");
     for (auto& entry : g_extra_args)
         args_parser.add_option(*entry.key, entry.value.get<0>().characters(), entry.value.get<1>().characters(), entry.value.get<2>());
@@ -120,9 +131,19 @@ int main(int argc, char** argv)
     args_parser.add_positional_argument(common_path, "Path to tests-common.js", "common-path", Core::ArgsParser::Required::No);
     args_parser.parse(arguments);
 
+    JS::g_lazy_function_parsing = !disable_lazy_parsing;
+
     if (per_file)
         print_json = true;
 
+    if (disable_bytecode_optimizations) {
+        for (size_t i = 0; i < to_underlying(JS::Bytecode::OptimizationPass::__Count); ++i)
+            JS::Bytecode::set_optimization_pass_enabled(static_cast<JS::Bytecode::OptimizationPass>(i), false);
+    }
+
+    if (disable_jit)
+        JS::JIT::g_jit_enabled = false;
+
     test_glob = ByteString::formatted("*{}*", test_glob);
 
     if (getenv("DISABLE_DBG_OUTPUT")) {
@@ -987,18 +987,22 @@ void KeyframeEffect::update_style_properties()
 
     auto invalidation = compute_required_invalidation(animated_properties_before_update, style->animated_property_values());
 
+    Layout::NodeWithStyle* layout_node = nullptr;
     if (!pseudo_element_type().has_value()) {
-        if (target->layout_node())
-            target->layout_node()->apply_style(*style);
+        layout_node = target->layout_node().ptr();
     } else {
         auto pseudo_element_node = target->get_pseudo_element_node(pseudo_element_type().value());
-        if (auto* node_with_style = dynamic_cast<Layout::NodeWithStyle*>(pseudo_element_node.ptr())) {
-            node_with_style->apply_style(*style);
-        }
+        layout_node = dynamic_cast<Layout::NodeWithStyle*>(pseudo_element_node.ptr());
+    }
+    if (layout_node)
+        layout_node->apply_style(*style);
+
+    if (invalidation.relayout) {
+        if (layout_node)
+            layout_node->set_needs_layout();
+        else
+            document.set_needs_layout();
     }
-
-    if (invalidation.relayout)
-        document.set_needs_layout();
     if (invalidation.rebuild_layout_tree)
         document.invalidate_layout_tree();
     if (invalidation.repaint)
@@ -342,18 +342,18 @@ StyleComputer::RuleCache const& StyleComputer::rule_cache_for_cascade_origin(Cas
     return true;
 }
 
-bool StyleComputer::should_reject_with_ancestor_filter(Selector const& selector) const
+bool StyleComputer::should_reject_with_ancestor_filter(AncestorFilter const& ancestor_filter, Selector const& selector)
 {
     for (u32 hash : selector.ancestor_hashes()) {
         if (hash == 0)
             break;
-        if (!m_ancestor_filter.may_contain(hash))
+        if (!ancestor_filter.may_contain(hash))
             return true;
     }
     return false;
 }
 
-Vector<MatchingRule> StyleComputer::collect_matching_rules(DOM::Element const& element, CascadeOrigin cascade_origin, Optional<CSS::Selector::PseudoElement::Type> pseudo_element, FlyString const& qualified_layer_name) const
+Vector<MatchingRule> StyleComputer::collect_matching_rules(DOM::Element const& element, CascadeOrigin cascade_origin, Optional<CSS::Selector::PseudoElement::Type> pseudo_element, FlyString const& qualified_layer_name, AncestorFilter const* ancestor_filter) const
 {
     auto const& root_node = element.root();
     auto shadow_root = is<DOM::ShadowRoot>(root_node) ? static_cast<DOM::ShadowRoot const*>(&root_node) : nullptr;
@@ -434,7 +434,7 @@ Vector<MatchingRule> StyleComputer::collect_matching_rules(DOM::Element const& e
         }
 
         auto const& selector = rule_to_run.rule->selectors()[rule_to_run.selector_index];
-        if (should_reject_with_ancestor_filter(*selector)) {
+        if (ancestor_filter && should_reject_with_ancestor_filter(*ancestor_filter, *selector)) {
             rule_to_run.skip = true;
             continue;
         }
@@ -1429,25 +1429,28 @@ void StyleComputer::start_needed_transitions(StyleProperties const& previous_sty
 
 // https://www.w3.org/TR/css-cascade/#cascading
 // https://drafts.csswg.org/css-cascade-5/#layering
-void StyleComputer::compute_cascaded_values(StyleProperties& style, DOM::Element& element, Optional<CSS::Selector::PseudoElement::Type> pseudo_element, bool& did_match_any_pseudo_element_rules, ComputeStyleMode mode) const
+StyleComputer::MatchingRuleSet StyleComputer::collect_matching_rule_set(DOM::Element const& element, Optional<CSS::Selector::PseudoElement::Type> pseudo_element, AncestorFilter const* ancestor_filter) const
 {
-    // First, we collect all the CSS rules whose selectors match `element`:
     MatchingRuleSet matching_rule_set;
-    matching_rule_set.user_agent_rules = collect_matching_rules(element, CascadeOrigin::UserAgent, pseudo_element);
+    matching_rule_set.user_agent_rules = collect_matching_rules(element, CascadeOrigin::UserAgent, pseudo_element, {}, ancestor_filter);
     sort_matching_rules(matching_rule_set.user_agent_rules);
-    matching_rule_set.user_rules = collect_matching_rules(element, CascadeOrigin::User, pseudo_element);
+    matching_rule_set.user_rules = collect_matching_rules(element, CascadeOrigin::User, pseudo_element, {}, ancestor_filter);
     sort_matching_rules(matching_rule_set.user_rules);
     // @layer-ed author rules
     for (auto const& layer_name : m_qualified_layer_names_in_order) {
-        auto layer_rules = collect_matching_rules(element, CascadeOrigin::Author, pseudo_element, layer_name);
+        auto layer_rules = collect_matching_rules(element, CascadeOrigin::Author, pseudo_element, layer_name, ancestor_filter);
         sort_matching_rules(layer_rules);
         matching_rule_set.author_rules.append({ layer_name, layer_rules });
     }
     // Un-@layer-ed author rules
-    auto unlayered_author_rules = collect_matching_rules(element, CascadeOrigin::Author, pseudo_element);
+    auto unlayered_author_rules = collect_matching_rules(element, CascadeOrigin::Author, pseudo_element, {}, ancestor_filter);
     sort_matching_rules(unlayered_author_rules);
     matching_rule_set.author_rules.append({ {}, unlayered_author_rules });
+    return matching_rule_set;
+}
 
+void StyleComputer::compute_cascaded_values(StyleProperties& style, DOM::Element& element, Optional<CSS::Selector::PseudoElement::Type> pseudo_element, MatchingRuleSet const& matching_rule_set, bool& did_match_any_pseudo_element_rules, ComputeStyleMode mode) const
+{
     if (mode == ComputeStyleMode::CreatePseudoElementStyleIfNeeded) {
         VERIFY(pseudo_element.has_value());
         if (matching_rule_set.author_rules.is_empty() && matching_rule_set.user_rules.is_empty() && matching_rule_set.user_agent_rules.is_empty()) {
@@ -2271,24 +2274,24 @@ NonnullRefPtr<StyleProperties> StyleComputer::create_document_style() const
     return style;
 }
 
-NonnullRefPtr<StyleProperties> StyleComputer::compute_style(DOM::Element& element, Optional<CSS::Selector::PseudoElement::Type> pseudo_element) const
+NonnullRefPtr<StyleProperties> StyleComputer::compute_style(DOM::Element& element, Optional<CSS::Selector::PseudoElement::Type> pseudo_element, AncestorFilter const* ancestor_filter) const
 {
-    return compute_style_impl(element, move(pseudo_element), ComputeStyleMode::Normal).release_nonnull();
+    return compute_style_impl(element, move(pseudo_element), ComputeStyleMode::Normal, ancestor_filter).release_nonnull();
 }
 
-RefPtr<StyleProperties> StyleComputer::compute_pseudo_element_style_if_needed(DOM::Element& element, Optional<CSS::Selector::PseudoElement::Type> pseudo_element) const
+RefPtr<StyleProperties> StyleComputer::compute_pseudo_element_style_if_needed(DOM::Element& element, Optional<CSS::Selector::PseudoElement::Type> pseudo_element, AncestorFilter const* ancestor_filter) const
 {
-    return compute_style_impl(element, move(pseudo_element), ComputeStyleMode::CreatePseudoElementStyleIfNeeded);
+    return compute_style_impl(element, move(pseudo_element), ComputeStyleMode::CreatePseudoElementStyleIfNeeded, ancestor_filter);
 }
 
-RefPtr<StyleProperties> StyleComputer::compute_style_impl(DOM::Element& element, Optional<CSS::Selector::PseudoElement::Type> pseudo_element, ComputeStyleMode mode) const
+RefPtr<StyleProperties> StyleComputer::compute_style_impl(DOM::Element& element, Optional<CSS::Selector::PseudoElement::Type> pseudo_element, ComputeStyleMode mode, AncestorFilter const* ancestor_filter) const
 {
     build_rule_cache_if_needed();
 
     // Special path for elements that use pseudo element as style selector
     if (element.use_pseudo_element().has_value()) {
         auto& parent_element = verify_cast<HTML::HTMLElement>(*element.root().parent_or_shadow_host());
-        auto style = compute_style(parent_element, *element.use_pseudo_element());
+        auto style = compute_style(parent_element, *element.use_pseudo_element(), ancestor_filter);
 
         // Merge back inline styles
         if (element.has_attribute(HTML::AttributeNames::style)) {
@@ -2301,10 +2304,41 @@ RefPtr<StyleProperties> StyleComputer::compute_style_impl(DOM::Element& element,
 
     ScopeGuard guard { [&element]() { element.set_needs_style_update(false); } };
 
+    bool const can_reuse_style = mode == ComputeStyleMode::Normal && !pseudo_element.has_value() && can_reuse_style_for_element(element);
+    if (can_reuse_style)
+        ++m_style_sharing_statistics.elements_considered;
+
+    // OPTIMIZATION: An earlier sibling that's indistinguishable from this element as far as selectors go, has the same style.
+    if (can_reuse_style) {
+        if (auto const* sibling = find_sibling_to_share_style_with(element)) {
+            ++m_style_sharing_statistics.shared_with_sibling;
+            element.set_custom_properties({}, sibling->custom_properties({}));
+            auto style = sibling->computed_css_values()->clone();
+            compute_transitions_for_reused_style(style, element);
+            return style;
+        }
+    }
+
+    // First, we collect all the CSS rules whose selectors match `element`:
+    auto matching_rule_set = collect_matching_rule_set(element, pseudo_element, ancestor_filter);
+
+    // OPTIMIZATION: Elements with the same parent, tag name and attributes that matched the same rules, have the same style.
+    Optional<MatchedPropertiesCacheKey> matched_properties_cache_key;
+    if (can_reuse_style && m_matched_properties_cache_enabled) {
+        matched_properties_cache_key = make_matched_properties_cache_key(element, matching_rule_set);
+        if (auto it = m_matched_properties_cache.find(*matched_properties_cache_key); it != m_matched_properties_cache.end()) {
+            ++m_style_sharing_statistics.matched_properties_cache_hits;
+            element.set_custom_properties({}, it->value.custom_properties);
+            auto style = it->value.style->clone();
+            compute_transitions_for_reused_style(style, element);
+            return style;
+        }
+    }
+
     auto style = StyleProperties::create();
     // 1. Perform the cascade. This produces the "specified style"
     bool did_match_any_pseudo_element_rules = false;
-    compute_cascaded_values(style, element, pseudo_element, did_match_any_pseudo_element_rules, mode);
+    compute_cascaded_values(style, element, pseudo_element, matching_rule_set, did_match_any_pseudo_element_rules, mode);
 
     if (mode == ComputeStyleMode::CreatePseudoElementStyleIfNeeded) {
         // NOTE: If we're computing style for a pseudo-element, we look for a number of reasons to bail early.
@@ -2356,6 +2390,13 @@ RefPtr<StyleProperties> StyleComputer::compute_style_impl(DOM::Element& element,
     // 8. Let the element adjust computed style
     element.adjust_computed_style(style);
 
+    // NOTE: Elements with CSS animations need their own style, as the cascade is what starts the animations.
+    if (matched_properties_cache_key.has_value() && !style->animation_name_source()) {
+        if (m_matched_properties_cache.size() >= max_matched_properties_cache_size)
+            m_matched_properties_cache.clear();
+        m_matched_properties_cache.set(matched_properties_cache_key.release_value(), MatchedPropertiesCacheEntry { style->clone(), element.custom_properties({}) });
+    }
+
     // 9. Transition declarations [css-transitions-1]
     // Theoretically this should be part of the cascade, but it works with computed values, which we don't have until now.
     compute_transitioned_properties(style, element, pseudo_element);
@@ -2366,6 +2407,156 @@ RefPtr<StyleProperties> StyleComputer::compute_style_impl(DOM::Element& element,
     return style;
 }
 
+bool StyleComputer::can_reuse_style_for_element(DOM::Element const& element) const
+{
+    // NOTE: Inline style and animations are specific to a single element, and a shadow host matches rules from its own
+    //       shadow tree. An element that's styled as a pseudo-element (e.g. a placeholder or a slider thumb) gets its
+    //       style from a different element. The root element has no siblings or parent to share with anyway.
+    if (element.inline_style() || element.is_shadow_host() || element.has_associated_animations() || element.use_pseudo_element().has_value())
+        return false;
+    if (element.cached_animation_name_animation({}))
+        return false;
+    auto const* parent = element.parent_or_shadow_host_element();
+    return parent && parent->computed_css_values();
+}
+
+static bool have_same_attributes(DOM::Element const& element, DOM::Element const& other)
+{
+    if (element.attribute_list_size() != other.attribute_list_size())
+        return false;
+
+    bool same_attributes = true;
+    element.for_each_attribute([&](DOM::Attr const& attribute) {
+        if (!same_attributes)
+            return;
+        auto other_attribute = other.get_attribute_node_ns(attribute.namespace_uri(), attribute.local_name());
+        same_attributes = other_attribute && other_attribute->value() == attribute.value();
+    });
+    return same_attributes;
+}
+
+// NOTE: The rules are looked up by the element's id, classes and tag name, and visited in the same order every time,
+//       so that the results for the element and its candidate siblings can be compared one by one.
+template<typename Callback>
+void StyleComputer::for_each_sibling_dependent_rule(DOM::Element const& element, Callback callback) const
+{
+    auto for_each_rule_in = [&](Vector<MatchingRule> const& rules) {
+        for (auto const& rule : rules)
+            callback(rule);
+    };
+
+    for (auto const* rule_cache : { m_user_agent_rule_cache.ptr(), m_user_rule_cache.ptr(), m_author_rule_cache.ptr() }) {
+        auto const& rules = rule_cache->sibling_dependent_rules;
+        for (auto const& class_name : element.class_names()) {
+            if (auto it = rules.rules_by_class.find(class_name); it != rules.rules_by_class.end())
+                for_each_rule_in(it->value);
+        }
+        if (auto id = element.id(); id.has_value()) {
+            if (auto it = rules.rules_by_id.find(id.value()); it != rules.rules_by_id.end())
+                for_each_rule_in(it->value);
+        }
+        if (auto it = rules.rules_by_tag_name.find(element.local_name()); it != rules.rules_by_tag_name.end())
+            for_each_rule_in(it->value);
+        for_each_rule_in(rules.other_rules);
+    }
+}
+
+DOM::Element const* StyleComputer::find_sibling_to_share_style_with(DOM::Element const& element) const
+{
+    auto const& root_node = element.root();
+    JS::GCPtr<DOM::Element const> shadow_host;
+    if (is<DOM::ShadowRoot>(root_node))
+        shadow_host = static_cast<DOM::ShadowRoot const&>(root_node).host();
+
+    // NOTE: Rules that could match one sibling but not the other are matched against the element once, and against each
+    //       candidate. Everything else in a selector only looks at the element's tag name, attributes and ancestors.
+    //       Candidates have the same tag name and attributes as the element, so the rules are looked up for the element.
+    Optional<Vector<bool>> element_matches_sibling_dependent_rules;
+    auto matches_sibling_dependent_rules_like_element = [&](DOM::Element const& candidate) {
+        if (!element_matches_sibling_dependent_rules.has_value()) {
+            element_matches_sibling_dependent_rules = Vector<bool> {};
+            for_each_sibling_dependent_rule(element, [&](MatchingRule const& rule) {
+                auto const& selector = rule.rule->selectors()[rule.selector_index];
+                element_matches_sibling_dependent_rules->append(SelectorEngine::matches(selector, *rule.sheet, element, shadow_host));
+            });
+        }
+
+        size_t rule_index = 0;
+        bool matches_like_element = true;
+        for_each_sibling_dependent_rule(element, [&](MatchingRule const& rule) {
+            if (!matches_like_element)
+                return;
+            auto const& selector = rule.rule->selectors()[rule.selector_index];
+            matches_like_element = SelectorEngine::matches(selector, *rule.sheet, candidate, shadow_host) == element_matches_sibling_dependent_rules->at(rule_index++);
+        });
+        return matches_like_element;
+    };
+
+    size_t candidate_count = 0;
+    for (auto const* candidate = element.previous_element_sibling(); candidate && candidate_count < max_style_sharing_candidates; candidate = candidate->previous_element_sibling(), ++candidate_count) {
+        auto const* candidate_style = candidate->computed_css_values();
+        if (!candidate_style || candidate->needs_style_update())
+            continue;
+        if (candidate->local_name() != element.local_name() || candidate->namespace_uri() != element.namespace_uri())
+            continue;
+        if (!can_reuse_style_for_element(*candidate))
+            continue;
+        if (candidate_style->animation_name_source())
+            continue;
+        if (!have_same_attributes(element, *candidate))
+            continue;
+        if (!matches_sibling_dependent_rules_like_element(*candidate))
+            continue;
+        return candidate;
+    }
+    return nullptr;
+}
+
+StyleComputer::MatchedPropertiesCacheKey StyleComputer::make_matched_properties_cache_key(DOM::Element const& element, MatchingRuleSet const& matching_rule_set) const
+{
+    MatchedPropertiesCacheKey key {
+        .parent_style = *element.parent_or_shadow_host_element()->computed_css_values(),
+        .local_name = element.local_name(),
+        .namespace_uri = element.namespace_uri(),
+    };
+
+    u32 hash = pair_int_hash(ptr_hash(key.parent_style.ptr()), key.local_name.hash());
+
+    element.for_each_attribute([&](DOM::Attr const& attribute) {
+        key.attributes.append({ attribute.name(), attribute.value() });
+        hash = pair_int_hash(hash, pair_int_hash(attribute.name().hash(), attribute.value().hash()));
+    });
+
+    auto add_rules = [&](Vector<MatchingRule> const& rules) {
+        for (auto const& rule : rules) {
+            key.rules.append({ rule.rule.ptr(), rule.selector_index });
+            hash = pair_int_hash(hash, pair_int_hash(ptr_hash(rule.rule.ptr()), rule.selector_index));
+        }
+        // NOTE: Rules from different origins and layers cascade differently, so keep them apart.
+        key.rules.append({ nullptr, 0 });
+    };
+    add_rules(matching_rule_set.user_agent_rules);
+    add_rules(matching_rule_set.user_rules);
+    for (auto const& layer : matching_rule_set.author_rules)
+        add_rules(layer.rules);
+
+    key.precomputed_hash = hash;
+    return key;
+}
+
+void StyleComputer::compute_transitions_for_reused_style(StyleProperties& style, DOM::Element& element) const
+{
+    compute_transitioned_properties(style, element, {});
+    if (auto const* previous_style = element.computed_css_values())
+        start_needed_transitions(*previous_style, style, element, {});
+}
+
+void StyleComputer::set_matched_properties_cache_enabled(bool enabled)
+{
+    m_matched_properties_cache_enabled = enabled;
+    m_matched_properties_cache.clear();
+}
+
 void StyleComputer::build_rule_cache_if_needed() const
 {
     if (m_author_rule_cache && m_user_rule_cache && m_user_agent_rule_cache)
@@ -2409,6 +2600,147 @@ static Optional<SimplifiedSelectorForBucketing> is_roundabout_selector_bucketabl
     return {};
 }
 
+// Whether two sibling elements with the same tag name and attributes could disagree on matching the selector.
+static bool selector_may_match_siblings_differently(CSS::Selector const& selector)
+{
+    for (auto const& compound_selector : selector.compound_selectors()) {
+        if (compound_selector.combinator != CSS::Selector::Combinator::None
+            && compound_selector.combinator != CSS::Selector::Combinator::Descendant
+            && compound_selector.combinator != CSS::Selector::Combinator::ImmediateChild)
+            return true;
+
+        for (auto const& simple_selector : compound_selector.simple_selectors) {
+            if (simple_selector.type != CSS::Selector::SimpleSelector::Type::PseudoClass)
+                continue;
+            auto const& pseudo_class = simple_selector.pseudo_class();
+            switch (pseudo_class.type) {
+            case CSS::PseudoClass::Host:
+            case CSS::PseudoClass::Is:
+            case CSS::PseudoClass::Not:
+            case CSS::PseudoClass::Where:
+                for (auto const& argument_selector : pseudo_class.argument_selector_list) {
+                    if (selector_may_match_siblings_differently(*argument_selector))
+                        return true;
+                }
+                break;
+            case CSS::PseudoClass::AnyLink:
+            case CSS::PseudoClass::Lang:
+            case CSS::PseudoClass::Link:
+            case CSS::PseudoClass::LocalLink:
+            case CSS::PseudoClass::Root:
+            case CSS::PseudoClass::Scope:
+            case CSS::PseudoClass::Visited:
+                break;
+            default:
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+static bool pseudo_class_depends_on_attributes(CSS::PseudoClass pseudo_class)
+{
+    switch (pseudo_class) {
+    case CSS::PseudoClass::Active:
+    case CSS::PseudoClass::Empty:
+    case CSS::PseudoClass::FirstChild:
+    case CSS::PseudoClass::FirstOfType:
+    case CSS::PseudoClass::Focus:
+    case CSS::PseudoClass::FocusVisible:
+    case CSS::PseudoClass::FocusWithin:
+    case CSS::PseudoClass::Has:
+    case CSS::PseudoClass::Host:
+    case CSS::PseudoClass::Hover:
+    case CSS::PseudoClass::Is:
+    case CSS::PseudoClass::LastChild:
+    case CSS::PseudoClass::LastOfType:
+    case CSS::PseudoClass::Not:
+    case CSS::PseudoClass::NthChild:
+    case CSS::PseudoClass::NthLastChild:
+    case CSS::PseudoClass::NthLastOfType:
+    case CSS::PseudoClass::NthOfType:
+    case CSS::PseudoClass::OnlyChild:
+    case CSS::PseudoClass::OnlyOfType:
+    case CSS::PseudoClass::Root:
+    case CSS::PseudoClass::Scope:
+    case CSS::PseudoClass::Where:
+        return false;
+    default:
+        return true;
+    }
+}
+
+void StyleComputer::collect_invalidation_scopes(RuleCache& rule_cache, Selector const& selector, StyleInvalidationScope const& scope_of_subject)
+{
+    auto const& compound_selectors = selector.compound_selectors();
+    for (size_t i = 0; i < compound_selectors.size(); ++i) {
+        // Work out where the subjects of the selector are, relative to an element matching this compound selector.
+        // Only the combinator right after it matters: everything past a child or descendant combinator is inside the
+        // element's subtree, and everything past a sibling combinator is inside the subtree of a later sibling.
+        StyleInvalidationScope scope;
+        if (i == compound_selectors.size() - 1) {
+            scope = scope_of_subject;
+        } else {
+            switch (compound_selectors[i + 1].combinator) {
+            case CSS::Selector::Combinator::ImmediateChild:
+            case CSS::Selector::Combinator::Descendant:
+                scope.invalidate_descendants = true;
+                break;
+            case CSS::Selector::Combinator::NextSibling:
+            case CSS::Selector::Combinator::SubsequentSibling:
+                scope.invalidate_subsequent_siblings = true;
+                break;
+            case CSS::Selector::Combinator::None:
+            case CSS::Selector::Combinator::Column:
+                scope.invalidate_document = true;
+                break;
+            }
+            scope.invalidate_document |= scope_of_subject.invalidate_document;
+        }
+
+        for (auto const& simple_selector : compound_selectors[i].simple_selectors) {
+            switch (simple_selector.type) {
+            case CSS::Selector::SimpleSelector::Type::Id:
+                rule_cache.invalidation_scopes_by_id.ensure(simple_selector.name()) |= scope;
+                break;
+            case CSS::Selector::SimpleSelector::Type::Class:
+                rule_cache.invalidation_scopes_by_class.ensure(simple_selector.name()) |= scope;
+                break;
+            case CSS::Selector::SimpleSelector::Type::Attribute:
+                rule_cache.invalidation_scopes_by_attribute_name.ensure(simple_selector.attribute().qualified_name.name.lowercase_name) |= scope;
+                break;
+            case CSS::Selector::SimpleSelector::Type::PseudoClass: {
+                auto const& pseudo_class = simple_selector.pseudo_class();
+                if (pseudo_class_depends_on_attributes(pseudo_class.type)) {
+                    // NOTE: Some of these (like :lang() or :disabled) also look at the attributes of ancestors.
+                    auto scope_for_any_attribute = scope;
+                    scope_for_any_attribute.invalidate_descendants = true;
+                    rule_cache.invalidation_scope_for_any_attribute |= scope_for_any_attribute;
+                }
+
+                // The argument selectors of :is(), :where(), :not() and :host() are matched against the same element
+                // as this compound selector. Those of :has() and `:nth-child(An+B of S)` are matched against other
+                // elements, which could be anywhere before this one in the tree.
+                auto scope_of_arguments = scope;
+                if (pseudo_class.type == CSS::PseudoClass::Has
+                    || pseudo_class.type == CSS::PseudoClass::NthChild
+                    || pseudo_class.type == CSS::PseudoClass::NthLastChild) {
+                    scope_of_arguments = { .invalidate_document = true };
+                }
+                for (auto const& argument_selector : pseudo_class.argument_selector_list)
+                    collect_invalidation_scopes(rule_cache, *argument_selector, scope_of_arguments);
+                break;
+            }
+            case CSS::Selector::SimpleSelector::Type::Universal:
+            case CSS::Selector::SimpleSelector::Type::TagName:
+            case CSS::Selector::SimpleSelector::Type::PseudoElement:
+                break;
+            }
+        }
+    }
+}
+
 NonnullOwnPtr<StyleComputer::RuleCache> StyleComputer::make_rule_cache_for_cascade_origin(CascadeOrigin cascade_origin)
 {
     auto rule_cache = make<RuleCache>();
@@ -2442,6 +2774,8 @@ NonnullOwnPtr<StyleComputer::RuleCache> StyleComputer::make_rule_cache_for_casca
                     false,
                 };
 
+                collect_invalidation_scopes(*rule_cache, selector, { .invalidate_self = true });
+
                 bool contains_root_pseudo_class = false;
                 Optional<CSS::Selector::PseudoElement::Type> pseudo_element;
 
@@ -2485,23 +2819,31 @@ NonnullOwnPtr<StyleComputer::RuleCache> StyleComputer::make_rule_cache_for_casca
                     }
                 }
 
+                bool const is_sibling_dependent = !matching_rule.contains_pseudo_element && selector_may_match_siblings_differently(selector);
+
                 // NOTE: We traverse the simple selectors in reverse order to make sure that class/ID buckets are preferred over tag buckets
                 //       in the common case of div.foo or div#foo selectors.
                 bool added_to_bucket = false;
 
                 auto add_to_id_bucket = [&](FlyString const& name) {
+                    if (is_sibling_dependent)
+                        rule_cache->sibling_dependent_rules.rules_by_id.ensure(name).append(matching_rule);
                     rule_cache->rules_by_id.ensure(name).append(move(matching_rule));
                     ++num_id_rules;
                     added_to_bucket = true;
                 };
 
                 auto add_to_class_bucket = [&](FlyString const& name) {
+                    if (is_sibling_dependent)
+                        rule_cache->sibling_dependent_rules.rules_by_class.ensure(name).append(matching_rule);
                     rule_cache->rules_by_class.ensure(name).append(move(matching_rule));
                     ++num_class_rules;
                     added_to_bucket = true;
                 };
 
                 auto add_to_tag_name_bucket = [&](FlyString const& name) {
+                    if (is_sibling_dependent)
+                        rule_cache->sibling_dependent_rules.rules_by_tag_name.ensure(name).append(matching_rule);
                     rule_cache->rules_by_tag_name.ensure(name).append(move(matching_rule));
                     ++num_tag_name_rules;
                     added_to_bucket = true;
@@ -2536,6 +2878,8 @@ NonnullOwnPtr<StyleComputer::RuleCache> StyleComputer::make_rule_cache_for_casca
                         }
                     }
                 }
+                if (!added_to_bucket && is_sibling_dependent)
+                    rule_cache->sibling_dependent_rules.other_rules.append(matching_rule);
                 if (!added_to_bucket) {
                     if (matching_rule.contains_pseudo_element) {
                         if (to_underlying(pseudo_element.value()) < to_underlying(CSS::Selector::PseudoElement::Type::KnownPseudoElementCount)) {
@@ -2699,9 +3043,48 @@ void StyleComputer::build_rule_cache()
     m_has_has_selectors = m_author_rule_cache->has_has_selectors || m_user_rule_cache->has_has_selectors || m_user_agent_rule_cache->has_has_selectors;
 }
 
+template<typename Callback>
+StyleInvalidationScope StyleComputer::invalidation_scope_from_rule_caches(Callback callback) const
+{
+    build_rule_cache_if_needed();
+
+    StyleInvalidationScope scope;
+    for (auto const* rule_cache : { m_author_rule_cache.ptr(), m_user_rule_cache.ptr(), m_user_agent_rule_cache.ptr() })
+        callback(*rule_cache, scope);
+    return scope;
+}
+
+StyleInvalidationScope StyleComputer::invalidation_scope_for_class(FlyString const& class_name) const
+{
+    return invalidation_scope_from_rule_caches([&](RuleCache const& rule_cache, StyleInvalidationScope& scope) {
+        if (auto it = rule_cache.invalidation_scopes_by_class.find(class_name); it != rule_cache.invalidation_scopes_by_class.end())
+            scope |= it->value;
+    });
+}
+
+StyleInvalidationScope StyleComputer::invalidation_scope_for_id(FlyString const& id) const
+{
+    return invalidation_scope_from_rule_caches([&](RuleCache const& rule_cache, StyleInvalidationScope& scope) {
+        if (auto it = rule_cache.invalidation_scopes_by_id.find(id); it != rule_cache.invalidation_scopes_by_id.end())
+            scope |= it->value;
+    });
+}
+
+StyleInvalidationScope StyleComputer::invalidation_scope_for_attribute(FlyString const& attribute_name) const
+{
+    return invalidation_scope_from_rule_caches([&](RuleCache const& rule_cache, StyleInvalidationScope& scope) {
+        if (auto it = rule_cache.invalidation_scopes_by_attribute_name.find(attribute_name); it != rule_cache.invalidation_scopes_by_attribute_name.end())
+            scope |= it->value;
+        // NOTE: None of the pseudo-classes look at classes.
+        if (attribute_name != HTML::AttributeNames::class_)
+            scope |= rule_cache.invalidation_scope_for_any_attribute;
+    });
+}
+
 void StyleComputer::invalidate_rule_cache()
 {
     m_author_rule_cache = nullptr;
+    m_matched_properties_cache.clear();
 
     // NOTE: We could be smarter about keeping the user rule cache, and style sheet.
     //       Currently we are re-parsing the user style sheet every time we build the caches,
@@ -2847,22 +3230,17 @@ static void for_each_element_hash(DOM::Element const& element, auto callback)
     });
 }
 
-void StyleComputer::reset_ancestor_filter()
-{
-    m_ancestor_filter.clear();
-}
-
-void StyleComputer::push_ancestor(DOM::Element const& element)
+void AncestorFilter::push(DOM::Element const& element)
 {
     for_each_element_hash(element, [&](u32 hash) {
-        m_ancestor_filter.increment(hash);
+        m_filter.increment(hash);
     });
 }
 
-void StyleComputer::pop_ancestor(DOM::Element const& element)
+void AncestorFilter::pop(DOM::Element const& element)
 {
     for_each_element_hash(element, [&](u32 hash) {
-        m_ancestor_filter.decrement(hash);
+        m_filter.decrement(hash);
     });
 }
 
@@ -16,6 +16,7 @@
 #include <LibWeb/CSS/CSSKeyframesRule.h>
 #include <LibWeb/CSS/CSSStyleDeclaration.h>
 #include <LibWeb/CSS/Selector.h>
+#include <LibWeb/CSS/StyleInvalidation.h>
 #include <LibWeb/CSS/StyleProperties.h>
 #include <LibWeb/Forward.h>
 #include <LibWeb/Loader/ResourceLoader.h>
@@ -71,6 +72,22 @@ private:
     CounterType m_buckets[bucket_count];
 };
 
+// The tag names, ids, classes and attribute names of the ancestors of the element whose style is being computed.
+// Every style tree traversal owns one of these, so that which rules are rejected for an element doesn't depend on
+// where some other traversal happens to be.
+class AncestorFilter {
+public:
+    AncestorFilter() { m_filter.clear(); }
+
+    void push(DOM::Element const&);
+    void pop(DOM::Element const&);
+
+    [[nodiscard]] bool may_contain(u32 hash) const { return m_filter.may_contain(hash); }
+
+private:
+    CountingBloomFilter<u8, 14> m_filter;
+};
+
 // https://www.w3.org/TR/css-cascade/#origin
 enum class CascadeOrigin : u8 {
     Author,
@@ -107,6 +124,14 @@ struct FontFaceKey {
 
 class FontLoader;
 
+// FIXME: Style is computed for one element at a time on the main thread. Restyling independent subtrees in parallel
+//        still needs all of the following to be addressed:
+//        - The cascade allocates GC cells (e.g. for CSS animations), and the GC heap isn't thread-safe.
+//        - StyleProperties, CSSStyleValue and String are refcounted without atomics.
+//        - FlyString interning goes through a single global table.
+//        - The font caches (and the fonts loaded through them) aren't thread-safe.
+//        - compute_style() writes to m_matched_properties_cache and m_style_sharing_statistics, which are shared by
+//          every traversal.
 class StyleComputer {
 public:
     enum class AllowUnresolved {
@@ -125,16 +150,13 @@ public:
     DOM::Document& document() { return m_document; }
     DOM::Document const& document() const { return m_document; }
 
-    void reset_ancestor_filter();
-    void push_ancestor(DOM::Element const&);
-    void pop_ancestor(DOM::Element const&);
-
     NonnullRefPtr<StyleProperties> create_document_style() const;
 
-    NonnullRefPtr<StyleProperties> compute_style(DOM::Element&, Optional<CSS::Selector::PseudoElement::Type> = {}) const;
-    RefPtr<StyleProperties> compute_pseudo_element_style_if_needed(DOM::Element&, Optional<CSS::Selector::PseudoElement::Type>) const;
+    // NOTE: The ancestor filter is only an optimization. Without one, no rules are rejected on account of the ancestors.
+    NonnullRefPtr<StyleProperties> compute_style(DOM::Element&, Optional<CSS::Selector::PseudoElement::Type> = {}, AncestorFilter const* = nullptr) const;
+    RefPtr<StyleProperties> compute_pseudo_element_style_if_needed(DOM::Element&, Optional<CSS::Selector::PseudoElement::Type>, AncestorFilter const* = nullptr) const;
 
-    Vector<MatchingRule> collect_matching_rules(DOM::Element const&, CascadeOrigin, Optional<CSS::Selector::PseudoElement::Type>, FlyString const& qualified_layer_name = {}) const;
+    Vector<MatchingRule> collect_matching_rules(DOM::Element const&, CascadeOrigin, Optional<CSS::Selector::PseudoElement::Type>, FlyString const& qualified_layer_name = {}, AncestorFilter const* = nullptr) const;
 
     void invalidate_rule_cache();
 
@@ -159,8 +181,28 @@ public:
 
     [[nodiscard]] bool has_has_selectors() const { return m_has_has_selectors; }
 
+    // Which elements may need their style recomputed when an element gains or loses a class or id, or one of its
+    // attributes changes value, according to the selectors in the rule caches.
+    [[nodiscard]] StyleInvalidationScope invalidation_scope_for_class(FlyString const&) const;
+    [[nodiscard]] StyleInvalidationScope invalidation_scope_for_id(FlyString const&) const;
+    [[nodiscard]] StyleInvalidationScope invalidation_scope_for_attribute(FlyString const& attribute_name) const;
+
     size_t number_of_css_font_faces_with_loading_in_progress() const;
 
+    struct StyleSharingStatistics {
+        size_t elements_considered { 0 };
+        size_t shared_with_sibling { 0 };
+        size_t matched_properties_cache_hits { 0 };
+    };
+    StyleSharingStatistics const& style_sharing_statistics() const { return m_style_sharing_statistics; }
+    void reset_style_sharing_statistics() { m_style_sharing_statistics = {}; }
+
+    void set_matched_properties_cache_enabled(bool);
+
+    // Cached styles may have resolved var() against custom properties of ancestors further up than the parent, which
+    // isn't part of the cache key. This has to be called when those change.
+    void clear_matched_properties_cache() { m_matched_properties_cache.clear(); }
+
 private:
     enum class ComputeStyleMode {
         Normal,
@@ -169,10 +211,9 @@ private:
 
     struct MatchingFontCandidate;
 
-    [[nodiscard]] bool should_reject_with_ancestor_filter(Selector const&) const;
+    [[nodiscard]] static bool should_reject_with_ancestor_filter(AncestorFilter const&, Selector const&);
 
-    RefPtr<StyleProperties> compute_style_impl(DOM::Element&, Optional<CSS::Selector::PseudoElement::Type>, ComputeStyleMode) const;
-    void compute_cascaded_values(StyleProperties&, DOM::Element&, Optional<CSS::Selector::PseudoElement::Type>, bool& did_match_any_pseudo_element_rules, ComputeStyleMode) const;
+    RefPtr<StyleProperties> compute_style_impl(DOM::Element&, Optional<CSS::Selector::PseudoElement::Type>, ComputeStyleMode, AncestorFilter const*) const;
     static RefPtr<Gfx::FontCascadeList const> find_matching_font_weight_ascending(Vector<MatchingFontCandidate> const& candidates, int target_weight, float font_size_in_pt, bool inclusive);
     static RefPtr<Gfx::FontCascadeList const> find_matching_font_weight_descending(Vector<MatchingFontCandidate> const& candidates, int target_weight, float font_size_in_pt, bool inclusive);
     RefPtr<Gfx::FontCascadeList const> font_matching_algorithm(FontFaceKey const& key, float font_size_in_pt) const;
@@ -209,8 +250,57 @@ private:
         Vector<LayerMatchingRules> author_rules;
     };
 
+    MatchingRuleSet collect_matching_rule_set(DOM::Element const&, Optional<CSS::Selector::PseudoElement::Type>, AncestorFilter const*) const;
+    void compute_cascaded_values(StyleProperties&, DOM::Element&, Optional<CSS::Selector::PseudoElement::Type>, MatchingRuleSet const&, bool& did_match_any_pseudo_element_rules, ComputeStyleMode) const;
     void cascade_declarations(StyleProperties&, DOM::Element&, Optional<CSS::Selector::PseudoElement::Type>, Vector<MatchingRule> const&, CascadeOrigin, Important, StyleProperties const& style_for_revert, StyleProperties const& style_for_revert_layer) const;
 
+    struct MatchedPropertiesCacheKey {
+        struct Attribute {
+            FlyString name;
+            String value;
+            bool operator==(Attribute const&) const = default;
+        };
+        struct Rule {
+            CSSStyleRule const* rule { nullptr };
+            size_t selector_index { 0 };
+            bool operator==(Rule const&) const = default;
+        };
+
+        NonnullRefPtr<StyleProperties const> parent_style;
+        FlyString local_name;
+        Optional<FlyString> namespace_uri;
+        Vector<Attribute> attributes;
+        Vector<Rule> rules;
+        u32 precomputed_hash { 0 };
+
+        [[nodiscard]] u32 hash() const { return precomputed_hash; }
+        [[nodiscard]] bool operator==(MatchedPropertiesCacheKey const& other) const
+        {
+            return precomputed_hash == other.precomputed_hash
+                && parent_style.ptr() == other.parent_style.ptr()
+                && local_name == other.local_name
+                && namespace_uri == other.namespace_uri
+                && attributes == other.attributes
+                && rules == other.rules;
+        }
+    };
+
+    struct MatchedPropertiesCacheEntry {
+        NonnullRefPtr<StyleProperties const> style;
+        HashMap<FlyString, CSS::StyleProperty> custom_properties;
+    };
+
+    static constexpr size_t max_style_sharing_candidates = 8;
+    static constexpr size_t max_matched_properties_cache_size = 4096;
+
+    [[nodiscard]] bool can_reuse_style_for_element(DOM::Element const&) const;
+    [[nodiscard]] DOM::Element const* find_sibling_to_share_style_with(DOM::Element const&) const;
+    [[nodiscard]] MatchedPropertiesCacheKey make_matched_properties_cache_key(DOM::Element const&, MatchingRuleSet const&) const;
+    void compute_transitions_for_reused_style(StyleProperties&, DOM::Element&) const;
+
+    template<typename Callback>
+    void for_each_sibling_dependent_rule(DOM::Element const&, Callback) const;
+
     void build_rule_cache();
     void build_rule_cache_if_needed() const;
 
@@ -227,9 +317,32 @@ private:
 
         HashMap<FlyString, NonnullRefPtr<Animations::KeyframeEffect::KeyFrameSet>> rules_by_animation_keyframes;
 
+        // Rules that could match one of two otherwise identical siblings, but not the other (e.g. :hover or :first-child).
+        // They're bucketed like the rules above, as only the ones for the id, classes and tag name the siblings share
+        // have to be matched.
+        struct SiblingDependentRules {
+            HashMap<FlyString, Vector<MatchingRule>> rules_by_id;
+            HashMap<FlyString, Vector<MatchingRule>> rules_by_class;
+            HashMap<FlyString, Vector<MatchingRule>> rules_by_tag_name;
+            Vector<MatchingRule> other_rules;
+        };
+        SiblingDependentRules sibling_dependent_rules;
+
         bool has_has_selectors { false };
+
+        HashMap<FlyString, StyleInvalidationScope, AK::ASCIICaseInsensitiveFlyStringTraits> invalidation_scopes_by_class;
+        HashMap<FlyString, StyleInvalidationScope, AK::ASCIICaseInsensitiveFlyStringTraits> invalidation_scopes_by_id;
+        HashMap<FlyString, StyleInvalidationScope, AK::ASCIICaseInsensitiveFlyStringTraits> invalidation_scopes_by_attribute_name;
+
+        // For pseudo-classes like :checked or :lang() that look at attributes, without saying which ones.
+        StyleInvalidationScope invalidation_scope_for_any_attribute;
     };
 
+    static void collect_invalidation_scopes(RuleCache&, Selector const&, StyleInvalidationScope const& scope_of_subject);
+
+    template<typename Callback>
+    StyleInvalidationScope invalidation_scope_from_rule_caches(Callback) const;
+
     NonnullOwnPtr<RuleCache> make_rule_cache_for_cascade_origin(CascadeOrigin);
 
     RuleCache const& rule_cache_for_cascade_origin(CascadeOrigin) const;
@@ -238,6 +351,11 @@ private:
     OwnPtr<RuleCache> m_author_rule_cache;
     OwnPtr<RuleCache> m_user_rule_cache;
     OwnPtr<RuleCache> m_user_agent_rule_cache;
+
+    bool m_matched_properties_cache_enabled { false };
+    // NOTE: These are written while computing style, by any traversal.
+    mutable HashMap<MatchedPropertiesCacheKey, MatchedPropertiesCacheEntry> m_matched_properties_cache;
+    mutable StyleSharingStatistics m_style_sharing_statistics;
     JS::Handle<CSSStyleSheet> m_user_style_sheet;
 
     using FontLoaderList = Vector<NonnullOwnPtr<FontLoader>>;
@@ -247,8 +365,6 @@ private:
     Length::FontMetrics m_root_element_font_metrics;
 
     CSSPixelRect m_viewport_rect;
-
-    CountingBloomFilter<u8, 14> m_ancestor_filter;
 };
 
 class FontLoader : public ResourceClient {
@@ -29,6 +29,27 @@ struct RequiredInvalidationAfterStyleChange {
     static RequiredInvalidationAfterStyleChange full() { return { true, true, true, true }; }
 };
 
+// The elements whose style may change when a class, id or attribute of an element changes, as far as selectors go.
+struct StyleInvalidationScope {
+    bool invalidate_self : 1 { false };
+    bool invalidate_descendants : 1 { false };
+    bool invalidate_subsequent_siblings : 1 { false };
+
+    // Set for things inside :has(), which can make any ancestor (or earlier sibling) match. We don't know which ones,
+    // so this invalidates the whole document.
+    bool invalidate_document : 1 { false };
+
+    void operator|=(StyleInvalidationScope const& other)
+    {
+        invalidate_self |= other.invalidate_self;
+        invalidate_descendants |= other.invalidate_descendants;
+        invalidate_subsequent_siblings |= other.invalidate_subsequent_siblings;
+        invalidate_document |= other.invalidate_document;
+    }
+
+    [[nodiscard]] bool is_empty() const { return !invalidate_self && !invalidate_descendants && !invalidate_subsequent_siblings && !invalidate_document; }
+};
+
 RequiredInvalidationAfterStyleChange compute_property_invalidation(CSS::PropertyID property_id, RefPtr<CSSStyleValue const> const& old_value, RefPtr<CSSStyleValue const> const& new_value);
 
 }
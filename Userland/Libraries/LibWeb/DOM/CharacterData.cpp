@@ -123,10 +123,12 @@ WebIDL::ExceptionOr<void> CharacterData::replace_data(size_t offset, size_t coun
     // NOTE: Since the text node's data has changed, we need to invalidate the text for rendering.
     //       This ensures that the new text is reflected in layout, even if we don't end up
     //       doing a full layout tree rebuild.
-    if (auto* layout_node = this->layout_node(); layout_node && layout_node->is_text_node())
+    if (auto* layout_node = this->layout_node(); layout_node && layout_node->is_text_node()) {
         static_cast<Layout::TextNode&>(*layout_node).invalidate_text_for_rendering();
-
-    document().set_needs_layout();
+        layout_node->set_needs_layout();
+    } else {
+        document().set_needs_layout();
+    }
 
     if (m_grapheme_segmenter)
         m_grapheme_segmenter->set_segmented_text(m_data);
@@ -973,6 +973,7 @@ WebIDL::ExceptionOr<void> Document::set_title(String const& title)
 
 void Document::tear_down_layout_tree()
 {
+    m_layout_state = nullptr;
     m_layout_root = nullptr;
     m_paintable = nullptr;
 }
@@ -1074,6 +1075,13 @@ URL::URL Document::parse_url(StringView url) const
 }
 
 void Document::set_needs_layout()
+{
+    // NOTE: We don't know what has changed, so nothing from the previous layout can be reused.
+    m_layout_state = nullptr;
+    set_needs_partial_layout();
+}
+
+void Document::set_needs_partial_layout()
 {
     if (m_needs_layout)
         return;
@@ -1187,28 +1195,53 @@ void Document::update_layout()
         return TraversalDecision::Continue;
     });
 
-    Layout::LayoutState layout_state;
+    // NOTE: If all the changes since the previous layout are inside a box that can be laid out on its own,
+    //       we only update the previous layout inside of that box.
+    auto previous_layout_state = move(m_layout_state);
+    ++m_layout_generation;
 
-    {
-        Layout::BlockFormattingContext root_formatting_context(layout_state, Layout::LayoutMode::Normal, *m_layout_root, nullptr);
+    // NOTE: Without a previous layout, we don't know what has changed, so none of the intrinsic sizes kept on the layout nodes can be trusted.
+    if (!previous_layout_state) {
+        m_layout_root->for_each_in_inclusive_subtree_of_type<Layout::NodeWithStyle>([](auto& node) {
+            node.clear_intrinsic_sizes();
+            return TraversalDecision::Continue;
+        });
+    }
+
+    OwnPtr<Layout::LayoutState> layout_state;
+    if (previous_layout_state && previous_layout_state->try_to_update_layout_inside_relayout_boundary(*m_layout_root)) {
+        layout_state = move(previous_layout_state);
+    } else {
+        layout_state = make<Layout::LayoutState>();
+        layout_state->previous_layout_state = previous_layout_state.ptr();
 
-        auto& viewport = static_cast<Layout::Viewport&>(*m_layout_root);
-        auto& viewport_state = layout_state.get_mutable(viewport);
-        viewport_state.set_content_width(viewport_rect.width());
-        viewport_state.set_content_height(viewport_rect.height());
+        {
+            Layout::BlockFormattingContext root_formatting_context(*layout_state, Layout::LayoutMode::Normal, *m_layout_root, nullptr);
 
-        if (document_element && document_element->layout_node()) {
-            auto& icb_state = layout_state.get_mutable(verify_cast<Layout::NodeWithStyleAndBoxModelMetrics>(*document_element->layout_node()));
-            icb_state.set_content_width(viewport_rect.width());
+            auto& viewport = static_cast<Layout::Viewport&>(*m_layout_root);
+            auto& viewport_state = layout_state->get_mutable(viewport);
+            viewport_state.set_content_width(viewport_rect.width());
+            viewport_state.set_content_height(viewport_rect.height());
+
+            if (document_element && document_element->layout_node()) {
+                auto& icb_state = layout_state->get_mutable(verify_cast<Layout::NodeWithStyleAndBoxModelMetrics>(*document_element->layout_node()));
+                icb_state.set_content_width(viewport_rect.width());
+            }
+
+            root_formatting_context.run(
+                Layout::AvailableSpace(
+                    Layout::AvailableSize::make_definite(viewport_rect.width()),
+                    Layout::AvailableSize::make_definite(viewport_rect.height())));
         }
 
-        root_formatting_context.run(
-            Layout::AvailableSpace(
-                Layout::AvailableSize::make_definite(viewport_rect.width()),
-                Layout::AvailableSize::make_definite(viewport_rect.height())));
+        layout_state->previous_layout_state = nullptr;
     }
 
-    layout_state.commit(*m_layout_root);
+    dbgln_if(LIBWEB_LAYOUT_DEBUG, "Layout: Computed {} intrinsic sizes, reused {}", layout_state->statistics.intrinsic_size_computations, layout_state->statistics.reused_intrinsic_sizes);
+
+    layout_state->commit(*m_layout_root);
+    m_layout_root->clear_needs_layout_in_inclusive_subtree();
+    m_layout_state = move(layout_state);
 
     // Broadcast the current viewport rect to any new paintables, so they know whether they're visible or not.
     inform_all_viewport_clients_about_the_current_viewport_rect();
@@ -1236,30 +1269,42 @@ void Document::update_layout()
         window->scroll_by(0, 0);
 }
 
-[[nodiscard]] static CSS::RequiredInvalidationAfterStyleChange update_style_recursively(Node& node, CSS::StyleComputer& style_computer)
+[[nodiscard]] static CSS::RequiredInvalidationAfterStyleChange update_style_recursively(Node& node, CSS::StyleComputer& style_computer, CSS::AncestorFilter& ancestor_filter, bool parent_style_changed = false, bool ancestor_custom_properties_changed = false)
 {
     bool const needs_full_style_update = node.document().needs_full_style_update();
     CSS::RequiredInvalidationAfterStyleChange invalidation;
 
     if (node.is_element())
-        style_computer.push_ancestor(static_cast<Element const&>(node));
+        ancestor_filter.push(static_cast<Element const&>(node));
 
     // NOTE: If the current node has `display:none`, we can disregard all invalidation
     //       caused by its children, as they will not be rendered anyway.
     //       We will still recompute style for the children, though.
     bool is_display_none = false;
 
+    // NOTE: The children inherit from this node, so if its style changed, theirs has to be recomputed too.
+    //       Nodes that aren't elements (i.e. shadow roots) pass on the change from their host.
+    bool style_changed = parent_style_changed;
+
+    // NOTE: var() is resolved against the custom properties of all ancestors, so when those change, the whole subtree
+    //       has to be recomputed, even below elements whose computed values stayed the same.
+    bool custom_properties_changed = ancestor_custom_properties_changed;
+
     if (is<Element>(node)) {
-        invalidation |= static_cast<Element&>(node).recompute_style();
+        bool element_custom_properties_changed = false;
+        auto element_invalidation = static_cast<Element&>(node).recompute_style(ancestor_filter, element_custom_properties_changed);
+        style_changed = !element_invalidation.is_none();
+        custom_properties_changed |= element_custom_properties_changed;
+        invalidation |= element_invalidation;
         is_display_none = static_cast<Element&>(node).computed_css_values()->display().is_none();
     }
     node.set_needs_style_update(false);
 
-    if (needs_full_style_update || node.child_needs_style_update()) {
+    if (needs_full_style_update || style_changed || custom_properties_changed || node.child_needs_style_update()) {
         if (node.is_element()) {
             if (auto shadow_root = static_cast<DOM::Element&>(node).shadow_root()) {
-                if (needs_full_style_update || shadow_root->needs_style_update() || shadow_root->child_needs_style_update()) {
-                    auto subtree_invalidation = update_style_recursively(*shadow_root, style_computer);
+                if (needs_full_style_update || style_changed || custom_properties_changed || shadow_root->needs_style_update() || shadow_root->child_needs_style_update()) {
+                    auto subtree_invalidation = update_style_recursively(*shadow_root, style_computer, ancestor_filter, style_changed, custom_properties_changed);
                     if (!is_display_none)
                         invalidation |= subtree_invalidation;
                 }
@@ -1267,8 +1312,8 @@ void Document::update_layout()
         }
 
         node.for_each_child([&](auto& child) {
-            if (needs_full_style_update || child.needs_style_update() || child.child_needs_style_update()) {
-                auto subtree_invalidation = update_style_recursively(child, style_computer);
+            if (needs_full_style_update || style_changed || custom_properties_changed || child.needs_style_update() || child.child_needs_style_update()) {
+                auto subtree_invalidation = update_style_recursively(child, style_computer, ancestor_filter, false, custom_properties_changed);
                 if (!is_display_none)
                     invalidation |= subtree_invalidation;
             }
@@ -1279,7 +1324,7 @@ void Document::update_layout()
     node.set_child_needs_style_update(false);
 
     if (node.is_element())
-        style_computer.pop_ancestor(static_cast<Element const&>(node));
+        ancestor_filter.pop(static_cast<Element const&>(node));
 
     return invalidation;
 }
@@ -1307,17 +1352,29 @@ void Document::update_style()
 
     evaluate_media_rules();
 
-    style_computer().reset_ancestor_filter();
+    style_computer().reset_style_sharing_statistics();
+
+    // NOTE: The matched properties cache is only valid while nothing in the DOM changes, so it only lives for one style update.
+    style_computer().set_matched_properties_cache_enabled(true);
+    CSS::AncestorFilter ancestor_filter;
+    auto invalidation = update_style_recursively(*this, style_computer(), ancestor_filter);
+    style_computer().set_matched_properties_cache_enabled(false);
+
+    if constexpr (LIBWEB_CSS_DEBUG) {
+        auto const& statistics = style_computer().style_sharing_statistics();
+        dbgln("Style update: {} elements could share style, {} shared with a sibling, {} hit the matched properties cache",
+            statistics.elements_considered, statistics.shared_with_sibling, statistics.matched_properties_cache_hits);
+    }
 
-    auto invalidation = update_style_recursively(*this, style_computer());
     if (!invalidation.is_none()) {
         invalidate_display_list();
     }
     if (invalidation.rebuild_layout_tree) {
         invalidate_layout_tree();
     } else {
+        // NOTE: The elements whose style changed have marked their layout nodes as needing layout.
         if (invalidation.relayout)
-            set_needs_layout();
+            set_needs_partial_layout();
         if (invalidation.rebuild_stacking_context_tree)
             invalidate_stacking_context_tree();
     }
@@ -244,6 +244,13 @@ public:
 
     void set_needs_layout();
 
+    // Like set_needs_layout(), but for when the layout nodes that changed have been marked with Layout::Node::set_needs_layout(),
+    // so that the results of the previous layout can be reused for the rest of the layout tree.
+    void set_needs_partial_layout();
+
+    // Increments every time the layout tree is laid out, so results cached on layout nodes can tell which layout they came from.
+    u64 layout_generation() const { return m_layout_generation; }
+
     void invalidate_layout_tree();
     void invalidate_stacking_context_tree();
 
@@ -784,6 +791,10 @@ private:
 
     JS::GCPtr<Layout::Viewport> m_layout_root;
 
+    // The results of the previous layout of m_layout_root, kept around so the next layout can reuse parts of it.
+    OwnPtr<Layout::LayoutState> m_layout_state;
+    u64 m_layout_generation { 0 };
+
     Optional<Color> m_normal_link_color;
     Optional<Color> m_active_link_color;
     Optional<Color> m_visited_link_color;
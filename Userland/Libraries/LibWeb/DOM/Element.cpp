@@ -450,7 +450,7 @@ void Element::run_attribute_change_steps(FlyString const& local_name, Optional<S
     attribute_changed(local_name, old_value, value);
 
     if (old_value != value) {
-        invalidate_style_after_attribute_change(local_name);
+        invalidate_style_after_attribute_change(local_name, old_value, value);
         document().bump_dom_tree_version();
     }
 }
@@ -531,12 +531,32 @@ static CSS::RequiredInvalidationAfterStyleChange compute_required_invalidation(C
     return invalidation;
 }
 
-CSS::RequiredInvalidationAfterStyleChange Element::recompute_style()
+static bool custom_properties_are_equal(HashMap<FlyString, CSS::StyleProperty> const& a, HashMap<FlyString, CSS::StyleProperty> const& b)
+{
+    if (a.size() != b.size())
+        return false;
+    for (auto const& it : a) {
+        auto other = b.find(it.key);
+        if (other == b.end() || other->value.important != it.value.important || *other->value.value != *it.value.value)
+            return false;
+    }
+    return true;
+}
+
+CSS::RequiredInvalidationAfterStyleChange Element::recompute_style(CSS::AncestorFilter& ancestor_filter, bool& custom_properties_changed)
 {
     VERIFY(parent());
 
     auto& style_computer = document().style_computer();
-    auto new_computed_css_values = style_computer.compute_style(*this);
+
+    // NOTE: Computing the style replaces the custom properties, so there's no need to copy the old ones.
+    auto old_custom_properties = move(m_custom_properties);
+    auto new_computed_css_values = style_computer.compute_style(*this, {}, &ancestor_filter);
+
+    // NOTE: Without a previous style, the descendants get their style computed for the first time anyway.
+    custom_properties_changed = m_computed_css_values && !custom_properties_are_equal(old_custom_properties, m_custom_properties);
+    if (custom_properties_changed)
+        style_computer.clear_matched_properties_cache();
 
     // Tables must not inherit -libweb-* values for text-align.
     // FIXME: Find the spec for this.
@@ -557,10 +577,10 @@ CSS::RequiredInvalidationAfterStyleChange Element::recompute_style()
 
     // Any document change that can cause this element's style to change, could also affect its pseudo-elements.
     auto recompute_pseudo_element_style = [&](CSS::Selector::PseudoElement::Type pseudo_element) {
-        style_computer.push_ancestor(*this);
+        ancestor_filter.push(*this);
 
         auto pseudo_element_style = pseudo_element_computed_css_values(pseudo_element);
-        auto new_pseudo_element_style = style_computer.compute_pseudo_element_style_if_needed(*this, pseudo_element);
+        auto new_pseudo_element_style = style_computer.compute_pseudo_element_style_if_needed(*this, pseudo_element, &ancestor_filter);
 
         // TODO: Can we be smarter about invalidation?
         if (pseudo_element_style && new_pseudo_element_style) {
@@ -570,7 +590,7 @@ CSS::RequiredInvalidationAfterStyleChange Element::recompute_style()
         }
 
         set_pseudo_element_computed_css_values(pseudo_element, move(new_pseudo_element_style));
-        style_computer.pop_ancestor(*this);
+        ancestor_filter.pop(*this);
     };
 
     recompute_pseudo_element_style(CSS::Selector::PseudoElement::Type::Before);
@@ -585,6 +605,8 @@ CSS::RequiredInvalidationAfterStyleChange Element::recompute_style()
     if (!invalidation.rebuild_layout_tree && layout_node()) {
         // If we're keeping the layout tree, we can just apply the new style to the existing layout tree.
         layout_node()->apply_style(*m_computed_css_values);
+        if (invalidation.relayout)
+            layout_node()->set_needs_layout();
         if (invalidation.repaint && paintable())
             paintable()->set_needs_display();
 
@@ -601,6 +623,8 @@ CSS::RequiredInvalidationAfterStyleChange Element::recompute_style()
 
             if (auto* node_with_style = dynamic_cast<Layout::NodeWithStyle*>(pseudo_element->layout_node.ptr())) {
                 node_with_style->apply_style(*pseudo_element_style);
+                if (invalidation.relayout)
+                    node_with_style->set_needs_layout();
                 if (invalidation.repaint && node_with_style->paintable())
                     node_with_style->paintable()->set_needs_display();
             }
@@ -1930,13 +1954,39 @@ ErrorOr<void> Element::scroll_into_view(Optional<Variant<bool, ScrollIntoViewOpt
     // FIXME: 8. Optionally perform some other action that brings the element to the user’s attention.
 }
 
-void Element::invalidate_style_after_attribute_change(FlyString const& attribute_name)
+void Element::invalidate_style_after_attribute_change(FlyString const& attribute_name, Optional<String> const& old_value, Optional<String> const& new_value)
 {
-    // FIXME: Only invalidate if the attribute can actually affect style.
-    (void)attribute_name;
+    if (document().needs_full_style_update())
+        return;
 
-    // FIXME: This will need to become smarter when we implement the :has() selector.
-    invalidate_style(StyleInvalidationReason::ElementAttributeChange);
+    auto const& style_computer = document().style_computer();
+    auto scope = style_computer.invalidation_scope_for_attribute(attribute_name);
+
+    if (attribute_name == HTML::AttributeNames::class_) {
+        // Only the classes that were added or removed can change which selectors match.
+        auto old_classes = old_value.value_or(String {}).bytes_as_string_view().split_view_if(Infra::is_ascii_whitespace);
+        for (auto const& old_class : old_classes) {
+            if (!m_classes.contains_slow(old_class))
+                scope |= style_computer.invalidation_scope_for_class(MUST(FlyString::from_utf8(old_class)));
+        }
+        for (auto const& new_class : m_classes) {
+            if (!old_classes.contains_slow(new_class.bytes_as_string_view()))
+                scope |= style_computer.invalidation_scope_for_class(new_class);
+        }
+    } else if (attribute_name == HTML::AttributeNames::id) {
+        if (old_value.has_value())
+            scope |= style_computer.invalidation_scope_for_id(MUST(FlyString::from_utf8(*old_value)));
+        if (new_value.has_value())
+            scope |= style_computer.invalidation_scope_for_id(MUST(FlyString::from_utf8(*new_value)));
+    } else {
+        // NOTE: Any other attribute may be mapped to style by a presentational hint. A few also apply to descendants,
+        //       like the cellpadding attribute of tables does to their cells.
+        scope.invalidate_self = true;
+        if (attribute_maps_to_presentational_hints_of_descendants(attribute_name))
+            scope.invalidate_descendants = true;
+    }
+
+    invalidate_style(StyleInvalidationReason::ElementAttributeChange, scope);
 }
 
 // https://www.w3.org/TR/wai-aria-1.2/#tree_exclusion
@@ -169,13 +169,18 @@ public:
 
     virtual void apply_presentational_hints(CSS::StyleProperties&) const { }
 
+    // Whether the attribute is used by the presentational hints of descendants, rather than (only) those of this element.
+    virtual bool attribute_maps_to_presentational_hints_of_descendants(FlyString const&) const { return false; }
+
     // https://dom.spec.whatwg.org/#concept-element-attributes-change-ext
     virtual void attribute_change_steps(FlyString const& local_name, Optional<String> const& old_value, Optional<String> const& value, Optional<FlyString> const& namespace_);
 
     void run_attribute_change_steps(FlyString const& local_name, Optional<String> const& old_value, Optional<String> const& value, Optional<FlyString> const& namespace_);
     virtual void attribute_changed(FlyString const& name, Optional<String> const& old_value, Optional<String> const& value);
 
-    CSS::RequiredInvalidationAfterStyleChange recompute_style();
+    // NOTE: `custom_properties_changed` is set when this element's custom properties changed. They aren't part of the
+    //       returned invalidation, as they don't affect this element's rendering, but descendants resolve var() against them.
+    CSS::RequiredInvalidationAfterStyleChange recompute_style(CSS::AncestorFilter&, bool& custom_properties_changed);
 
     Optional<CSS::Selector::PseudoElement::Type> use_pseudo_element() const { return m_use_pseudo_element; }
     void set_use_pseudo_element(Optional<CSS::Selector::PseudoElement::Type> use_pseudo_element) { m_use_pseudo_element = move(use_pseudo_element); }
@@ -432,7 +437,7 @@ protected:
 private:
     void make_html_uppercased_qualified_name();
 
-    void invalidate_style_after_attribute_change(FlyString const& attribute_name);
+    void invalidate_style_after_attribute_change(FlyString const& attribute_name, Optional<String> const& old_value, Optional<String> const& new_value);
 
     WebIDL::ExceptionOr<JS::GCPtr<Node>> insert_adjacent(StringView where, JS::NonnullGCPtr<Node> node);
 
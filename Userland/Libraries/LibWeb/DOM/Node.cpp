@@ -15,6 +15,7 @@
 #include <LibURL/Origin.h>
 #include <LibWeb/Bindings/MainThreadVM.h>
 #include <LibWeb/Bindings/NodePrototype.h>
+#include <LibWeb/CSS/StyleInvalidation.h>
 #include <LibWeb/DOM/Attr.h>
 #include <LibWeb/DOM/CDATASection.h>
 #include <LibWeb/DOM/Comment.h>
@@ -421,33 +422,54 @@ void Node::invalidate_style(StyleInvalidationReason reason)
     // - all of its subsequent siblings and their descendants
     // FIXME: This is a lot of invalidation and we should implement more sophisticated invalidation to do less work!
 
-    auto invalidate_entire_subtree = [&](Node& subtree_root) {
-        subtree_root.for_each_in_inclusive_subtree([&](Node& node) {
-            node.m_needs_style_update = true;
-            if (node.has_children())
-                node.m_child_needs_style_update = true;
-            if (auto shadow_root = node.is_element() ? static_cast<DOM::Element&>(node).shadow_root() : nullptr) {
-                node.m_child_needs_style_update = true;
-                shadow_root->m_needs_style_update = true;
-                if (shadow_root->has_children())
-                    shadow_root->m_child_needs_style_update = true;
-            }
-            return TraversalDecision::Continue;
-        });
-    };
-
-    invalidate_entire_subtree(*this);
+    invalidate_style_for_entire_subtree();
 
     if (reason == StyleInvalidationReason::NodeInsertBefore || reason == StyleInvalidationReason::NodeRemove) {
         for (auto* sibling = previous_sibling(); sibling; sibling = sibling->previous_sibling()) {
             if (sibling->is_element())
-                invalidate_entire_subtree(*sibling);
+                sibling->invalidate_style_for_entire_subtree();
         }
     }
 
     for (auto* sibling = next_sibling(); sibling; sibling = sibling->next_sibling()) {
         if (sibling->is_element())
-            invalidate_entire_subtree(*sibling);
+            sibling->invalidate_style_for_entire_subtree();
+    }
+
+    for (auto* ancestor = parent_or_shadow_host(); ancestor; ancestor = ancestor->parent_or_shadow_host())
+        ancestor->m_child_needs_style_update = true;
+    document().schedule_style_update();
+}
+
+// Like invalidate_style(), but only for the elements that selectors say may be affected by some change to this node.
+void Node::invalidate_style(StyleInvalidationReason reason, CSS::StyleInvalidationScope const& scope)
+{
+    if (scope.is_empty())
+        return;
+
+    if (scope.invalidate_document) {
+        document().invalidate_style(reason);
+        return;
+    }
+
+    if (scope.invalidate_subsequent_siblings || is_document()) {
+        invalidate_style(reason);
+        return;
+    }
+
+    if (is_character_data() || document().needs_full_style_update())
+        return;
+
+    if (!needs_style_update()) {
+        dbgln_if(STYLE_INVALIDATION_DEBUG, "Invalidate style ({}, {}): {}", to_string(reason), scope.invalidate_descendants ? "subtree"sv : "self"sv, debug_description());
+    }
+
+    // NOTE: There's no need to invalidate the descendants just because they inherit from this node. If its style
+    //       changes, the style update recomputes the style of its children as well.
+    if (scope.invalidate_descendants) {
+        invalidate_style_for_entire_subtree();
+    } else {
+        m_needs_style_update = true;
     }
 
     for (auto* ancestor = parent_or_shadow_host(); ancestor; ancestor = ancestor->parent_or_shadow_host())
@@ -455,6 +477,22 @@ void Node::invalidate_style(StyleInvalidationReason reason)
     document().schedule_style_update();
 }
 
+void Node::invalidate_style_for_entire_subtree()
+{
+    for_each_in_inclusive_subtree([&](Node& node) {
+        node.m_needs_style_update = true;
+        if (node.has_children())
+            node.m_child_needs_style_update = true;
+        if (auto shadow_root = node.is_element() ? static_cast<DOM::Element&>(node).shadow_root() : nullptr) {
+            node.m_child_needs_style_update = true;
+            shadow_root->m_needs_style_update = true;
+            if (shadow_root->has_children())
+                shadow_root->m_child_needs_style_update = true;
+        }
+        return TraversalDecision::Continue;
+    });
+}
+
 String Node::child_text_content() const
 {
     if (!is<ParentNode>(*this))
@@ -262,6 +262,7 @@ public:
     void set_child_needs_style_update(bool b) { m_child_needs_style_update = b; }
 
     void invalidate_style(StyleInvalidationReason);
+    void invalidate_style(StyleInvalidationReason, CSS::StyleInvalidationScope const&);
 
     void set_document(Badge<Document>, Document&);
 
@@ -769,6 +770,8 @@ private:
     void append_child_impl(JS::NonnullGCPtr<Node>);
     void remove_child_impl(JS::NonnullGCPtr<Node>);
 
+    void invalidate_style_for_entire_subtree();
+
     static Optional<StringView> first_valid_id(StringView, Document const&);
     static ErrorOr<void> append_without_space(StringBuilder, StringView const&);
     static ErrorOr<void> append_with_space(StringBuilder, StringView const&);
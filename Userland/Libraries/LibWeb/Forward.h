@@ -94,6 +94,7 @@ class SubtleCrypto;
 
 namespace Web::CSS {
 class AbstractImageStyleValue;
+class AncestorFilter;
 class Angle;
 class AngleOrCalculated;
 class AnglePercentage;
@@ -201,6 +202,7 @@ class ShorthandStyleValue;
 class Size;
 class StringStyleValue;
 class StyleComputer;
+struct StyleInvalidationScope;
 class StyleProperties;
 class StyleSheet;
 struct StyleSheetIdentifier;
@@ -135,7 +135,7 @@ Optional<JS::PropertyDescriptor> cross_origin_get_own_property_helper(Variant<HT
             if (value->is_function()) {
                 value = JS::NativeFunction::create(
                     realm, [function = JS::make_handle(*value)](auto& vm) {
-                        return JS::call(vm, function.value(), JS::js_undefined(), vm.running_execution_context().arguments.span());
+                        return JS::call(vm, function.value(), JS::js_undefined(), vm.running_execution_context().arguments);
                     },
                     0, "");
             }
@@ -152,7 +152,7 @@ Optional<JS::PropertyDescriptor> cross_origin_get_own_property_helper(Variant<HT
             if (*entry.needs_get) {
                 cross_origin_get = JS::NativeFunction::create(
                     realm, [object_ptr, getter = JS::make_handle(*original_descriptor->get)](auto& vm) {
-                        return JS::call(vm, getter.cell(), object_ptr, vm.running_execution_context().arguments.span());
+                        return JS::call(vm, getter.cell(), object_ptr, vm.running_execution_context().arguments);
                     },
                     0, "");
             }
@@ -164,7 +164,7 @@ Optional<JS::PropertyDescriptor> cross_origin_get_own_property_helper(Variant<HT
             if (*entry.needs_set) {
                 cross_origin_set = JS::NativeFunction::create(
                     realm, [object_ptr, setter = JS::make_handle(*original_descriptor->set)](auto& vm) {
-                        return JS::call(vm, setter.cell(), object_ptr, vm.running_execution_context().arguments.span());
+                        return JS::call(vm, setter.cell(), object_ptr, vm.running_execution_context().arguments);
                     },
                     0, "");
             }
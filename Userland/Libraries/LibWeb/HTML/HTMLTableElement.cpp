@@ -108,6 +108,12 @@ void HTMLTableElement::apply_presentational_hints(CSS::StyleProperties& style) c
     });
 }
 
+// NOTE: The cells of the table get their padding and borders from these, see HTMLTableCellElement::apply_presentational_hints().
+bool HTMLTableElement::attribute_maps_to_presentational_hints_of_descendants(FlyString const& name) const
+{
+    return name.is_one_of(HTML::AttributeNames::cellpadding, HTML::AttributeNames::border);
+}
+
 void HTMLTableElement::attribute_changed(FlyString const& name, Optional<String> const& old_value, Optional<String> const& value)
 {
     Base::attribute_changed(name, old_value, value);
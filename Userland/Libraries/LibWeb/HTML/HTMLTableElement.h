@@ -59,6 +59,7 @@ private:
     virtual void visit_edges(Cell::Visitor&) override;
 
     virtual void apply_presentational_hints(CSS::StyleProperties&) const override;
+    virtual bool attribute_maps_to_presentational_hints_of_descendants(FlyString const&) const override;
     virtual void attribute_changed(FlyString const& name, Optional<String> const& old_value, Optional<String> const& value) override;
 
     JS::GCPtr<DOM::HTMLCollection> mutable m_rows;
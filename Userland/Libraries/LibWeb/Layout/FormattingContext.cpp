@@ -228,13 +228,44 @@ OwnPtr<FormattingContext> FormattingContext::layout_inside(Box const& child_box,
 
     auto independent_formatting_context = create_independent_formatting_context_if_needed(m_state, layout_mode, child_box);
     if (independent_formatting_context)
-        independent_formatting_context->run(available_space);
+        run_independent_formatting_context(*independent_formatting_context, available_space);
     else
         run(available_space);
 
     return independent_formatting_context;
 }
 
+void FormattingContext::run_independent_formatting_context(FormattingContext& context, AvailableSpace const& available_space)
+{
+    auto const& box = context.context_box();
+
+    // OPTIMIZATION: If nothing inside `box` has changed since the previous layout, and it's being laid out the same way
+    //               as last time, we can reuse the results of the previous layout.
+    //               We only do this for the top-level layout, and for block formatting contexts, as they don't change
+    //               their root box (other than its line boxes) once it has a definite width.
+    Optional<LayoutState::FormattingContextInputs> inputs;
+    if (context.m_layout_mode == LayoutMode::Normal && !m_state.m_parent && context.type() == Type::Block) {
+        auto const& used_values = m_state.get(box);
+        inputs = LayoutState::FormattingContextInputs {
+            .available_space = available_space,
+            .content_width = used_values.content_width(),
+            .content_height = used_values.content_height(),
+            .has_definite_width = used_values.has_definite_width(),
+            .has_definite_height = used_values.has_definite_height(),
+        };
+        if (m_state.can_reuse_previous_layout_of_insides(box, *inputs)) {
+            m_state.reuse_previous_layout_of_insides(box);
+            m_state.formatting_context_inputs.set(box, *inputs);
+            return;
+        }
+    }
+
+    context.run(available_space);
+
+    if (inputs.has_value())
+        m_state.formatting_context_inputs.set(box, *inputs);
+}
+
 CSSPixels FormattingContext::greatest_child_width(Box const& box) const
 {
     CSSPixels max_width = 0;
@@ -1402,22 +1433,44 @@ CSSPixels FormattingContext::calculate_fit_content_height(Layout::Box const& box
     return calculate_max_content_height(box, available_space.width.to_px_or_zero());
 }
 
+static Optional<CSSPixels> reuse_cached_intrinsic_width(LayoutState const& root_state, Optional<IntrinsicSizes::Width>& cached_width, AvailableSize const& available_height, u64 layout_generation)
+{
+    if (!cached_width.has_value())
+        return {};
+
+    // NOTE: Over the course of a single layout, the intrinsic width of a box doesn't change. One from an earlier layout
+    //       is still good if nothing inside the box has changed since (which would have cleared it), and the box has
+    //       the same available height as back then.
+    if (cached_width->layout_generation != layout_generation) {
+        if (cached_width->available_height != available_height)
+            return {};
+        cached_width->layout_generation = layout_generation;
+    }
+
+    ++root_state.statistics.reused_intrinsic_sizes;
+    return cached_width->value;
+}
+
 CSSPixels FormattingContext::calculate_min_content_width(Layout::Box const& box) const
 {
     if (box.has_natural_width())
         return *box.natural_width();
 
-    auto& root_state = m_state.m_root;
+    auto const& box_state = m_state.get(box);
+    auto available_height = box_state.has_definite_height()
+        ? AvailableSize::make_definite(box_state.content_height())
+        : AvailableSize::make_indefinite();
+
+    if (auto cached_width = reuse_cached_intrinsic_width(m_state.m_root, box.intrinsic_sizes().min_content_width, available_height, box.document().layout_generation()); cached_width.has_value())
+        return *cached_width;
 
-    auto& cache = *root_state.intrinsic_sizes.ensure(&box, [] { return adopt_own(*new LayoutState::IntrinsicSizes); });
-    if (cache.min_content_width.has_value())
-        return *cache.min_content_width;
+    ++m_state.m_root.statistics.intrinsic_size_computations;
 
     LayoutState throwaway_state(&m_state);
 
-    auto& box_state = throwaway_state.get_mutable(box);
-    box_state.width_constraint = SizeConstraint::MinContent;
-    box_state.set_indefinite_content_width();
+    auto& throwaway_box_state = throwaway_state.get_mutable(box);
+    throwaway_box_state.width_constraint = SizeConstraint::MinContent;
+    throwaway_box_state.set_indefinite_content_width();
 
     auto context = const_cast<FormattingContext*>(this)->create_independent_formatting_context_if_needed(throwaway_state, LayoutMode::IntrinsicSizing, box);
     if (!context) {
@@ -1425,21 +1478,19 @@ CSSPixels FormattingContext::calculate_min_content_width(Layout::Box const& box)
     }
 
     auto available_width = AvailableSize::make_min_content();
-    auto available_height = box_state.has_definite_height()
-        ? AvailableSize::make_definite(box_state.content_height())
-        : AvailableSize::make_indefinite();
 
     context->run(AvailableSpace(available_width, available_height));
 
-    cache.min_content_width = context->automatic_content_width();
+    auto min_content_width = context->automatic_content_width();
 
-    if (cache.min_content_width->might_be_saturated()) {
+    if (min_content_width.might_be_saturated()) {
         // HACK: If layout calculates a non-finite result, something went wrong. Force it to zero and log a little whine.
         dbgln("FIXME: Calculated non-finite min-content width for {}", box.debug_description());
-        cache.min_content_width = 0;
+        min_content_width = 0;
     }
 
-    return *cache.min_content_width;
+    box.intrinsic_sizes().min_content_width = IntrinsicSizes::Width { min_content_width, available_height, box.document().layout_generation() };
+    return min_content_width;
 }
 
 CSSPixels FormattingContext::calculate_max_content_width(Layout::Box const& box) const
@@ -1447,17 +1498,21 @@ CSSPixels FormattingContext::calculate_max_content_width(Layout::Box const& box)
     if (box.has_natural_width())
         return *box.natural_width();
 
-    auto& root_state = m_state.m_root;
+    auto const& box_state = m_state.get(box);
+    auto available_height = box_state.has_definite_height()
+        ? AvailableSize::make_definite(box_state.content_height())
+        : AvailableSize::make_indefinite();
 
-    auto& cache = *root_state.intrinsic_sizes.ensure(&box, [] { return adopt_own(*new LayoutState::IntrinsicSizes); });
-    if (cache.max_content_width.has_value())
-        return *cache.max_content_width;
+    if (auto cached_width = reuse_cached_intrinsic_width(m_state.m_root, box.intrinsic_sizes().max_content_width, available_height, box.document().layout_generation()); cached_width.has_value())
+        return *cached_width;
+
+    ++m_state.m_root.statistics.intrinsic_size_computations;
 
     LayoutState throwaway_state(&m_state);
 
-    auto& box_state = throwaway_state.get_mutable(box);
-    box_state.width_constraint = SizeConstraint::MaxContent;
-    box_state.set_indefinite_content_width();
+    auto& throwaway_box_state = throwaway_state.get_mutable(box);
+    throwaway_box_state.width_constraint = SizeConstraint::MaxContent;
+    throwaway_box_state.set_indefinite_content_width();
 
     auto context = const_cast<FormattingContext*>(this)->create_independent_formatting_context_if_needed(throwaway_state, LayoutMode::IntrinsicSizing, box);
     if (!context) {
@@ -1465,21 +1520,19 @@ CSSPixels FormattingContext::calculate_max_content_width(Layout::Box const& box)
     }
 
     auto available_width = AvailableSize::make_max_content();
-    auto available_height = box_state.has_definite_height()
-        ? AvailableSize::make_definite(box_state.content_height())
-        : AvailableSize::make_indefinite();
 
     context->run(AvailableSpace(available_width, available_height));
 
-    cache.max_content_width = context->automatic_content_width();
+    auto max_content_width = context->automatic_content_width();
 
-    if (cache.max_content_width->might_be_saturated()) {
+    if (max_content_width.might_be_saturated()) {
         // HACK: If layout calculates a non-finite result, something went wrong. Force it to zero and log a little whine.
         dbgln("FIXME: Calculated non-finite max-content width for {}", box.debug_description());
-        cache.max_content_width = 0;
+        max_content_width = 0;
     }
 
-    return *cache.max_content_width;
+    box.intrinsic_sizes().max_content_width = IntrinsicSizes::Width { max_content_width, available_height, box.document().layout_generation() };
+    return max_content_width;
 }
 
 // https://www.w3.org/TR/css-sizing-3/#min-content-block-size
@@ -1493,13 +1546,15 @@ CSSPixels FormattingContext::calculate_min_content_height(Layout::Box const& box
         return *box.natural_height();
 
     auto get_cache_slot = [&]() -> Optional<CSSPixels>* {
-        auto& root_state = m_state.m_root;
-        auto& cache = *root_state.intrinsic_sizes.ensure(&box, [] { return adopt_own(*new LayoutState::IntrinsicSizes); });
-        return &cache.min_content_height.ensure(width);
+        return &box.intrinsic_sizes().min_content_height.ensure(width);
     };
 
-    if (auto* cache_slot = get_cache_slot(); cache_slot && cache_slot->has_value())
+    if (auto* cache_slot = get_cache_slot(); cache_slot && cache_slot->has_value()) {
+        ++m_state.m_root.statistics.reused_intrinsic_sizes;
         return cache_slot->value();
+    }
+
+    ++m_state.m_root.statistics.intrinsic_size_computations;
 
     LayoutState throwaway_state(&m_state);
 
@@ -1537,13 +1592,15 @@ CSSPixels FormattingContext::calculate_max_content_height(Layout::Box const& box
         return *box.natural_height();
 
     auto get_cache_slot = [&]() -> Optional<CSSPixels>* {
-        auto& root_state = m_state.m_root;
-        auto& cache = *root_state.intrinsic_sizes.ensure(&box, [] { return adopt_own(*new LayoutState::IntrinsicSizes); });
-        return &cache.max_content_height.ensure(width);
+        return &box.intrinsic_sizes().max_content_height.ensure(width);
     };
 
-    if (auto* cache_slot = get_cache_slot(); cache_slot && cache_slot->has_value())
+    if (auto* cache_slot = get_cache_slot(); cache_slot && cache_slot->has_value()) {
+        ++m_state.m_root.statistics.reused_intrinsic_sizes;
         return cache_slot->value();
+    }
+
+    ++m_state.m_root.statistics.intrinsic_size_computations;
 
     LayoutState throwaway_state(&m_state);
 
@@ -121,6 +121,7 @@ protected:
     [[nodiscard]] bool should_treat_max_height_as_none(Box const&, AvailableSize const&) const;
 
     OwnPtr<FormattingContext> layout_inside(Box const&, LayoutMode, AvailableSpace const&);
+    void run_independent_formatting_context(FormattingContext&, AvailableSpace const&);
 
     struct SpaceUsedByFloats {
         CSSPixels left { 0 };
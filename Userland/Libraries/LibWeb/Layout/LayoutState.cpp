@@ -9,6 +9,7 @@
 #include <LibWeb/DOM/ShadowRoot.h>
 #include <LibWeb/Layout/AvailableSpace.h>
 #include <LibWeb/Layout/BlockContainer.h>
+#include <LibWeb/Layout/BlockFormattingContext.h>
 #include <LibWeb/Layout/InlineNode.h>
 #include <LibWeb/Layout/LayoutState.h>
 #include <LibWeb/Layout/Viewport.h>
@@ -278,7 +279,8 @@ void LayoutState::commit(Box& root)
 
             if (used_values.computed_svg_path().has_value() && is<Painting::SVGPathPaintable>(paintable_box)) {
                 auto& svg_geometry_paintable = static_cast<Painting::SVGPathPaintable&>(paintable_box);
-                svg_geometry_paintable.set_computed_path(move(*used_values.computed_svg_path()));
+                // NOTE: The path is copied rather than moved, as the used values may be reused by the next layout.
+                svg_geometry_paintable.set_computed_path(*used_values.computed_svg_path());
             }
 
             if (node.display().is_grid_inside()) {
@@ -423,6 +425,160 @@ void LayoutState::commit(Box& root)
     }
 }
 
+static bool has_absolutely_positioned_descendant_laid_out_by_ancestor(Box const& box)
+{
+    // NOTE: These are laid out by the formatting context of their containing block, but their static position is
+    //       determined by the layout of `box`, relative to the containing block.
+    return box.for_each_in_subtree([&](Node const& descendant) {
+        if (!descendant.is_absolutely_positioned())
+            return TraversalDecision::Continue;
+        if (auto const* containing_block = descendant.containing_block(); containing_block && !box.is_inclusive_ancestor_of(*containing_block))
+            return TraversalDecision::Break;
+        return TraversalDecision::Continue;
+    }) == TraversalDecision::Break;
+}
+
+bool LayoutState::can_reuse_previous_layout_of_insides(Box const& box, FormattingContextInputs const& inputs) const
+{
+    if (!previous_layout_state)
+        return false;
+
+    if (box.needs_layout() || box.child_needs_layout())
+        return false;
+
+    // NOTE: Block formatting contexts only change the size of their root box if it doesn't have a definite width.
+    if (!inputs.has_definite_width)
+        return false;
+
+    auto previous_inputs = previous_layout_state->formatting_context_inputs.get(box);
+    if (!previous_inputs.has_value() || previous_inputs.value() != inputs)
+        return false;
+
+    auto const* previous_used_values = previous_layout_state->used_values_per_layout_node.get(box).value_or(nullptr);
+    if (!previous_used_values)
+        return false;
+
+    // NOTE: Floats are placed horizontally only after the parent formatting context has dimensioned the root box,
+    //       so their previous position may not be valid anymore.
+    if (!previous_used_values->floating_descendants().is_empty())
+        return false;
+
+    return !has_absolutely_positioned_descendant_laid_out_by_ancestor(box);
+}
+
+void LayoutState::reuse_previous_layout_of_insides(Box const& box)
+{
+    VERIFY(previous_layout_state);
+    auto const& previous_used_values_per_layout_node = previous_layout_state->used_values_per_layout_node;
+
+    get_mutable(box).line_boxes = previous_used_values_per_layout_node.get(box).value()->line_boxes;
+
+    box.for_each_in_subtree_of_type<NodeWithStyle>([&](NodeWithStyle const& descendant) {
+        auto const* previous_used_values = previous_used_values_per_layout_node.get(descendant).value_or(nullptr);
+        if (!previous_used_values)
+            return TraversalDecision::Continue;
+
+        // NOTE: The containing block of a descendant may be outside of `box`, so we keep pointing to the one in this layout.
+        auto& used_values = get_mutable(descendant);
+        auto const* containing_block_used_values = used_values.m_containing_block_used_values;
+        used_values = *previous_used_values;
+        used_values.m_containing_block_used_values = containing_block_used_values;
+        return TraversalDecision::Continue;
+    });
+}
+
+// A box that establishes a block formatting context, and whose size doesn't depend on what's inside it.
+// Nothing inside such a box can affect the layout of what's outside of it, except for its baseline.
+static bool is_relayout_boundary(Box const& box)
+{
+    if (box.is_viewport() || !is<BlockContainer>(box))
+        return false;
+
+    auto formatting_context_type = FormattingContext::formatting_context_type_created_by_box(box);
+    if (!formatting_context_type.has_value() || formatting_context_type.value() != FormattingContext::Type::Block)
+        return false;
+
+    // NOTE: Flex, grid and table layout may size their children based on what's inside them.
+    auto parent_display = box.parent()->display();
+    if (!parent_display.is_flow_inside() && !parent_display.is_flow_root_inside())
+        return false;
+
+    auto const& computed_values = box.computed_values();
+    if (!computed_values.width().is_length() || !computed_values.height().is_length())
+        return false;
+
+    return !has_absolutely_positioned_descendant_laid_out_by_ancestor(box);
+}
+
+bool LayoutState::try_to_update_layout_inside_relayout_boundary(Viewport const& viewport)
+{
+    // Only the top-level LayoutState is kept around between layouts.
+    VERIFY(!m_parent);
+    statistics = {};
+
+    if (viewport.needs_layout())
+        return false;
+    if (!viewport.child_needs_layout())
+        return true;
+
+    // Follow the changes down the tree, until we find a relayout boundary that contains all of them.
+    Node const* node = &viewport;
+    Box const* relayout_boundary = nullptr;
+    while (!relayout_boundary) {
+        if (node->needs_layout())
+            return false;
+
+        Node const* changed_child = nullptr;
+        for (auto const* child = node->first_child(); child; child = child->next_sibling()) {
+            if (!child->needs_layout() && !child->child_needs_layout())
+                continue;
+            if (changed_child)
+                return false;
+            changed_child = child;
+        }
+        if (!changed_child)
+            return false;
+
+        if (!changed_child->needs_layout() && changed_child->is_box() && is_relayout_boundary(static_cast<Box const&>(*changed_child)))
+            relayout_boundary = static_cast<Box const*>(changed_child);
+        else
+            node = changed_child;
+    }
+
+    auto inputs = formatting_context_inputs.get(*relayout_boundary);
+    if (!inputs.has_value() || !inputs->has_definite_width)
+        return false;
+
+    // NOTE: If the parent formatting context changed the size of the box after laying out its insides,
+    //       we can't tell what the insides were laid out for.
+    auto& box_state = get_mutable(*relayout_boundary);
+    if (box_state.content_width() != inputs->content_width || box_state.content_height() != inputs->content_height)
+        return false;
+
+    auto const& block_container = static_cast<BlockContainer const&>(*relayout_boundary);
+    BlockFormattingContext context(*this, LayoutMode::Normal, block_container, nullptr);
+    auto baseline_before_layout = context.box_baseline(block_container);
+
+    // Forget everything about the insides of the box, and lay them out again from scratch.
+    // NOTE: This includes the intrinsic sizes kept on the layout nodes. Marking a node as needing layout already clears
+    //       them for it and its ancestors, but the layout of the box must not depend on that having happened.
+    relayout_boundary->clear_intrinsic_sizes();
+    relayout_boundary->for_each_in_subtree([&](Node const& descendant) {
+        used_values_per_layout_node.remove(descendant);
+        if (descendant.has_style())
+            static_cast<NodeWithStyle const&>(descendant).clear_intrinsic_sizes();
+        return TraversalDecision::Continue;
+    });
+    box_state.clear_floating_descendants();
+
+    context.run(inputs->available_space);
+    context.parent_context_did_dimension_child_root_box();
+
+    // NOTE: If the box is on a line, the line is aligned to its baseline, so a new baseline means a new line layout.
+    //       The insides of the box have been laid out correctly regardless, so this layout is still good for reuse.
+    return context.box_baseline(block_container) == baseline_before_layout;
+}
+
 void LayoutState::UsedValues::set_node(NodeWithStyle& node, UsedValues const* containing_block_used_values)
 {
     m_node = &node;
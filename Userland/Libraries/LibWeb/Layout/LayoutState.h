@@ -9,6 +9,7 @@
 #include <AK/HashMap.h>
 #include <LibGfx/Path.h>
 #include <LibGfx/Point.h>
+#include <LibWeb/Layout/AvailableSpace.h>
 #include <LibWeb/Layout/Box.h>
 #include <LibWeb/Layout/LineBox.h>
 #include <LibWeb/Painting/PaintableBox.h>
@@ -22,9 +23,6 @@ enum class SizeConstraint {
     MaxContent,
 };
 
-class AvailableSize;
-class AvailableSpace;
-
 // https://www.w3.org/TR/css-position-3/#static-position-rectangle
 struct StaticPositionRect {
     enum class Alignment {
@@ -151,6 +149,7 @@ struct LayoutState {
         Optional<LineBoxFragmentCoordinate> containing_line_box_fragment;
 
         void add_floating_descendant(Box const& box) { m_floating_descendants.set(&box); }
+        void clear_floating_descendants() { m_floating_descendants.clear(); }
         auto const& floating_descendants() const { return m_floating_descendants; }
 
         void set_override_borders_data(Painting::PaintableBox::BordersDataWithElementKind const& override_borders_data) { m_override_borders_data = override_borders_data; }
@@ -181,6 +180,8 @@ struct LayoutState {
         }
 
     private:
+        friend struct LayoutState;
+
         AvailableSize available_width_inside() const;
         AvailableSize available_height_inside() const;
 
@@ -225,17 +226,37 @@ struct LayoutState {
 
     HashMap<JS::NonnullGCPtr<Layout::Node const>, NonnullOwnPtr<UsedValues>> used_values_per_layout_node;
 
-    // We cache intrinsic sizes once determined, as they will not change over the course of a full layout.
-    // This avoids computing them several times while performing flex layout.
-    struct IntrinsicSizes {
-        Optional<CSSPixels> min_content_width;
-        Optional<CSSPixels> max_content_width;
+    // Counts of how much work a layout did, kept in the top-level LayoutState.
+    struct Statistics {
+        size_t intrinsic_size_computations { 0 };
+        size_t reused_intrinsic_sizes { 0 };
+    };
+
+    Statistics mutable statistics;
 
-        HashMap<CSSPixels, Optional<CSSPixels>> min_content_height;
-        HashMap<CSSPixels, Optional<CSSPixels>> max_content_height;
+    // What a formatting context root box looked like when its insides were last laid out.
+    // If the next layout finds the box the same, and nothing inside it has changed, it can reuse the results.
+    struct FormattingContextInputs {
+        AvailableSpace available_space;
+        CSSPixels content_width;
+        CSSPixels content_height;
+        bool has_definite_width { false };
+        bool has_definite_height { false };
+
+        bool operator==(FormattingContextInputs const&) const = default;
     };
 
-    HashMap<JS::GCPtr<NodeWithStyle const>, NonnullOwnPtr<IntrinsicSizes>> mutable intrinsic_sizes;
+    HashMap<JS::NonnullGCPtr<Box const>, FormattingContextInputs> formatting_context_inputs;
+
+    // The results of the previous layout of the same layout tree, if they're still usable.
+    LayoutState const* previous_layout_state { nullptr };
+
+    [[nodiscard]] bool can_reuse_previous_layout_of_insides(Box const&, FormattingContextInputs const&) const;
+    void reuse_previous_layout_of_insides(Box const&);
+
+    // If everything that changed since this layout is inside one box whose insides can't affect anything outside of it,
+    // lays out the insides of that box again, updating this layout in place. Returns false if that wasn't possible.
+    [[nodiscard]] bool try_to_update_layout_inside_relayout_boundary(Viewport const&);
 
     LayoutState const* m_parent { nullptr };
     LayoutState const& m_root;
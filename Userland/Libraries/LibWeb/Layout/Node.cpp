@@ -288,6 +288,13 @@ NodeWithStyle::NodeWithStyle(DOM::Document& document, DOM::Node* node, NonnullOw
     m_has_style = true;
 }
 
+IntrinsicSizes& NodeWithStyle::intrinsic_sizes() const
+{
+    if (!m_intrinsic_sizes)
+        m_intrinsic_sizes = make<IntrinsicSizes>();
+    return *m_intrinsic_sizes;
+}
+
 void NodeWithStyle::visit_edges(Visitor& visitor)
 {
     Base::visit_edges(visitor);
@@ -1035,6 +1042,32 @@ void Node::set_paintable(JS::GCPtr<Painting::Paintable> paintable)
     m_paintable = move(paintable);
 }
 
+void Node::set_needs_layout()
+{
+    m_needs_layout = true;
+    if (has_style())
+        static_cast<NodeWithStyle&>(*this).clear_intrinsic_sizes();
+
+    // NOTE: An ancestor that's already marked had its intrinsic sizes cleared at that time, and so did all of its ancestors.
+    for (auto* ancestor = parent(); ancestor && !ancestor->m_child_needs_layout; ancestor = ancestor->parent()) {
+        ancestor->m_child_needs_layout = true;
+        ancestor->clear_intrinsic_sizes();
+    }
+    document().set_needs_partial_layout();
+}
+
+void Node::clear_needs_layout_in_inclusive_subtree()
+{
+    if (!m_needs_layout && !m_child_needs_layout)
+        return;
+    m_needs_layout = false;
+    if (!m_child_needs_layout)
+        return;
+    m_child_needs_layout = false;
+    for (auto* child = first_child(); child; child = child->next_sibling())
+        child->clear_needs_layout_in_inclusive_subtree();
+}
+
 JS::GCPtr<Painting::Paintable> Node::create_paintable() const
 {
     return nullptr;
@@ -18,6 +18,7 @@
 #include <LibWeb/CSS/StyleValues/ImageStyleValue.h>
 #include <LibWeb/DOM/Document.h>
 #include <LibWeb/Forward.h>
+#include <LibWeb/Layout/AvailableSpace.h>
 #include <LibWeb/Layout/BoxModelMetrics.h>
 #include <LibWeb/Painting/PaintContext.h>
 #include <LibWeb/TreeNode.h>
@@ -159,6 +160,13 @@ public:
     void removed_from(Node&) { }
     void children_changed() { }
 
+    // Something about this node that affects layout (e.g. its style or text) has changed since the last layout.
+    // The ancestors of such nodes are marked with child_needs_layout(), so layout can tell which subtrees are unchanged.
+    bool needs_layout() const { return m_needs_layout; }
+    bool child_needs_layout() const { return m_child_needs_layout; }
+    void set_needs_layout();
+    void clear_needs_layout_in_inclusive_subtree();
+
     bool children_are_inline() const { return m_children_are_inline; }
     void set_children_are_inline(bool value) { m_children_are_inline = value; }
 
@@ -197,11 +205,33 @@ private:
     bool m_is_flex_item { false };
     bool m_is_grid_item { false };
 
+    bool m_needs_layout { false };
+    bool m_child_needs_layout { false };
+
     GeneratedFor m_generated_for { GeneratedFor::NotGenerated };
 
     u32 m_initial_quote_nesting_level { 0 };
 };
 
+// Intrinsic sizes are kept on the layout node between layouts, until something inside of it changes.
+// This avoids computing them several times while performing flex layout, and again in every layout after that.
+struct IntrinsicSizes {
+    struct Width {
+        CSSPixels value;
+
+        // NOTE: Widths are computed with the box's own height, if it's definite. That can change without anything
+        //       inside the box changing, so widths from an earlier layout are only valid for the same available height.
+        AvailableSize available_height;
+        u64 layout_generation { 0 };
+    };
+
+    Optional<Width> min_content_width;
+    Optional<Width> max_content_width;
+
+    HashMap<CSSPixels, Optional<CSSPixels>> min_content_height;
+    HashMap<CSSPixels, Optional<CSSPixels>> max_content_height;
+};
+
 class NodeWithStyle : public Node {
     JS_CELL(NodeWithStyle, Node);
 
@@ -221,6 +251,9 @@ public:
 
     void transfer_table_box_computed_values_to_wrapper_computed_values(CSS::ComputedValues& wrapper_computed_values);
 
+    IntrinsicSizes& intrinsic_sizes() const;
+    void clear_intrinsic_sizes() const { m_intrinsic_sizes = nullptr; }
+
     virtual void visit_edges(Cell::Visitor& visitor) override;
 
 protected:
@@ -233,6 +266,7 @@ private:
 
     NonnullOwnPtr<CSS::ComputedValues> m_computed_values;
     RefPtr<CSS::AbstractImageStyleValue const> m_list_style_image;
+    mutable OwnPtr<IntrinsicSizes> m_intrinsic_sizes;
 };
 
 class NodeWithStyleAndBoxModelMetrics : public NodeWithStyle {
@@ -293,11 +293,11 @@ void TreeBuilder::create_layout_tree(DOM::Node& dom_node, TreeBuilder::Context&
             return;
     }
     if (dom_node.is_element())
-        dom_node.document().style_computer().push_ancestor(static_cast<DOM::Element const&>(dom_node));
+        m_ancestor_filter.push(static_cast<DOM::Element const&>(dom_node));
 
     ScopeGuard pop_ancestor_guard = [&] {
         if (dom_node.is_element())
-            dom_node.document().style_computer().pop_ancestor(static_cast<DOM::Element const&>(dom_node));
+            m_ancestor_filter.pop(static_cast<DOM::Element const&>(dom_node));
     };
 
     JS::GCPtr<Layout::Node> layout_node;
@@ -412,7 +412,7 @@ void TreeBuilder::create_layout_tree(DOM::Node& dom_node, TreeBuilder::Context&
 
     if (is<ListItemBox>(*layout_node)) {
         auto& element = static_cast<DOM::Element&>(dom_node);
-        auto marker_style = style_computer.compute_style(element, CSS::Selector::PseudoElement::Type::Marker);
+        auto marker_style = style_computer.compute_style(element, CSS::Selector::PseudoElement::Type::Marker, &m_ancestor_filter);
         auto list_item_marker = document.heap().allocate_without_realm<ListItemMarkerBox>(document, layout_node->computed_values().list_style_type(), layout_node->computed_values().list_style_position(), calculate_list_item_index(dom_node), *marker_style);
         static_cast<ListItemBox&>(*layout_node).set_marker(list_item_marker);
         element.set_pseudo_element_node({}, CSS::Selector::PseudoElement::Type::Marker, list_item_marker);
@@ -525,8 +525,6 @@ JS::GCPtr<Layout::Node> TreeBuilder::build(DOM::Node& dom_node)
 {
     VERIFY(dom_node.is_document());
 
-    dom_node.document().style_computer().reset_ancestor_filter();
-
     Context context;
     m_quote_nesting_level = 0;
     create_layout_tree(dom_node, context);
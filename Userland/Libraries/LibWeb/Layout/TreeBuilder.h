@@ -10,6 +10,7 @@
 #include <LibJS/Heap/GCPtr.h>
 #include <LibWeb/CSS/Display.h>
 #include <LibWeb/CSS/Selector.h>
+#include <LibWeb/CSS/StyleComputer.h>
 #include <LibWeb/Forward.h>
 
 namespace Web::Layout {
@@ -55,6 +56,7 @@ private:
 
     JS::GCPtr<Layout::Node> m_layout_root;
     Vector<JS::NonnullGCPtr<Layout::NodeWithStyle>> m_ancestor_stack;
+    CSS::AncestorFilter m_ancestor_filter;
 
     u32 m_quote_nesting_level { 0 };
 };
@@ -71,6 +71,7 @@ void Application::initialize(Main::Arguments const& arguments, URL::URL new_tab_
     Optional<StringView> profile_process;
     Optional<StringView> webdriver_content_ipc_path;
     Optional<StringView> user_agent_preset;
+    Optional<StringView> bytecode_cache_directory;
     bool log_all_js_exceptions = false;
     bool enable_idl_tracing = false;
     bool enable_http_cache = false;
@@ -98,6 +99,7 @@ void Application::initialize(Main::Arguments const& arguments, URL::URL new_tab_
     args_parser.add_option(expose_internals_object, "Expose internals object", "expose-internals-object");
     args_parser.add_option(force_cpu_painting, "Force CPU painting", "force-cpu-painting");
     args_parser.add_option(force_fontconfig, "Force using fontconfig for font loading", "force-fontconfig");
+    args_parser.add_option(bytecode_cache_directory, "Keep the bytecode of scripts in the given directory, to reuse it when they run again", "bytecode-cache", 0, "directory");
     args_parser.add_option(Core::ArgsParser::Option {
         .argument_mode = Core::ArgsParser::OptionArgumentMode::Required,
         .help_string = "Name of the User-Agent preset to use in place of the default User-Agent",
@@ -155,6 +157,9 @@ void Application::initialize(Main::Arguments const& arguments, URL::URL new_tab_
         .enable_autoplay = enable_autoplay ? EnableAutoplay::Yes : EnableAutoplay::No,
     };
 
+    if (bytecode_cache_directory.has_value())
+        m_web_content_options.bytecode_cache_directory = *bytecode_cache_directory;
+
     create_platform_options(m_chrome_options, m_web_content_options);
 
     if (m_chrome_options.disable_sql_database == DisableSQLDatabase::No) {
@@ -108,6 +108,7 @@ struct WebContentOptions {
     ForceCPUPainting force_cpu_painting { ForceCPUPainting::No };
     ForceFontconfig force_fontconfig { ForceFontconfig::No };
     EnableAutoplay enable_autoplay { EnableAutoplay::No };
+    Optional<ByteString> bytecode_cache_directory {};
 };
 
 }
@@ -11,12 +11,15 @@
 
 #include <AK/JsonObject.h>
 #include <AK/QuickSort.h>
+#include <LibCore/File.h>
+#include <LibCore/StandardPaths.h>
 #include <LibGfx/Bitmap.h>
 #include <LibGfx/Font/FontDatabase.h>
 #include <LibGfx/SystemTheme.h>
 #include <LibJS/Heap/Heap.h>
 #include <LibJS/Runtime/ConsoleObject.h>
 #include <LibJS/Runtime/Date.h>
+#include <LibJS/Runtime/SamplingProfiler.h>
 #include <LibUnicode/TimeZone.h>
 #include <LibWeb/ARIA/RoleType.h>
 #include <LibWeb/Bindings/MainThreadVM.h>
@@ -358,6 +361,39 @@ void ConnectionFromClient::debug_request(u64 page_id, ByteString const& request,
         return;
     }
 
+    if (request == "garbage-collection-compaction") {
+        Web::Bindings::main_thread_vm().heap().set_compaction_enabled(argument == "on");
+        return;
+    }
+
+    if (request == "start-js-profiler") {
+        Web::Bindings::main_thread_vm().start_sampling_profiler(AK::Duration::from_milliseconds(1));
+        return;
+    }
+
+    if (request == "stop-js-profiler") {
+        auto profiler = Web::Bindings::main_thread_vm().stop_sampling_profiler();
+        if (!profiler)
+            return;
+
+        auto path = argument.is_empty()
+            ? ByteString::formatted("{}/js-profile-{}.cpuprofile", Core::StandardPaths::tempfile_directory(), getpid())
+            : argument;
+        auto profile = path.ends_with(".cpuprofile"sv) ? profiler->to_cpuprofile() : profiler->to_folded_stacks();
+
+        auto file_or_error = Core::File::open(path, Core::File::OpenMode::Write);
+        if (file_or_error.is_error()) {
+            dbgln("Failed to open {} for the JS profile: {}", path, file_or_error.error());
+            return;
+        }
+        if (auto result = file_or_error.value()->write_until_depleted(profile.bytes()); result.is_error()) {
+            dbgln("Failed to write the JS profile to {}: {}", path, result.error());
+            return;
+        }
+        dbgln("Wrote JS profile with {} samples to {}", profiler->sample_count(), path);
+        return;
+    }
+
     if (request == "set-line-box-borders") {
         bool state = argument == "on";
         page->set_should_show_line_box_borders(state);
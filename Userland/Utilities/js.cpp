@@ -7,22 +7,27 @@
  */
 
 #include <AK/JsonValue.h>
+#include <AK/ScopeGuard.h>
 #include <AK/StringBuilder.h>
 #include <LibCore/ArgsParser.h>
 #include <LibCore/ConfigFile.h>
 #include <LibCore/StandardPaths.h>
 #include <LibCore/System.h>
 #include <LibJS/Bytecode/BasicBlock.h>
+#include <LibJS/Bytecode/ExecutableCache.h>
 #include <LibJS/Bytecode/Generator.h>
 #include <LibJS/Bytecode/Interpreter.h>
+#include <LibJS/Bytecode/PassManager.h>
 #include <LibJS/Console.h>
 #include <LibJS/Contrib/Test262/GlobalObject.h>
+#include <LibJS/JIT/Compiler.h>
 #include <LibJS/Parser.h>
 #include <LibJS/Print.h>
 #include <LibJS/Runtime/ConsoleObject.h>
 #include <LibJS/Runtime/DeclarativeEnvironment.h>
 #include <LibJS/Runtime/GlobalEnvironment.h>
 #include <LibJS/Runtime/JSONObject.h>
+#include <LibJS/Runtime/SamplingProfiler.h>
 #include <LibJS/Runtime/StringPrototype.h>
 #include <LibJS/Runtime/ValueInlines.h>
 #include <LibJS/SourceTextModule.h>
@@ -189,6 +194,14 @@ static ErrorOr<String> read_next_piece()
     return piece.to_string();
 }
 
+static ErrorOr<void> write_profile(JS::SamplingProfiler const& profiler, StringView path)
+{
+    auto profile = path.ends_with(".cpuprofile"sv) ? profiler.to_cpuprofile() : profiler.to_folded_stacks();
+    auto file = TRY(Core::File::open(path, Core::File::OpenMode::Write, 0666));
+    TRY(file->write_until_depleted(profile.bytes()));
+    return {};
+}
+
 static ErrorOr<void> write_to_file(String const& path)
 {
     auto file = TRY(Core::File::open(path, Core::File::OpenMode::Write, 0666));
@@ -531,9 +544,17 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
     TRY(Core::System::pledge("stdio rpath wpath cpath tty sigaction map_fixed"));
 
     bool gc_on_every_allocation = false;
+    bool generational_gc = false;
+    bool disable_lazy_parsing = false;
+    bool disable_jit = false;
+    size_t gc_marking_threads = 0;
+    bool concurrent_gc_sweeping = false;
+    bool gc_compaction = false;
     bool disable_syntax_highlight = false;
     bool disable_debug_printing = false;
     bool use_test262_global = false;
+    StringView bytecode_optimizations;
+    StringView profile_path;
     StringView evaluate_script;
     Vector<StringView> script_paths;
 
@@ -541,11 +562,23 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
     args_parser.set_general_help("This is a JavaScript interpreter.");
     args_parser.add_option(s_dump_ast, "Dump the AST", "dump-ast", 'A');
     args_parser.add_option(JS::Bytecode::g_dump_bytecode, "Dump the bytecode", "dump-bytecode", 'd');
+    args_parser.add_option(JS::Bytecode::g_dump_property_lookup_cache_statistics, "Dump property lookup cache hits and misses when bytecode is freed", "dump-property-lookup-cache-statistics", {});
+    args_parser.add_option(bytecode_optimizations, "Comma-separated list of bytecode optimization passes to run, 'all' (the default) or 'none'", "bytecode-optimizations", {}, "passes");
+    args_parser.add_option(JS::Bytecode::g_dump_optimization_pass_statistics, "Dump how much each bytecode optimization pass removed on exit", "dump-bytecode-optimization-statistics", {});
+    args_parser.add_option(disable_jit, "Don't compile hot bytecode to native code", "disable-jit", {});
+    args_parser.add_option(JS::JIT::g_jit_threshold, "Number of calls or loop iterations after which bytecode is compiled to native code", "jit-threshold", {}, "count");
+    args_parser.add_option(disable_lazy_parsing, "Parse function bodies right away instead of when they are first called", "disable-lazy-parsing", {});
+    args_parser.add_option(JS::Bytecode::g_bytecode_cache_directory, "Keep the bytecode for scripts in the given directory, and reuse it when the same script is run again", "bytecode-cache", {}, "directory");
+    args_parser.add_option(profile_path, "Sample where time is spent in JavaScript code, and write the profile to the given file (Chrome DevTools format if it ends in .cpuprofile, folded stacks otherwise)", "profile", {}, "file");
     args_parser.add_option(s_as_module, "Treat as module", "as-module", 'm');
     args_parser.add_option(s_print_last_result, "Print last result", "print-last-result", 'l');
     args_parser.add_option(s_strip_ansi, "Disable ANSI colors", "disable-ansi-colors", 'i');
     args_parser.add_option(s_disable_source_location_hints, "Disable source location hints", "disable-source-location-hints", 'h');
     args_parser.add_option(gc_on_every_allocation, "GC on every allocation", "gc-on-every-allocation", 'g');
+    args_parser.add_option(generational_gc, "Enable generational garbage collection (experimental)", "generational-gc", {});
+    args_parser.add_option(gc_marking_threads, "Number of helper threads used for GC marking", "gc-marking-threads", {}, "count");
+    args_parser.add_option(concurrent_gc_sweeping, "Sweep heap blocks on a background thread when none of their dead cells need the main thread", "concurrent-gc-sweeping", {});
+    args_parser.add_option(gc_compaction, "Compact the heap and return free memory to the OS after each GC", "gc-compaction", {});
     args_parser.add_option(disable_syntax_highlight, "Disable live syntax highlighting", "no-syntax-highlight", 's');
     args_parser.add_option(disable_debug_printing, "Disable debug output", "disable-debug-output", {});
     args_parser.add_option(evaluate_script, "Evaluate argument as a script", "evaluate", 'c', "script");
@@ -554,12 +587,57 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
     args_parser.parse(arguments);
 
     bool syntax_highlight = !disable_syntax_highlight;
+    JS::g_lazy_function_parsing = !disable_lazy_parsing;
 
     AK::set_debug_enabled(!disable_debug_printing);
+
+    if (disable_jit)
+        JS::JIT::g_jit_enabled = false;
+
+    if (!bytecode_optimizations.is_empty()) {
+        for (size_t i = 0; i < to_underlying(JS::Bytecode::OptimizationPass::__Count); ++i)
+            JS::Bytecode::set_optimization_pass_enabled(static_cast<JS::Bytecode::OptimizationPass>(i), false);
+    }
+    for (auto name : bytecode_optimizations.split_view(',')) {
+        if (name == "none"sv)
+            continue;
+        if (name == "all"sv) {
+            for (size_t i = 0; i < to_underlying(JS::Bytecode::OptimizationPass::__Count); ++i)
+                JS::Bytecode::set_optimization_pass_enabled(static_cast<JS::Bytecode::OptimizationPass>(i), true);
+            continue;
+        }
+        auto pass = JS::Bytecode::optimization_pass_from_name(name);
+        if (!pass.has_value()) {
+            warnln("Unknown bytecode optimization pass '{}'", name);
+            return 1;
+        }
+        JS::Bytecode::set_optimization_pass_enabled(*pass, true);
+    }
+
+    ScopeGuard dump_optimization_pass_statistics = [] {
+        if (JS::Bytecode::g_dump_optimization_pass_statistics)
+            JS::Bytecode::dump_optimization_pass_statistics();
+    };
+
     s_history_path = TRY(String::formatted("{}/.js-history", Core::StandardPaths::home_directory()));
 
     g_vm = TRY(JS::VM::create());
     g_vm->set_dynamic_imports_allowed(true);
+    g_vm->heap().set_generational_collection_enabled(generational_gc);
+    g_vm->heap().set_parallel_marking_thread_count(gc_marking_threads);
+    g_vm->heap().set_concurrent_sweeping_enabled(concurrent_gc_sweeping);
+    g_vm->heap().set_compaction_enabled(gc_compaction);
+
+    if (!profile_path.is_empty())
+        g_vm->start_sampling_profiler(AK::Duration::from_milliseconds(1));
+
+    ScopeGuard write_sampling_profile = [&] {
+        auto profiler = g_vm->stop_sampling_profiler();
+        if (!profiler)
+            return;
+        if (auto result = write_profile(*profiler, profile_path); result.is_error())
+            warnln("Failed to write profile to {}: {}", profile_path, result.error());
+    };
 
     if (!disable_debug_printing) {
         // NOTE: These will print out both warnings when using something like Promise.reject().catch(...) -